@@ -151,6 +151,7 @@ CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config,
                                               const ComponentContext& context)
     : LoggableComponentBase(config, context),
       cache::CacheUpdateTrait(config, context),
+      cache_(rcu::ReadMode::kThreadOwned),
       event_channel_(components::GetCurrentComponentName(config)) {
   const auto initial_config = GetConfig();
 }
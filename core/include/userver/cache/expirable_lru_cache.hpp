@@ -40,7 +40,8 @@ class ExpirableLruCache final {
   };
 
   ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
-                    const Equal& equal = Equal());
+                    const Equal& equal = Equal(),
+                    CachePolicy policy = CachePolicy::kLRU);
 
   ~ExpirableLruCache();
 
@@ -135,8 +136,9 @@ class ExpirableLruCache final {
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
-    size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
-    : lru_(ways, way_size, hash, equal),
+    size_t ways, size_t way_size, const Hash& hash, const Equal& equal,
+    CachePolicy policy)
+    : lru_(ways, way_size, hash, equal, policy),
       mutex_set_{ways, way_size, hash, equal} {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
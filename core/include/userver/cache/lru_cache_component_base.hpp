@@ -61,6 +61,7 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
 /// ways | number of ways for associative cache | --
+/// policy | eviction policy of the ways, `lru`, `clock` (lookups do not block each other) or `tinylfu` (frequency based admission, resists scans) | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
@@ -123,7 +124,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(), Hash{},
+                                     Equal{}, static_config_.policy)) {
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
 
@@ -5,6 +5,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include <userver/cache/policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -43,6 +44,7 @@ struct LruCacheConfigStatic final {
 
   LruCacheConfig config;
   std::size_t ways;
+  CachePolicy policy;
   bool use_dynamic_config;
 };
 
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <vector>
 
+#include <userver/cache/impl/clock.hpp>
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +22,8 @@ template <typename T, typename U, typename Hash = std::hash<T>,
 class NWayLRU final {
  public:
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
-          const Equal& equal = Equal());
+          const Equal& equal = Equal(),
+          CachePolicy policy = CachePolicy::kLRU);
 
   void Put(const T& key, U value);
 
@@ -43,6 +49,7 @@ class NWayLRU final {
   void UpdateWaySize(size_t way_size);
 
  private:
+  template <CachePolicy Policy>
   struct Way {
     Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
 
@@ -50,104 +57,186 @@ class NWayLRU final {
     Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
 
     mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    LruMap<T, U, Hash, Equal, Policy> cache;
   };
 
-  Way& GetWay(const T& key);
+  struct ClockWay {
+    ClockWay(ClockWay&& other) noexcept : cache(std::move(other.cache)) {}
 
-  std::vector<Way> caches_;
+    // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
+    ClockWay(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+
+    mutable engine::SharedMutex mutex;
+    impl::ClockBase<T, U, Hash, Equal> cache;
+  };
+
+  template <typename Ways>
+  static auto& GetWay(Ways& ways, size_t hash);
+
+  // Calls `func(cache)` for the LRU or TinyLFU way of the key under the lock
+  template <typename Function>
+  auto WithLockedWay(const T& key, Function func);
+
+  // Calls `func(cache)` for each way of `self` under the exclusive lock
+  template <typename Self, typename Function>
+  static void ForEachWay(Self& self, Function func);
+
+  // Only one of the ways vectors is non-empty, depending on the policy
+  std::vector<Way<CachePolicy::kLRU>> caches_;
+  std::vector<Way<CachePolicy::kTinyLFU>> tinylfu_caches_;
+  std::vector<ClockWay> clock_caches_;
   Hash hash_fn_;
+  const CachePolicy policy_;
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
-                                 const Eq& equal)
-    : caches_(), hash_fn_(hash) {
-  caches_.reserve(ways);
-  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+                                 const Eq& equal, CachePolicy policy)
+    : caches_(), hash_fn_(hash), policy_(policy) {
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
-  for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+  if (policy_ == CachePolicy::kClock) {
+    clock_caches_.reserve(ways);
+    for (size_t i = 0; i < ways; ++i) clock_caches_.emplace_back(hash, equal);
+  } else if (policy_ == CachePolicy::kTinyLFU) {
+    tinylfu_caches_.reserve(ways);
+    for (size_t i = 0; i < ways; ++i) tinylfu_caches_.emplace_back(hash, equal);
+  } else {
+    caches_.reserve(ways);
+    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+  }
+
+  UpdateWaySize(way_size);
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
-  auto& way = GetWay(key);
+  if (policy_ == CachePolicy::kClock) {
+    auto& way = GetWay(clock_caches_, hash_fn_(key));
+    std::unique_lock lock(way.mutex);
+    way.cache.Put(key, std::move(value));
+    return;
+  }
 
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  way.cache.Put(key, std::move(value));
+  WithLockedWay(key,
+                [&](auto& cache) { cache.Put(key, std::move(value)); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
-  auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  auto* value = way.cache.Get(key);
-
-  if (value) {
-    if (validator(*value)) return *value;
-    way.cache.Erase(key);
+  if (policy_ == CachePolicy::kClock) {
+    auto& way = GetWay(clock_caches_, hash_fn_(key));
+    {
+      std::shared_lock lock(way.mutex);
+      const auto* value = way.cache.Get(key);
+      if (!value) return std::nullopt;
+      if (validator(*value)) return *value;
+    }
+
+    std::unique_lock lock(way.mutex);
+    // The value might have been replaced while the lock was released
+    const auto* value = way.cache.Get(key);
+    if (value && !validator(*value)) way.cache.Erase(key);
+    return std::nullopt;
   }
 
-  return std::nullopt;
+  return WithLockedWay(key, [&](auto& cache) -> std::optional<U> {
+    auto* value = cache.Get(key);
+
+    if (value) {
+      if (validator(*value)) return *value;
+      cache.Erase(key);
+    }
+
+    return std::nullopt;
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
-  auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  way.cache.Erase(key);
+  if (policy_ == CachePolicy::kClock) {
+    auto& way = GetWay(clock_caches_, hash_fn_(key));
+    std::unique_lock lock(way.mutex);
+    way.cache.Erase(key);
+    return;
+  }
+
+  WithLockedWay(key, [&](auto& cache) { cache.Erase(key); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
-  auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  if (policy_ == CachePolicy::kClock) {
+    auto& way = GetWay(clock_caches_, hash_fn_(key));
+    std::shared_lock lock(way.mutex);
+    return way.cache.GetOr(key, default_value);
+  }
+
+  return WithLockedWay(
+      key, [&](auto& cache) { return cache.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
-  for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Clear();
-  }
+  ForEachWay(*this, [](auto& cache) { cache.Clear(); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
-  for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.VisitAll(func);
-  }
+  ForEachWay(*this, [&func](const auto& cache) { cache.VisitAll(func); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
-  for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    size += way.cache.GetSize();
-  }
+  ForEachWay(*this,
+             [&size](const auto& cache) { size += cache.GetSize(); });
   return size;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
-  for (auto& way : caches_) {
+  ForEachWay(*this, [way_size](auto& cache) { cache.SetMaxSize(way_size); });
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Ways>
+auto& NWayLRU<T, U, Hash, Eq>::GetWay(Ways& ways, size_t hash) {
+  return ways[hash % ways.size()];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+auto NWayLRU<T, U, Hash, Eq>::WithLockedWay(const T& key, Function func) {
+  if (policy_ == CachePolicy::kTinyLFU) {
+    auto& way = GetWay(tinylfu_caches_, hash_fn_(key));
     std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.SetMaxSize(way_size);
+    return func(way.cache);
   }
+
+  auto& way = GetWay(caches_, hash_fn_(key));
+  std::unique_lock<engine::Mutex> lock(way.mutex);
+  return func(way.cache);
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
-typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
-    const T& key) {
-  auto n = hash_fn_(key) % caches_.size();
-  return caches_[n];
+template <typename Self, typename Function>
+void NWayLRU<T, U, Hash, Eq>::ForEachWay(Self& self, Function func) {
+  for (auto& way : self.caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    func(way.cache);
+  }
+  for (auto& way : self.tinylfu_caches_) {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    func(way.cache);
+  }
+  for (auto& way : self.clock_caches_) {
+    std::unique_lock lock(way.mutex);
+    func(way.cache);
+  }
 }
 
 }  // namespace cache
@@ -7,7 +7,11 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string_view>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -35,12 +39,14 @@ class ThreadPool;
 namespace clients::http {
 namespace impl {
 class EasyWrapper;
+class HedgingBudget;
 }  // namespace impl
 
 struct Config;
 struct TestsuiteConfig;
 struct EnforceTaskDeadlineConfig;
 class Statistics;
+class RequestStats;
 struct PoolStatistics;
 struct InstanceStatistics;
 class DestinationStatistics;
@@ -49,6 +55,19 @@ struct ClientSettings final {
   std::string thread_name_prefix;
   size_t io_threads = 8;
   bool defer_events = false;
+  size_t host_affinity_threads = 2;
+  double hedging_budget_ratio = 0.05;
+};
+
+/// @brief Settings of Client::PerformHedged()
+struct HedgingSettings final {
+  /// Time to wait for a response before starting one more attempt. If not
+  /// set, the 95th percentile of the destination timings for the last minute
+  /// is used; no extra attempts are made until the destination has timings.
+  std::optional<std::chrono::milliseconds> delay;
+
+  /// Max number of attempts, including the first one
+  std::size_t max_attempts{2};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
@@ -76,6 +95,21 @@ class Client final {
   /// Providing CreateNonSignedRequest() function for the clients::Http alias.
   std::shared_ptr<Request> CreateNotSignedRequest() { return CreateRequest(); }
 
+  /// @brief Performs a request created by `factory` and starts one more
+  /// attempt in parallel if there is no response after
+  /// HedgingSettings::delay. The first response wins, the other attempts are
+  /// cancelled. An exception is thrown only if all the attempts fail.
+  ///
+  /// Extra attempts are limited by a budget shared by all the requests of
+  /// the client (`hedging-budget-ratio` of the requests count), so that
+  /// hedging does not amplify an overload of the upstream.
+  ///
+  /// `factory` must return a new request for each call, all the requests
+  /// must be idempotent.
+  std::shared_ptr<Response> PerformHedged(
+      const std::function<std::shared_ptr<Request>()>& factory,
+      const HedgingSettings& settings = {});
+
   /// @cond
   // For internal use only.
   void SetMultiplexingEnabled(bool enabled);
@@ -130,12 +164,16 @@ class Client final {
 
   size_t FindMultiIndex(const curl::multi*) const;
 
+  size_t SelectMultiForHost(std::string_view host, size_t current) const;
+
   // Functions for EasyWrapper that must be noexcept, as they are called from
   // the EasyWrapper destructor.
   friend class impl::EasyWrapper;
   void IncPending() noexcept { ++pending_tasks_; }
   void DecPending() noexcept { --pending_tasks_; }
   void PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept;
+  std::shared_ptr<RequestStats> BindToHost(curl::easy& easy,
+                                           std::string_view host);
 
   std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
 
@@ -146,6 +184,8 @@ class Client final {
   std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
   std::vector<Statistics> statistics_;
   std::vector<std::unique_ptr<curl::multi>> multis_;
+  const size_t host_affinity_threads_;
+  std::unique_ptr<impl::HedgingBudget> hedging_budget_;
 
   static constexpr size_t kIdleQueueSize = 616;
   static constexpr size_t kIdleQueueAlignment = 8;
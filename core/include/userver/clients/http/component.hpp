@@ -39,6 +39,8 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// host-affinity-threads | number of IO threads that requests to the same host are spread over, so that they reuse the warm connections of those threads; 0 picks threads without regard to the host | 2
+/// hedging-budget-ratio | max share of extra attempts started by Client::PerformHedged relative to all the requests; 0 disables hedging | 0.05
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
@@ -236,6 +236,8 @@ class Request final : public std::enable_shared_from_this<Request> {
   std::string ExtractData();
 
  private:
+  friend class Client;
+
   std::shared_ptr<RequestState> pimpl_;
 };
 
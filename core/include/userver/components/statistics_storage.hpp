@@ -3,7 +3,8 @@
 /// @file userver/components/statistics_storage.hpp
 /// @brief @copybrief components::StatisticsStorage
 
-#include <userver/components/loggable_component_base.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/components/impl/component_base.hpp>
 #include <userver/utils/statistics/metrics_storage.hpp>
 #include <userver/utils/statistics/storage.hpp>
 
@@ -23,12 +24,15 @@ namespace components {
 ///
 /// The component does **not** have any options for service config.
 ///
+/// The component does not depend on components::Logging, so that the logging
+/// component could register its own metrics.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp  Sample statistics storage component config
 
 // clang-format on
-class StatisticsStorage final : public LoggableComponentBase {
+class StatisticsStorage final : public impl::ComponentBase {
  public:
   static constexpr auto kName = "statistics-storage";
 
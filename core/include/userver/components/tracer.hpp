@@ -5,6 +5,7 @@
 
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/impl/component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +20,18 @@ namespace components {
 /// Finds the components::Logging component and requests an optional
 /// "opentracing" logger to use for Opentracing.
 ///
+/// If `span-exporter` is configured, the finished spans are kept in a compact
+/// binary form and are exported in batches by a dedicated thread instead.
+/// Spans of the traces that are not sampled are not formatted at all: they
+/// are neither exported nor written to the default logger. With tail sampling
+/// enabled such spans are exported if the trace turns out to be slow or
+/// errored, and are logged as usual.
+///
+/// If components::StatisticsStorage is available, the component reports
+/// the exported, sampled out and dropped spans count, the export requests
+/// count and the failed export requests count in the
+/// `tracing.span-exporter` metrics section.
+///
 /// The component must be configured in service config.
 ///
 /// ## Static options:
@@ -26,6 +39,17 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | -
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// span-exporter | export finished spans in batches of OTLP protobuf instead of logging them to the 'opentracing' logger | -
+/// span-exporter.endpoint | host:port of an OTLP/HTTP collector, exclusive with 'file' | -
+/// span-exporter.file | file to append length-delimited OTLP ExportTraceServiceRequest messages to, exclusive with 'endpoint' | -
+/// span-exporter.sampling-probability | share of the traces to export, the decision is made by trace id | 1.0
+/// span-exporter.tail-sampling.latency-threshold | export the traces that were not sampled if any of their spans took longer | -
+/// span-exporter.tail-sampling.keep-errors | export the traces that were not sampled if any of their spans has the error tag | false
+/// span-exporter.tail-sampling.decision-timeout | time to wait for the local root span of a trace | 30s
+/// span-exporter.tail-sampling.max-traces | max number of traces awaiting the decision | 10000
+/// span-exporter.batch-size | max number of spans in a single export request | 512
+/// span-exporter.flush-interval | max time a span waits for the batch to fill up | 1s
+/// span-exporter.queue-size | max number of spans awaiting export, new spans are dropped on overflow | 65536
 ///
 /// ## Static configuration example:
 ///
@@ -38,7 +62,12 @@ class Tracer final : public impl::ComponentBase {
 
   Tracer(const ComponentConfig& config, const ComponentContext& context);
 
+  ~Tracer() override;
+
   static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  utils::statistics::Entry statistics_holder_;
 };
 
 template <>
@@ -46,6 +46,9 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool dump_is_compressed;
+  std::size_t compression_parallel_frames;
+  bool dump_is_memory_mapped;
 
   bool dumps_enabled;
   std::chrono::milliseconds min_dump_interval;
@@ -84,6 +84,9 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `compressed` | `boolean` | Whether to compress the dump with zlib in parallel frames, can not be used with `encrypted` | `false`
+/// `compression-parallel-frames` | `integer` | How many dump frames are compressed or decompressed at once | `4`
+/// `memory-mapped` | `boolean` | Whether to read the dump through a memory mapping without copying, see dump::MappedFileReader | `false`
 /// `first-update-mode` | `string` | specifies whether required or best-effort first update will be used | skip
 /// `first-update-type` | `string` | specifies whether incremental and/or full first update will be used | full
 ///
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/c_file.hpp>
+#include <userver/utils/cpu_relax.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// Parameters of the compressed dump format
+struct CompressionSettings final {
+  /// Amount of uncompressed data in a single frame
+  std::size_t frame_size{1 << 20};
+  /// Maximum number of frames being compressed or decompressed at once
+  std::size_t max_parallel_frames{4};
+  /// zlib compression level, from 1 (fastest) to 9 (smallest)
+  int level{1};
+};
+
+/// @brief A handle to a compressed dump file. File operations block the thread.
+///
+/// The data is split into frames of `frame_size` bytes, which are compressed
+/// independently by up to `max_parallel_frames` tasks of the current task
+/// processor. Each frame is stored with a CRC32 checksum of its contents.
+class CompressedWriter final : public Writer {
+ public:
+  /// @brief Creates a new dump file and opens it
+  /// @throws `Error` on a filesystem error
+  CompressedWriter(std::string path, boost::filesystem::perms perms,
+                   const CompressionSettings& settings,
+                   tracing::ScopeTime& scope);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+  /// Number of bytes passed to the writer
+  std::uint64_t GetUncompressedSize() const;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  void StartFrameCompression();
+  void WriteCompressedFrame();
+  void WriteToFile(std::string_view data);
+
+  fs::blocking::CFile file_;
+  std::string final_path_;
+  std::string path_;
+  boost::filesystem::perms perms_;
+  const CompressionSettings settings_;
+  std::string frame_;
+  std::deque<engine::TaskWithResult<std::string>> pending_frames_;
+  utils::StreamingCpuRelax cpu_relax_;
+};
+
+/// @brief A handle to a compressed dump file. File operations block the thread.
+///
+/// Up to `max_parallel_frames` frames are read ahead and decompressed by tasks
+/// of the current task processor.
+class CompressedReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file
+  /// @throws `Error` on a filesystem error or if the file is not a compressed
+  /// dump
+  CompressedReader(std::string path, const CompressionSettings& settings);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+  /// Number of bytes returned by the reader
+  std::uint64_t GetUncompressedSize() const;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  bool NextFrame();
+  void StartFramesDecompression();
+  std::size_t ReadFromFile(char* buffer, std::size_t size);
+
+  fs::blocking::CFile file_;
+  std::string path_;
+  const CompressionSettings settings_;
+  std::deque<engine::TaskWithResult<std::string>> pending_frames_;
+  bool is_last_frame_read_{false};
+  std::string frame_;
+  std::size_t frame_offset_{0};
+  std::string chunk_;
+  std::uint64_t uncompressed_size_{0};
+};
+
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  CompressedOperationsFactory(boost::filesystem::perms perms,
+                              const CompressionSettings& settings);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+  const CompressionSettings settings_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
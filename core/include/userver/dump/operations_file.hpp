@@ -29,6 +29,7 @@ class FileWriter final : public Writer {
   void WriteRaw(std::string_view data) override;
 
   fs::blocking::CFile file_;
+  std::string buffer_;
   std::string final_path_;
   std::string path_;
   boost::filesystem::perms perms_;
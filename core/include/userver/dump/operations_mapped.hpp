@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A read-only memory mapping of a whole dump file
+///
+/// Pages are loaded by the kernel on first access.
+class MappedFile final {
+ public:
+  /// @brief Maps the file into memory
+  /// @throws `Error` on a filesystem error
+  explicit MappedFile(const std::string& path);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  /// Contents of the file
+  std::string_view GetData() const;
+
+  /// Hints the kernel that the memory is going to be read sequentially
+  void AdviseSequential() const;
+
+  /// Drops the hint of `AdviseSequential`
+  void AdviseNormal() const;
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{0};
+};
+
+/// @brief A zero-copy reader of a dump file. File operations block the thread.
+///
+/// Unlike other readers, `ReadRaw` returns views into the file mapping that
+/// are not invalidated by the subsequent reads. They stay valid while
+/// the reader or a copy of `GetMapping()` is alive, so `Read` implementations
+/// may keep the results of `ReadStringViewUnsafe` instead of copying them.
+class MappedFileReader final : public Reader {
+ public:
+  /// @brief Maps an existing dump file
+  /// @throws `Error` on a filesystem error
+  explicit MappedFileReader(std::string path);
+
+  void Finish() override;
+
+  /// The mapping that the views returned by the reader point into
+  std::shared_ptr<const MappedFile> GetMapping() const;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string path_;
+  std::shared_ptr<const MappedFile> mapping_;
+  std::string_view unread_;
+};
+
+/// @brief The mapping of the dump file if `reader` is a `MappedFileReader`,
+/// `nullptr` otherwise
+///
+/// Lets `Read` implementations keep the views returned by
+/// `ReadStringViewUnsafe` when `memory-mapped` dumps are enabled, and fall back
+/// to copying otherwise.
+std::shared_ptr<const MappedFile> TryGetMapping(const Reader& reader);
+
+/// Writes dumps with `FileWriter` and reads them with `MappedFileReader`
+class MappedOperationsFactory final : public OperationsFactory {
+ public:
+  explicit MappedOperationsFactory(boost::filesystem::perms perms);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <any>
+#include <chrono>
 #include <cstddef>
 #include <exception>
+#include <memory>
+#include <string>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
@@ -30,12 +33,21 @@ T ParseByConstructor(const DocsMap& docs_map) {
 
 using ConfigId = std::size_t;
 
-ConfigId Register(Factory factory);
+ConfigId Register(Factory factory, std::type_index key_type);
 
 // Automatically registers all used config types at startup and assigns them
 // sequential ids
 template <typename Key>
-inline const ConfigId kConfigId = Register(&FactoryFor<Key>);
+inline const ConfigId kConfigId = Register(&FactoryFor<Key>, typeid(Key));
+
+// Returns the demangled name of the key type, for diagnostics and metrics
+std::string GetKeyName(ConfigId id);
+
+// Returns true if each of the `docs` is the same in both maps. In that case
+// the docs are marked as requested in `docs_map`, as if a config that reads
+// them was parsed from it again
+bool AreDocsUnchanged(const std::vector<std::string>& docs,
+                      const DocsMap& docs_map, const DocsMap& previous_docs_map);
 
 class SnapshotData final {
  public:
@@ -46,6 +58,12 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  /// Parses only the configs that read at least one doc that differs between
+  /// `docs_map` and `previous_docs_map`, other configs are shared with
+  /// `previous`, which must have been built from `previous_docs_map`.
+  SnapshotData(const DocsMap& docs_map, const SnapshotData& previous,
+               const DocsMap& previous_docs_map);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -59,10 +77,35 @@ class SnapshotData final {
     }
   }
 
+  /// Returns true if any of `ids` was (re)assigned while building this
+  /// snapshot from the previous one
+  bool HasUpdates(const std::vector<ConfigId>& ids) const;
+
+  /// Number of configs that were parsed while building this snapshot
+  std::size_t GetParsedCount() const { return parsed_count_; }
+
+  /// Number of configs that were shared with the previous snapshot
+  std::size_t GetReusedCount() const { return reused_count_; }
+
+  /// Returns the duration of the last parse of the config, zero if the config
+  /// is missing or was not produced by parsing
+  std::chrono::microseconds GetParseDuration(ConfigId id) const;
+
+  std::size_t Size() const { return user_configs_.size(); }
+
  private:
+  struct Entry;
+
+  static std::shared_ptr<const Entry> MakeEntry(std::any value);
+
   const std::any& Get(impl::ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  void Parse(ConfigId id, const DocsMap& docs_map);
+
+  std::vector<std::shared_ptr<const Entry>> user_configs_;
+  std::vector<bool> updated_;
+  std::size_t parsed_count_{0};
+  std::size_t reused_count_{0};
 };
 
 struct StorageData;
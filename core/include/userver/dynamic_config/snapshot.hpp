@@ -27,9 +27,10 @@ using VariableOfKey = decltype(Key::Parse(std::declval<const DocsMap&>()));
 
 /// @brief The storage for a snapshot of configs
 ///
-/// When a config update comes in via new `DocsMap`, configs of all
-/// the registered types are constructed and stored in `Config`. After that
-/// the `DocsMap` is dropped.
+/// When a config update comes in via new `DocsMap`, configs of the
+/// registered types that read any of the changed docs are constructed and
+/// stored in `Config`, the rest are shared with the previous snapshot. After
+/// that the `DocsMap` is dropped.
 ///
 /// Config types are automatically registered if they are accessed with `Get`
 /// somewhere in the program.
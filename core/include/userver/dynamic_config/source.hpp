@@ -5,6 +5,7 @@
 
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
@@ -100,6 +101,24 @@ class Source final {
         });
   }
 
+  /// Subscribes to updates of the specified config variables only. Also
+  /// immediately invokes the function with the current config snapshot.
+  /// Updates that do not touch any of `keys` are not delivered to `func`.
+  ///
+  /// @snippet core/src/dynamic_config/config_test.cpp  Sample keyed UpdateAndListen
+  template <typename Class, typename Key, typename... Keys>
+  concurrent::AsyncEventSubscriberScope UpdateAndListen(
+      Class* obj, std::string_view name,
+      void (Class::*func)(const dynamic_config::Snapshot& config), Key key,
+      Keys... keys) {
+    return DoUpdateAndListen(
+        concurrent::FunctionId(obj), name,
+        [obj, func](const dynamic_config::Snapshot& config) {
+          (obj->*func)(config);
+        },
+        {impl::kConfigId<Key>, impl::kConfigId<Keys>...});
+  }
+
   EventSource& GetEventChannel();
 
  private:
@@ -107,6 +126,10 @@ class Source final {
       concurrent::FunctionId id, std::string_view name,
       EventSource::Function&& func);
 
+  concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+      concurrent::FunctionId id, std::string_view name,
+      EventSource::Function&& func, std::vector<impl::ConfigId> ids);
+
   impl::StorageData* storage_;
 };
 
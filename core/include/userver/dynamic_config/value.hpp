@@ -4,6 +4,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/serialize_container.hpp>
 #include <userver/formats/json/value.hpp>
@@ -30,9 +31,22 @@ class DocsMap final {
 
   bool AreContentsEqual(const DocsMap& other) const;
 
+  /* Returns true if the doc `name` is missing from both maps or is the same
+   * in both of them */
+  bool IsDocEqual(const std::string& name, const DocsMap& other) const;
+
+  /* For internal use only. While set, names passed to `Get` are additionally
+   * appended to `*recorder`. Pass `nullptr` to stop recording. */
+  void SetRequestsRecorder(std::vector<std::string>* recorder) const;
+
+  /* For internal use only. Adds `name` to the requested names as if it was
+   * passed to `Get`, for the configs that are not parsed again. */
+  void MarkRequested(const std::string& name) const;
+
  private:
   std::unordered_map<std::string, formats::json::Value> docs_;
   mutable std::unordered_set<std::string> requested_names_;
+  mutable std::vector<std::string>* requests_recorder_{nullptr};
 };
 
 template <typename T>
@@ -9,9 +9,11 @@
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/impl/component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
+#include <userver/formats/json_fwd.hpp>
 #include <userver/os_signals/component.hpp>
 
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include "logger.hpp"
 
@@ -37,10 +39,11 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `raw` or `json` | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
-/// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
-/// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// message_queue_size | the size of a per-thread message queue, must be a power of 2 | 4096
+/// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` spins until message gets into the queue, stalling the thread and all of the tasks running on it | discard
+/// structured_records | capture messages without formatting them, the formatting is done by the logger thread | false
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 ///
 /// ### testsuite-capture options:
@@ -54,6 +57,22 @@ namespace components {
 /// @snippet components/common_component_list_test.cpp Sample logging component config
 ///
 /// `default` section configures the default logger for LOG_*.
+///
+/// Each thread that writes to a file logger gets its own lock-free queue of
+/// `message_queue_size` messages, a dedicated thread per logger drains the
+/// queues to the file. Messages of a single thread keep their order, the
+/// messages drained from several queues at once are ordered by their time.
+///
+/// The logger threads do not write the files themselves: messages are
+/// collected into chunks that are written by a single thread shared by all
+/// of the file loggers, with one `writev` call for all of the pending chunks
+/// of a file. `flush_level` messages and periodic flushes wait for the write,
+/// `SIGUSR1` reopens the files after writing out the collected messages.
+///
+/// If components::StatisticsStorage is available, the component reports
+/// written and dropped messages count, the queueing latency, the written
+/// bytes, write calls count and the write call latency for each file
+/// logger in the `logger` metrics section.
 
 // clang-format on
 
@@ -92,12 +111,15 @@ class Logging final : public impl::ComponentBase {
     return [this] { FlushLogs(); };
   }
   void FlushLogs();
+  formats::json::Value ExtendStatistics(
+      const utils::statistics::StatisticsRequest& /*request*/);
 
   engine::TaskProcessor* fs_task_processor_;
   std::unordered_map<std::string, logging::LoggerPtr> loggers_;
   utils::PeriodicTask flush_task_;
   std::shared_ptr<TestsuiteCaptureSink> socket_sink_;
   os_signals::Subscriber signal_subscriber_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 template <>
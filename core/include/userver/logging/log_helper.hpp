@@ -73,9 +73,11 @@ class LogHelper final {
   /// @brief Constructs LogHelper with span logging
   /// @param logger to log to (logging to nullptr does not output messages)
   /// @param level message log level
-  /// @param path path of the source file that generated the message
+  /// @param path path of the source file that generated the message, must
+  /// outlive the LogHelper
   /// @param line line of the source file that generated the message
-  /// @param func name of the function that generated the message
+  /// @param func name of the function that generated the message, must
+  /// outlive the LogHelper
   /// @param mode logging mode - with or without span
   LogHelper(LoggerPtr logger, Level level, std::string_view path, int line,
             std::string_view func, Mode mode = Mode::kDefault) noexcept;
@@ -165,6 +167,7 @@ class LogHelper final {
   void InternalLoggingError(std::string_view message) noexcept;
 
   void AppendLogExtra();
+  void LogRecord();
   void LogTextKey();
   void LogModule(std::string_view path, int line, std::string_view func);
   void LogIds();
@@ -3,6 +3,7 @@
 /// @file userver/rcu/rcu.hpp
 /// @brief Implementation of hazard pointer
 
+#include <array>
 #include <atomic>
 #include <cstdlib>
 #include <list>
@@ -27,8 +28,44 @@ namespace rcu {
 template <typename T>
 class Variable;
 
+/// @brief Can be passed to `rcu::Variable` to choose how readers protect the
+/// value they read from being freed.
+enum class ReadMode {
+  /// Hazard pointer records are shared by all the threads, each `Read()`
+  /// reserves one with a compare-exchange.
+  kShared,
+  /// Each thread reserves a hazard pointer record per `Variable` once and
+  /// reuses it, so that `Read()` is made of plain loads and stores. Writers
+  /// pay for that with a process-wide memory barrier (`membarrier` on Linux)
+  /// on each commit. Suits the variables that are written rarely and are read
+  /// millions of times per second, like configs and caches.
+  kThreadOwned,
+};
+
 namespace impl {
 
+struct ThreadOwnedTag final {};
+
+/// Makes all of the running threads of the process execute a full memory
+/// barrier
+void AsymmetricThreadFenceHeavy() noexcept;
+
+/// Registers the process for AsymmetricThreadFenceHeavy if the OS supports it
+void InitAsymmetricThreadFence() noexcept;
+
+extern std::atomic<bool> has_asymmetric_thread_fence;
+
+/// Compiler-only barrier for readers of ReadMode::kThreadOwned variables if
+/// the writers are able to issue AsymmetricThreadFenceHeavy, a full memory
+/// barrier otherwise.
+inline void AsymmetricThreadFenceLight() noexcept {
+  if (has_asymmetric_thread_fence.load(std::memory_order_relaxed)) {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+  } else {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
 // Hazard pointer implementation. Pointers form a linked list. \p ptr points
 // to the data they 'hold', next - to the next element in a list.
 // kUsed is a filler value to show that hazard pointer is not free. Please see
@@ -48,12 +85,24 @@ struct HazardPointerRecord final {
 
   explicit HazardPointerRecord(const Variable<T>& owner) : owner(owner) {}
 
+  // Thread-owned records are created claimed by the creating thread, and are
+  // referenced by both the Variable and the thread cache
+  HazardPointerRecord(const Variable<T>& owner, ThreadOwnedTag)
+      : ptr(nullptr), owner(owner), thread_owned(true), claimed(true), refs(2) {}
+
   std::atomic<T*> ptr = kUsed;
   const Variable<T>& owner;
   std::atomic<HazardPointerRecord*> next{nullptr};
 
+  // Only the thread that claimed a thread-owned record may make its ptr
+  // non-null, so it does that without compare-exchange. Any thread may release
+  // it, as ReadablePtr may be moved to another thread.
+  const bool thread_owned{false};
+  std::atomic<bool> claimed{false};
+  std::atomic<std::size_t> refs{1};
+
   // Simple operation that marks this hazard pointer as no longer used.
-  void Release() { ptr = nullptr; }
+  void Release() { ptr.store(nullptr, std::memory_order_release); }
 };
 
 template <typename T>
@@ -67,6 +116,57 @@ struct CachedData {
 template <typename T>
 thread_local CachedData<T> cache;
 
+// Thread-owned records of the ReadMode::kThreadOwned variables that were read
+// by the current thread. Records are given back on eviction and thread exit,
+// so that new threads reuse them.
+template <typename T>
+class ThreadOwnedRecords final {
+ public:
+  ThreadOwnedRecords() = default;
+  ThreadOwnedRecords(const ThreadOwnedRecords&) = delete;
+  ThreadOwnedRecords& operator=(const ThreadOwnedRecords&) = delete;
+
+  ~ThreadOwnedRecords() {
+    for (auto& entry : entries_) Unclaim(entry.hp);
+  }
+
+  HazardPointerRecord<T>* Find(const Variable<T>* variable,
+                               uint64_t variable_epoch) const noexcept {
+    for (const auto& entry : entries_) {
+      if (entry.variable == variable &&
+          entry.variable_epoch == variable_epoch) {
+        return entry.hp;
+      }
+    }
+    return nullptr;
+  }
+
+  void Add(const Variable<T>* variable, uint64_t variable_epoch,
+           HazardPointerRecord<T>* hp) noexcept {
+    auto& entry = entries_[next_evicted_++ % entries_.size()];
+    Unclaim(entry.hp);
+    entry = {hp, variable, variable_epoch};
+  }
+
+ private:
+  static void Unclaim(HazardPointerRecord<T>* hp) noexcept {
+    if (!hp) return;
+    hp->claimed.store(false, std::memory_order_release);
+    if (hp->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete hp;
+  }
+
+  std::array<CachedData<T>, 8> entries_{};
+  std::size_t next_evicted_{0};
+};
+
+// Not a thread_local variable template, as GCC does not run destructors for
+// them
+template <typename T>
+ThreadOwnedRecords<T>& GetThreadOwnedRecords() noexcept {
+  thread_local ThreadOwnedRecords<T> records;
+  return records;
+}
+
 uint64_t GetNextEpoch() noexcept;
 
 }  // namespace impl
@@ -81,6 +181,17 @@ class USERVER_NODISCARD ReadablePtr final {
  public:
   explicit ReadablePtr(const Variable<T>& ptr)
       : hp_record_(&ptr.MakeHazardPointer()) {
+    if (hp_record_->thread_owned) {
+      // Same as below, but the writer is responsible for making our store
+      // visible before it looks at the hazard pointers
+      do {
+        t_ptr_ = ptr.GetCurrent(std::memory_order_acquire);
+        hp_record_->ptr.store(t_ptr_, std::memory_order_relaxed);
+        impl::AsymmetricThreadFenceLight();
+      } while (t_ptr_ != ptr.GetCurrent(std::memory_order_acquire));
+      return;
+    }
+
     // This cycle guarantees that at the end of it both t_ptr_ and
     // hp_record_->ptr will both be set to
     // 1. something meaningful
@@ -271,6 +382,16 @@ class USERVER_NODISCARD WritablePtr final {
 /// whether old values should be destroyed asynchronously.
 enum class DestructionType { kSync, kAsync };
 
+namespace impl {
+
+template <typename T>
+inline constexpr DestructionType kDefaultDestructionType =
+    (std::is_trivially_destructible_v<T> || std::is_same_v<T, std::string>)
+        ? DestructionType::kSync
+        : DestructionType::kAsync;
+
+}  // namespace impl
+
 /// @ingroup userver_concurrency userver_containers
 ///
 /// @brief Read-Copy-Update variable
@@ -290,6 +411,10 @@ enum class DestructionType { kSync, kAsync };
 ///
 /// @note There is no way to create a "null" `Variable`.
 ///
+/// By default readers reserve a shared hazard pointer with a compare-exchange.
+/// Pass rcu::ReadMode::kThreadOwned to the constructor to make reads free of
+/// read-modify-write operations at the cost of slower writes.
+///
 /// ## Example usage:
 ///
 /// @snippet rcu/rcu_test.cpp  Sample rcu::Variable usage
@@ -304,10 +429,8 @@ class Variable final {
   /// initial value
   template <typename... Args>
   Variable(Args&&... initial_value_args)
-      : destruction_type_((std::is_trivially_destructible_v<T> ||
-                           std::is_same_v<T, std::string>)
-                              ? DestructionType::kSync
-                              : DestructionType::kAsync),
+      : destruction_type_(impl::kDefaultDestructionType<T>),
+        read_mode_(ReadMode::kShared),
         epoch_(impl::GetNextEpoch()),
         current_(new T(std::forward<Args>(initial_value_args)...)) {}
 
@@ -319,9 +442,37 @@ class Variable final {
   template <typename... Args>
   Variable(DestructionType destruction_type, Args&&... initial_value_args)
       : destruction_type_(destruction_type),
+        read_mode_(ReadMode::kShared),
         epoch_(impl::GetNextEpoch()),
         current_(new T(std::forward<Args>(initial_value_args)...)) {}
 
+  /// Create a new `Variable` with an in-place constructed initial value.
+  /// @param read_mode controls how readers protect the values
+  /// @param initial_value_args arguments passed to the constructor of the
+  /// initial value
+  template <typename... Args>
+  Variable(ReadMode read_mode, Args&&... initial_value_args)
+      : Variable(impl::kDefaultDestructionType<T>, read_mode,
+                 std::forward<Args>(initial_value_args)...) {}
+
+  /// Create a new `Variable` with an in-place constructed initial value.
+  /// @param destruction_type controls whether destruction of old values should
+  /// be performed asynchronously
+  /// @param read_mode controls how readers protect the values
+  /// @param initial_value_args arguments passed to the constructor of the
+  /// initial value
+  template <typename... Args>
+  Variable(DestructionType destruction_type, ReadMode read_mode,
+           Args&&... initial_value_args)
+      : destruction_type_(destruction_type),
+        read_mode_(read_mode),
+        epoch_(impl::GetNextEpoch()),
+        current_(new T(std::forward<Args>(initial_value_args)...)) {
+    if (read_mode_ == ReadMode::kThreadOwned) {
+      impl::InitAsymmetricThreadFence();
+    }
+  }
+
   Variable(const Variable&) = delete;
   Variable(Variable&&) = delete;
   Variable& operator=(const Variable&) = delete;
@@ -335,7 +486,8 @@ class Variable final {
       auto* next = hp->next.load();
       UASSERT_MSG(hp->ptr == nullptr,
                   "RCU variable is destroyed while being used");
-      delete hp;
+      // Thread-owned records may still be referenced by thread caches
+      if (!hp->thread_owned || hp->refs.fetch_sub(1) == 1) delete hp;
       hp = next;
     }
 
@@ -389,7 +541,9 @@ class Variable final {
   }
 
  private:
-  T* GetCurrent() const { return current_.load(); }
+  T* GetCurrent(std::memory_order order = std::memory_order_seq_cst) const {
+    return current_.load(order);
+  }
 
   impl::HazardPointerRecord<T>* MakeHazardPointerCached() const {
     auto& cache = impl::cache<T>;
@@ -412,7 +566,7 @@ class Variable final {
     auto* hp = hp_record_head_.load();
     while (hp) {
       T* t_ptr = nullptr;
-      if (hp->ptr.load() == nullptr &&
+      if (!hp->thread_owned && hp->ptr.load() == nullptr &&
           hp->ptr.compare_exchange_strong(
               t_ptr, impl::HazardPointerRecord<T>::kUsed)) {
         return hp;
@@ -423,7 +577,39 @@ class Variable final {
     return nullptr;
   }
 
+  impl::HazardPointerRecord<T>* MakeHazardPointerThreadOwned() const {
+    auto& records = impl::GetThreadOwnedRecords<T>();
+    auto* hp = records.Find(this, epoch_);
+    if (!hp) {
+      hp = ClaimThreadOwnedRecord();
+      records.Add(this, epoch_, hp);
+    }
+    // Still used by another ReadablePtr created by this thread
+    if (hp->ptr.load(std::memory_order_acquire) != nullptr) return nullptr;
+    return hp;
+  }
+
+  impl::HazardPointerRecord<T>* ClaimThreadOwnedRecord() const {
+    // Reuse a record given back by another thread, if any
+    for (auto* hp = hp_record_head_.load(); hp; hp = hp->next) {
+      bool claimed = false;
+      if (hp->thread_owned && !hp->claimed.load() &&
+          hp->claimed.compare_exchange_strong(claimed, true)) {
+        hp->refs.fetch_add(1);
+        return hp;
+      }
+    }
+
+    auto* hp = new impl::HazardPointerRecord<T>(*this, impl::ThreadOwnedTag{});
+    AddHazardPointer(hp);
+    return hp;
+  }
+
   impl::HazardPointerRecord<T>& MakeHazardPointer() const {
+    if (read_mode_ == ReadMode::kThreadOwned) {
+      if (auto* hp = MakeHazardPointerThreadOwned()) return *hp;
+    }
+
     auto* hp = MakeHazardPointerCached();
     if (!hp) {
       hp = MakeHazardPointerFast();
@@ -442,17 +628,26 @@ class Variable final {
   impl::HazardPointerRecord<T>* MakeHazardPointerSlow() const {
     // allocate new pointer, and add it to the list (atomically)
     auto hp = new impl::HazardPointerRecord<T>(*this);
+    AddHazardPointer(hp);
+    return hp;
+  }
+
+  void AddHazardPointer(impl::HazardPointerRecord<T>* hp) const {
     impl::HazardPointerRecord<T>* old_hp = nullptr;
     do {
       old_hp = hp_record_head_.load();
       hp->next = old_hp;
     } while (!hp_record_head_.compare_exchange_strong(old_hp, hp));
-    return hp;
   }
 
   void Retire(std::unique_ptr<T> old_ptr,
               std::unique_lock<engine::Mutex>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if (read_mode_ == ReadMode::kThreadOwned) {
+      // Pairs with AsymmetricThreadFenceLight in readers. Afterwards readers
+      // either see the new current_, or we see their hazard pointers.
+      impl::AsymmetricThreadFenceHeavy();
+    }
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
@@ -510,6 +705,7 @@ class Variable final {
   }
 
   const DestructionType destruction_type_;
+  const ReadMode read_mode_;
   const uint64_t epoch_;
 
   mutable std::atomic<impl::HazardPointerRecord<T>*> hp_record_head_{{nullptr}};
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -12,6 +13,7 @@
 #include <userver/server/http/form_data_arg.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_response.hpp>
+#include <userver/utils/impl/monotonic_arena.hpp>
 #include <userver/utils/impl/projecting_view.hpp>
 #include <userver/utils/str_icase.hpp>
 
@@ -22,6 +24,21 @@ namespace server::http {
 
 class HttpRequestImpl;
 
+namespace impl {
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+using ArenaMap =
+    std::unordered_map<Key, Value, Hash, Equal,
+                       utils::impl::ArenaAllocator<std::pair<const Key, Value>>>;
+
+// Names are stored in the request arena
+using RequestHeadersMap = ArenaMap<std::string_view, std::string,
+                                   utils::StrIcaseHash, utils::StrIcaseEqual>;
+using RequestCookiesMap = ArenaMap<std::string_view, std::string>;
+
+}  // namespace impl
+
 /// @brief HTTP Request data
 class HttpRequest final {
  public:
@@ -29,11 +46,13 @@ class HttpRequest final {
       std::unordered_map<std::string, std::string, utils::StrIcaseHash,
                          utils::StrIcaseEqual>;
 
-  using HeadersMapKeys = decltype(utils::impl::MakeKeysView(HeadersMap()));
+  using HeadersMapKeys =
+      decltype(utils::impl::MakeKeysView(impl::RequestHeadersMap()));
 
   using CookiesMap = std::unordered_map<std::string, std::string>;
 
-  using CookiesMapKeys = decltype(utils::impl::MakeKeysView(CookiesMap()));
+  using CookiesMapKeys =
+      decltype(utils::impl::MakeKeysView(impl::RequestCookiesMap()));
 
   /// @cond
   explicit HttpRequest(HttpRequestImpl& impl);
@@ -74,18 +93,18 @@ class HttpRequest final {
   /// @return First argument value with name arg_name or an empty string if no
   /// such argument. Arguments are extracted from query part of the URL and from
   /// the HTTP body.
-  const std::string& GetArg(const std::string& arg_name) const;
+  const std::string& GetArg(std::string_view arg_name) const;
 
   /// @return Argument values with name arg_name or an empty string if no
   /// such argument. Arguments are extracted from query part of the URL and from
   /// the HTTP body.
   const std::vector<std::string>& GetArgVector(
-      const std::string& arg_name) const;
+      std::string_view arg_name) const;
 
   /// @return true if argument with name arg_name exists, false otherwise.
   /// Arguments are extracted from query part of the URL and from
   /// the HTTP body.
-  bool HasArg(const std::string& arg_name) const;
+  bool HasArg(std::string_view arg_name) const;
 
   /// @return Count of arguments. Arguments are extracted from query part of the
   /// URL and from the HTTP body.
@@ -115,14 +134,14 @@ class HttpRequest final {
   std::vector<std::string> FormDataArgNames() const;
 
   /// @return Named argument from URL path with wildcards.
-  const std::string& GetPathArg(const std::string& arg_name) const;
+  const std::string& GetPathArg(std::string_view arg_name) const;
 
   /// @return Argument from URL path with wildcards by its 0-based index
   const std::string& GetPathArg(size_t index) const;
 
   /// @return true if named argument from URL path with wildcards exists, false
   /// otherwise.
-  bool HasPathArg(const std::string& arg_name) const;
+  bool HasPathArg(std::string_view arg_name) const;
 
   /// @return true if argument with index from URL path with wildcards exists,
   /// false otherwise.
@@ -133,11 +152,11 @@ class HttpRequest final {
 
   /// @return Value of the header with case insensitive name header_name, or an
   /// empty string if no such header.
-  const std::string& GetHeader(const std::string& header_name) const;
+  const std::string& GetHeader(std::string_view header_name) const;
 
   /// @return true if header with case insensitive name header_name exists,
   /// false otherwise.
-  bool HasHeader(const std::string& header_name) const;
+  bool HasHeader(std::string_view header_name) const;
 
   /// @return Number of headers.
   size_t HeaderCount() const;
@@ -147,11 +166,11 @@ class HttpRequest final {
 
   /// @return Value of the cookie with case sensitive name cookie_name, or an
   /// empty string if no such cookie exists.
-  const std::string& GetCookie(const std::string& cookie_name) const;
+  const std::string& GetCookie(std::string_view cookie_name) const;
 
   /// @return true if cookie with case sensitive name cookie_name exists, false
   /// otherwise.
-  bool HasCookie(const std::string& cookie_name) const;
+  bool HasCookie(std::string_view cookie_name) const;
 
   /// @return Number of cookies.
   size_t CookieCount() const;
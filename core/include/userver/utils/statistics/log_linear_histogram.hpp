@@ -0,0 +1,247 @@
+#pragma once
+
+/// @file userver/utils/statistics/log_linear_histogram.hpp
+/// @brief @copybrief utils::statistics::LogLinearHistogram
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+/// Per-thread index assigned in order of the first call, used to spread
+/// the writes of different threads over different shards
+std::size_t GetThreadShardIndex() noexcept;
+
+/// Number of shards of a histogram, the number of hardware threads
+std::size_t GetShardCount() noexcept;
+
+}  // namespace impl
+
+/** @brief Compact histogram with logarithmic buckets that allows calculation
+ * of percentiles, a drop-in replacement for utils::statistics::Percentile.
+ *
+ * Values in [0; 2^PrecisionBits) are stored precisely. Each next power of two
+ * range [2^N; 2^(N+1)) is split into 2^PrecisionBits equal buckets, so
+ * the relative error of a percentile never exceeds 1/2^PrecisionBits. Values
+ * starting from 2^MaxValueBits are accounted in the last bucket.
+ *
+ * Writes from different threads go to different cache-line aligned shards
+ * that are merged on read. There is a shard per hardware thread, so the task
+ * processor threads do not share them unless there are more threads than
+ * cores. Shards are allocated on the first write into them, so a histogram
+ * that is never written to takes just a pointer per hardware thread.
+ *
+ * @tparam PrecisionBits log2 of the number of buckets per power of two
+ * @tparam MaxValueBits log2 of the max precisely accounted value
+ *
+ * Example:
+ * Account milliseconds up to ~65 seconds with 3% precision:
+ *
+ * @code
+ * using Histogram = utils::statistics::LogLinearHistogram<5, 16>;
+ *
+ * void Account(Histogram& hist, std::chrono::milliseconds ms) {
+ *   hist.Account(ms.count());
+ * }
+ * @endcode
+ */
+template <std::size_t PrecisionBits = 5, std::size_t MaxValueBits = 16>
+class LogLinearHistogram final {
+  static_assert(PrecisionBits > 0 && PrecisionBits < MaxValueBits &&
+                MaxValueBits < 64);
+
+ public:
+  using Counter = std::uint32_t;
+
+  static constexpr std::size_t kSubBuckets = std::size_t{1} << PrecisionBits;
+  static constexpr std::size_t kBuckets =
+      kSubBuckets * (MaxValueBits - PrecisionBits + 1);
+
+  LogLinearHistogram()
+      : shard_count_(impl::GetShardCount()),
+        shards_(std::make_unique<std::atomic<Shard*>[]>(shard_count_)) {}
+
+  LogLinearHistogram(const LogLinearHistogram& other) : LogLinearHistogram() {
+    Add(other);
+  }
+
+  // Leaves `other` empty but usable, so it allocates new shard pointers
+  LogLinearHistogram(LogLinearHistogram&& other) : LogLinearHistogram() {
+    std::swap(shards_, other.shards_);
+  }
+
+  LogLinearHistogram& operator=(const LogLinearHistogram& rhs) {
+    if (this == &rhs) return *this;
+
+    Reset();
+    Add(rhs);
+    return *this;
+  }
+
+  LogLinearHistogram& operator=(LogLinearHistogram&& rhs) noexcept {
+    if (this == &rhs) return *this;
+
+    std::swap(shards_, rhs.shards_);
+    rhs.Reset();
+    return *this;
+  }
+
+  ~LogLinearHistogram() {
+    if (!shards_) return;
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+      delete shards_[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  /// @brief Account for another value. The value is silently dropped if
+  /// the memory for the shard could not be allocated.
+  void Account(std::size_t value) noexcept {
+    auto* shard =
+        GetOrCreateShard(impl::GetThreadShardIndex() % shard_count_);
+    if (!shard) return;
+    shard->counters[ValueToBucket(value)].fetch_add(1,
+                                                    std::memory_order_relaxed);
+  }
+
+  /** \brief Get X percentile - min value P so that total number of elements
+   * in buckets up to the bucket of P is no less than X percent
+   * @param percent - value in [0..100] - requested percentile
+   *                  if outside of 100, then returns the lower bound of
+   *                  the last bucket that has any element in it.
+   *
+   * Returns the lower bound of the bucket, so the result is biased low by up
+   * to 1/2^PrecisionBits of the value (3% with the default precision)
+   * compared with utils::statistics::Percentile.
+   */
+  std::size_t GetPercentile(double percent) const {
+    const auto counters = Merge();
+
+    std::uint64_t count = 0;
+    for (const auto value : counters) count += value;
+    if (count == 0) return 0;
+
+    std::uint64_t sum = 0;
+    const auto want_sum = static_cast<std::uint64_t>(count * percent);
+    std::size_t max_value = 0;
+    for (std::size_t i = 0; i < counters.size(); i++) {
+      sum += counters[i];
+      if (sum * 100 > want_sum) return BucketToValue(i);
+
+      if (counters[i]) max_value = BucketToValue(i);
+    }
+    return max_value;
+  }
+
+  template <class Duration = std::chrono::seconds>
+  void Add(const LogLinearHistogram& other,
+           [[maybe_unused]] Duration this_epoch_duration = Duration(),
+           [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    // Sums go to a single shard, merged histograms are rarely written to
+    Shard* target = nullptr;
+    for (std::size_t shard = 0; shard < other.shard_count_; ++shard) {
+      const auto* source =
+          other.shards_[shard].load(std::memory_order_acquire);
+      if (!source) continue;
+
+      if (!target) {
+        target = GetOrCreateShard(0);
+        if (!target) throw std::bad_alloc();
+      }
+      for (std::size_t i = 0; i < kBuckets; ++i) {
+        const auto value = source->counters[i].load(std::memory_order_relaxed);
+        if (value) {
+          target->counters[i].fetch_add(value, std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+  /// Zeroes the counters, keeps the allocated shards
+  void Reset() noexcept {
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+      auto* ptr = shards_[shard].load(std::memory_order_acquire);
+      if (ptr) ptr->Reset();
+    }
+  }
+
+  /** \brief Total number of elements
+   */
+  std::uint64_t Count() const {
+    std::uint64_t count = 0;
+    for (const auto value : Merge()) count += value;
+    return count;
+  }
+
+  static constexpr std::size_t ValueToBucket(std::size_t value) noexcept {
+    if (value < kSubBuckets) return value;
+    if (value >> MaxValueBits) return kBuckets - 1;
+
+    const std::size_t exponent =
+        63 - __builtin_clzll(static_cast<unsigned long long>(value));
+    const std::size_t shift = exponent - PrecisionBits;
+    return (shift + 1) * kSubBuckets + (value >> shift) - kSubBuckets;
+  }
+
+  /// Lower bound of the values accounted in the bucket
+  static constexpr std::size_t BucketToValue(std::size_t bucket) noexcept {
+    if (bucket < kSubBuckets) return bucket;
+
+    const std::size_t shift = bucket / kSubBuckets - 1;
+    return (bucket % kSubBuckets + kSubBuckets) << shift;
+  }
+
+ private:
+  // Aligned to avoid false sharing between shards
+  struct alignas(64) Shard {
+    Shard() noexcept { Reset(); }
+
+    void Reset() noexcept {
+      for (auto& value : counters) value.store(0, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<Counter>, kBuckets> counters;
+  };
+
+  Shard* GetOrCreateShard(std::size_t index) noexcept {
+    auto& slot = shards_[index];
+    auto* shard = slot.load(std::memory_order_acquire);
+    if (shard) return shard;
+
+    auto* new_shard = new (std::nothrow) Shard();
+    if (!new_shard) return nullptr;
+    if (slot.compare_exchange_strong(shard, new_shard,
+                                     std::memory_order_acq_rel)) {
+      return new_shard;
+    }
+    delete new_shard;
+    return shard;
+  }
+
+  std::array<std::uint64_t, kBuckets> Merge() const noexcept {
+    std::array<std::uint64_t, kBuckets> result{};
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+      const auto* ptr = shards_[shard].load(std::memory_order_acquire);
+      if (!ptr) continue;
+      for (std::size_t i = 0; i < kBuckets; ++i) {
+        result[i] += ptr->counters[i].load(std::memory_order_relaxed);
+      }
+    }
+    return result;
+  }
+
+  const std::size_t shard_count_;
+  std::unique_ptr<std::atomic<Shard*>[]> shards_;
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
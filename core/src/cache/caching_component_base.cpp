@@ -89,6 +89,18 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump with zlib in parallel frames
+                defaultDescription: false
+            compression-parallel-frames:
+                type: integer
+                description: How many dump frames are compressed or decompressed at once
+                defaultDescription: 4
+            memory-mapped:
+                type: boolean
+                description: Whether to read the dump through a memory mapping without copying
+                defaultDescription: false
             first-update-mode:
                 type: string
                 description: specifies whether required or best-effort first update will be used
@@ -21,6 +21,12 @@ constexpr const char* kStatisticsNameHitRatio = "hit_ratio";
 constexpr const char* kStatisticsNameCurrentDocumentsCount =
     "current-documents-count";
 
+double HitRatio(const ExpirableLruCacheStatisticsBase& stats) {
+  const auto hits = stats.hits.load();
+  const auto total = hits + stats.misses.load();
+  return static_cast<double>(hits) / static_cast<double>(total ? total : 1);
+}
+
 }  // namespace
 
 formats::json::Value GetCacheStatisticsAsJson(
@@ -34,11 +40,9 @@ formats::json::Value GetCacheStatisticsAsJson(
   builder[kStatisticsNameStale] = stats.total.stale.load();
   builder[kStatisticsNameBackground] = stats.total.background_updates.load();
 
-  auto s1min = stats.recent.GetStatsForPeriod();
-  double s1min_hits = s1min.hits.load();
-  auto s1min_total = s1min.hits.load() + s1min.misses.load();
   builder[kStatisticsNameHitRatio]["1min"] =
-      s1min_hits / static_cast<double>(s1min_total ? s1min_total : 1);
+      HitRatio(stats.recent.GetStatsForPeriod());
+  builder[kStatisticsNameHitRatio]["total"] = HitRatio(stats.total);
   return builder.ExtractValue();
 }
 
@@ -70,6 +74,14 @@ properties:
     ways:
         type: integer
         description: number of ways for associative cache
+    policy:
+        type: string
+        description: eviction policy of the ways
+        defaultDescription: lru
+        enum:
+          - lru
+          - clock
+          - tinylfu
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -6,6 +6,7 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +15,7 @@ namespace cache {
 namespace {
 
 constexpr std::string_view kWays = "ways";
+constexpr std::string_view kPolicy = "policy";
 constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
@@ -23,6 +25,16 @@ constexpr std::string_view kLifetimeMs = "lifetime-ms";
 
 using dump::impl::ParseMs;
 
+CachePolicy Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<CachePolicy>) {
+  const auto policy_name = value.As<std::string>();
+  if (policy_name == "lru") return CachePolicy::kLRU;
+  if (policy_name == "clock") return CachePolicy::kClock;
+  if (policy_name == "tinylfu") return CachePolicy::kTinyLFU;
+  throw std::runtime_error("Unknown cache policy '" + policy_name +
+                           "' (must be one of 'lru', 'clock', 'tinylfu')");
+}
+
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
@@ -58,6 +70,7 @@ LruCacheConfigStatic::LruCacheConfigStatic(
     const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLRU)),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
   if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
 }
@@ -44,6 +44,46 @@ UTEST(NWayLRU, GetExpired) {
   EXPECT_EQ(0, cache.GetSize());
 }
 
+UTEST(NWayLRU, ClockPolicy) {
+  Cache cache(1, 2, {}, {}, cache::CachePolicy::kClock);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  EXPECT_EQ(2, cache.GetSize());
+
+  EXPECT_EQ(1, cache.Get(1));
+  cache.Put(3, 3);
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_FALSE(cache.Get(2).has_value());
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+
+  cache.InvalidateByKey(3);
+  EXPECT_EQ(0, cache.GetSize());
+  EXPECT_EQ(-1, cache.GetOr(3, -1));
+}
+
+UTEST(NWayLRU, TinyLfuPolicy) {
+  Cache cache(2, 50, {}, {}, cache::CachePolicy::kTinyLFU);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+  EXPECT_LE(cache.GetSize(), 100);
+
+  cache.Put(1, 10);
+  EXPECT_EQ(10, cache.Get(1));
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(-1, cache.GetOr(1, -1));
+
+  cache.InvalidateByKey(2);
+  EXPECT_FALSE(cache.Get(2).has_value());
+
+  cache.UpdateWaySize(1);
+  EXPECT_LE(cache.GetSize(), 2);
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
 UTEST(NWayLRU, SetMultipleWays) {
   Cache cache(2, 1);
   cache.Put(1, 1);
@@ -2,10 +2,13 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <limits>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/rand.hpp>
@@ -15,6 +18,8 @@
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/enforce_task_deadline_config.hpp>
+#include <clients/http/hedging_budget.hpp>
+#include <clients/http/request_state.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/openssl.hpp>
@@ -30,6 +35,9 @@ namespace {
 const std::string kIoThreadName = "curl";
 const auto kEasyReinitPeriod = std::chrono::minutes{1};
 
+// Percentile of the destination timings used as a default hedging delay
+constexpr double kHedgingDelayPercentile = 95;
+
 // cURL accepts options as long, but we use size_t to avoid writing checks.
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
 long ClampToLong(size_t value) {
@@ -45,6 +53,10 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(settings.thread_name_prefix);
   settings.io_threads = value["threads"].As<size_t>(settings.io_threads);
   settings.defer_events = value["defer-events"].As<bool>(settings.defer_events);
+  settings.host_affinity_threads = value["host-affinity-threads"].As<size_t>(
+      settings.host_affinity_threads);
+  settings.hedging_budget_ratio = value["hedging-budget-ratio"].As<double>(
+      settings.hedging_budget_ratio);
 
   return settings;
 }
@@ -53,6 +65,9 @@ Client::Client(ClientSettings settings,
                engine::TaskProcessor& fs_task_processor)
     : destination_statistics_(std::make_shared<DestinationStatistics>()),
       statistics_(settings.io_threads),
+      host_affinity_threads_(settings.host_affinity_threads),
+      hedging_budget_(std::make_unique<impl::HedgingBudget>(
+          settings.hedging_budget_ratio)),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()) {
@@ -116,6 +131,7 @@ Client::~Client() {
 
 std::shared_ptr<Request> Client::CreateRequest() {
   std::shared_ptr<Request> request;
+  hedging_budget_->AccountRequest();
 
   auto easy = TryDequeueIdle();
   if (easy) {
@@ -163,6 +179,72 @@ std::shared_ptr<Request> Client::CreateRequest() {
   return request;
 }
 
+std::shared_ptr<Response> Client::PerformHedged(
+    const std::function<std::shared_ptr<Request>()>& factory,
+    const HedgingSettings& settings) {
+  UASSERT(settings.max_attempts > 0);
+
+  // attempts in flight, futures are kept separately for engine::WaitAny
+  std::vector<ResponseFuture> futures;
+  std::vector<std::shared_ptr<RequestState>> states;
+  futures.reserve(settings.max_attempts);
+  states.reserve(settings.max_attempts);
+
+  auto request = factory();
+  const auto primary = request->pimpl_;
+  futures.push_back(request->async_perform());
+  states.push_back(primary);
+  std::size_t attempts = 1;
+
+  auto delay = settings.delay;
+  if (!delay) {
+    delay = primary->GetDestinationTimingPercentile(kHedgingDelayPercentile);
+  }
+
+  std::exception_ptr last_exception;
+  while (!futures.empty()) {
+    const bool may_hedge = delay && attempts < settings.max_attempts;
+    const auto deadline = may_hedge ? engine::Deadline::FromDuration(*delay)
+                                    : engine::Deadline{};
+
+    const auto ready = engine::WaitAnyUntil(deadline, futures);
+    if (!ready) {
+      if (engine::current_task::ShouldCancel()) {
+        throw CancelException(
+            "HTTP response wait was aborted due to task cancellation", {});
+      }
+
+      if (!hedging_budget_->TryStartHedge()) {
+        // wait for the attempts in flight without a deadline
+        delay.reset();
+        continue;
+      }
+
+      auto hedge = factory();
+      futures.push_back(hedge->async_perform());
+      // the destination statistics are bound when the request is started
+      hedge->pimpl_->AccountHedge();
+      states.push_back(hedge->pimpl_);
+      ++attempts;
+      continue;
+    }
+
+    try {
+      auto response = futures[*ready].Get();
+      if (states[*ready] != primary) states[*ready]->AccountHedgeWin();
+      return response;
+    } catch (const BaseException&) {
+      if (engine::current_task::ShouldCancel()) throw;
+      last_exception = std::current_exception();
+    }
+
+    futures.erase(futures.begin() + *ready);
+    states.erase(states.begin() + *ready);
+  }
+
+  std::rethrow_exception(last_exception);
+}
+
 void Client::SetMultiplexingEnabled(bool enabled) {
   for (auto& multi : multis_) {
     multi->SetMultiplexingEnabled(enabled);
@@ -211,6 +293,30 @@ size_t Client::FindMultiIndex(const curl::multi* multi) const {
   throw std::logic_error("Unknown multi");
 }
 
+size_t Client::SelectMultiForHost(std::string_view host, size_t current) const {
+  // Requests to the same host go to a small fixed group of multis, so that
+  // they find warm connections in the connection caches of those multis.
+  // The least loaded multi of the group is chosen to spread the load.
+  const auto size = multis_.size();
+  const auto group_size = std::min(host_affinity_threads_, size);
+  const auto first = std::hash<std::string_view>{}(host) % size;
+
+  auto result = first;
+  auto result_load = std::numeric_limits<std::uint64_t>::max();
+  for (size_t i = 0; i < group_size; ++i) {
+    const auto idx = (first + i) % size;
+    auto load = statistics_[idx].GetPendingRequests();
+    // do not account the request that is being bound
+    if (idx == current && load > 0) --load;
+
+    if (load < result_load) {
+      result = idx;
+      result_load = load;
+    }
+  }
+  return result;
+}
+
 PoolStatistics Client::GetPoolStatistics() const {
   PoolStatistics stats;
   stats.multi.reserve(multis_.size());
@@ -239,6 +345,20 @@ void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   DecPending();
 }
 
+std::shared_ptr<RequestStats> Client::BindToHost(curl::easy& easy,
+                                                 std::string_view host) {
+  if (host_affinity_threads_ == 0 || multis_.size() == 1 || host.empty()) {
+    return {};
+  }
+
+  const auto current = FindMultiIndex(easy.GetMulti());
+  const auto idx = SelectMultiForHost(host, current);
+  if (idx == current) return {};
+
+  easy.SetMulti(*multis_[idx]);
+  return statistics_[idx].CreateRequestStats();
+}
+
 std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
   std::shared_ptr<curl::easy> result;
   if (!idle_queue_->try_dequeue(result)) {
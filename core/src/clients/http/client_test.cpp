@@ -6,6 +6,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
 
+#include <clients/http/destination_statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor.hpp>
@@ -1448,4 +1449,73 @@ UTEST(HttpClient, CheckSchema) {
                 clients::http::BadArgumentException);
 }
 
+namespace {
+
+clients::http::InstanceStatistics GetSingleDestinationStatistics(
+    const clients::http::Client& client) {
+  const auto& dest_stats = client.GetDestinationStatistics();
+  const auto it = dest_stats.begin();
+  EXPECT_NE(it, dest_stats.end());
+  return clients::http::InstanceStatistics(*it->second);
+}
+
+}  // namespace
+
+UTEST(HttpClient, HedgedRequestFirstResponseWins) {
+  std::atomic<unsigned> server_requests{0};
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    if (server_requests++ == 0) return sleep_callback(request);
+    return EchoCallback{}(request);
+  }};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings settings;
+  settings.delay = std::chrono::milliseconds{50};
+  const auto start = std::chrono::steady_clock::now();
+  const auto response = http_client_ptr->PerformHedged(
+      [&] {
+        return http_client_ptr->CreateRequest()
+            ->post(http_server.GetBaseUrl(), kTestData)
+            ->timeout(utest::kMaxTestWaitTime);
+      },
+      settings);
+
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            utest::kMaxTestWaitTime / 2);
+  EXPECT_EQ(response->body(), kTestData);
+  EXPECT_EQ(server_requests, 2);
+
+  const auto stats = GetSingleDestinationStatistics(*http_client_ptr);
+  EXPECT_EQ(stats.hedges, 1);
+  EXPECT_EQ(stats.hedge_wins, 1);
+}
+
+UTEST(HttpClient, HedgedRequestNoBudget) {
+  std::atomic<unsigned> server_requests{0};
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    ++server_requests;
+    engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+    return EchoCallback{}(request);
+  }};
+  clients::http::ClientSettings client_settings;
+  client_settings.io_threads = 1;
+  client_settings.hedging_budget_ratio = 0;
+  clients::http::Client client{client_settings,
+                               engine::current_task::GetTaskProcessor()};
+
+  clients::http::HedgingSettings settings;
+  settings.delay = std::chrono::milliseconds{10};
+  const auto response = client.PerformHedged(
+      [&] {
+        return client.CreateRequest()
+            ->post(http_server.GetBaseUrl(), kTestData)
+            ->timeout(utest::kMaxTestWaitTime);
+      },
+      settings);
+
+  EXPECT_EQ(response->body(), kTestData);
+  EXPECT_EQ(server_requests, 1);
+  EXPECT_EQ(GetSingleDestinationStatistics(client).hedges, 0);
+}
+
 USERVER_NAMESPACE_END
@@ -137,6 +137,14 @@ properties:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    host-affinity-threads:
+        type: integer
+        description: number of IO threads that requests to the same host are spread over, so that they reuse the warm connections of those threads; 0 picks threads without regard to the host
+        defaultDescription: 2
+    hedging-budget-ratio:
+        type: number
+        description: max share of extra attempts started by Client::PerformHedged relative to all the requests; 0 disables hedging
+        defaultDescription: 0.05
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
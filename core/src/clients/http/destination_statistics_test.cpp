@@ -105,4 +105,32 @@ UTEST(DestinationStatistics, Multiple) {
   }
 }
 
+UTEST(DestinationStatistics, HostAffinityReusesConnections) {
+  const utest::SimpleServer http_server{[](const HttpRequest&) {
+    return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+                        HttpResponse::kWriteAndContinue};
+  }};
+  clients::http::Client client{{"", 4, false},
+                               engine::current_task::GetTaskProcessor()};
+
+  const auto url = http_server.GetBaseUrl();
+  constexpr std::size_t kRequests = 20;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    const auto response = client.CreateRequest()
+                              ->get(url)
+                              ->retry(1)
+                              ->timeout(std::chrono::seconds(1))
+                              ->perform();
+    EXPECT_EQ(response->status_code(), 200);
+  }
+
+  const auto& dest_stats = client.GetDestinationStatistics();
+  ASSERT_NE(dest_stats.begin(), dest_stats.end());
+  const auto stats =
+      clients::http::InstanceStatistics(*dest_stats.begin()->second);
+  EXPECT_EQ(stats.GetRequestsCount(), kRequests);
+  // sequential requests go to the same multi and reuse its connection
+  EXPECT_LE(stats.multi.socket_open, 2);
+}
+
 USERVER_NAMESPACE_END
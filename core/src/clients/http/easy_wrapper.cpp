@@ -2,6 +2,8 @@
 
 #include <userver/clients/http/client.hpp>
 #include <userver/clients/http/response_future.hpp>
+
+#include <clients/http/statistics.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +19,10 @@ EasyWrapper::~EasyWrapper() { client_.PushIdleEasy(std::move(easy_)); }
 
 curl::easy& EasyWrapper::Easy() { return *easy_; }
 
+std::shared_ptr<RequestStats> EasyWrapper::BindToHost(std::string_view host) {
+  return client_.BindToHost(*easy_, host);
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 #include <curl-ev/easy.hpp>
 
@@ -8,6 +9,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 class Client;
+class RequestStats;
 }  // namespace clients::http
 
 namespace clients::http::impl {
@@ -25,6 +27,10 @@ class EasyWrapper final {
 
   curl::easy& Easy();
 
+  /// Moves the handle to the multi that is preferred for the `host`.
+  /// @returns statistics of the new multi or nullptr if the handle stays
+  std::shared_ptr<RequestStats> BindToHost(std::string_view host);
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
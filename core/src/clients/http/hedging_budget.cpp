@@ -0,0 +1,48 @@
+#include <clients/http/hedging_budget.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+namespace {
+
+// Tokens are stored as integers, a hedged attempt costs kTokenScale of them
+constexpr std::int64_t kTokenScale = 1000;
+
+// Allows a burst of hedges after a quiet period
+constexpr std::int64_t kMaxTokens = 10 * kTokenScale;
+
+}  // namespace
+
+HedgingBudget::HedgingBudget(double ratio)
+    : tokens_per_request_(std::llround(ratio * kTokenScale)),
+      tokens_(kMaxTokens) {}
+
+void HedgingBudget::AccountRequest() noexcept {
+  if (tokens_per_request_ <= 0) return;
+
+  auto tokens = tokens_.load(std::memory_order_relaxed);
+  while (tokens < kMaxTokens &&
+         !tokens_.compare_exchange_weak(
+             tokens, std::min(tokens + tokens_per_request_, kMaxTokens),
+             std::memory_order_relaxed)) {
+  }
+}
+
+bool HedgingBudget::TryStartHedge() noexcept {
+  if (tokens_per_request_ <= 0) return false;
+
+  auto tokens = tokens_.load(std::memory_order_relaxed);
+  do {
+    if (tokens < kTokenScale) return false;
+  } while (!tokens_.compare_exchange_weak(tokens, tokens - kTokenScale,
+                                          std::memory_order_relaxed));
+  return true;
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+/// Token bucket that limits hedged attempts to a share of all the requests.
+/// Each request adds `ratio` of a token, each hedged attempt takes a token.
+class HedgingBudget final {
+ public:
+  explicit HedgingBudget(double ratio);
+
+  void AccountRequest() noexcept;
+
+  bool TryStartHedge() noexcept;
+
+ private:
+  const std::int64_t tokens_per_request_;
+  std::atomic<std::int64_t> tokens_;
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
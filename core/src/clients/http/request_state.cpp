@@ -49,6 +49,15 @@ const std::string kTestsuiteSupportedErrorsKey = "X-Testsuite-Supported-Errors";
 const std::string kTestsuiteSupportedErrors =
     boost::algorithm::join(boost::adaptors::keys(kTestsuiteActions), ",");
 
+// Returns the "scheme://host:port" part of the URL
+std::string_view GetConnectionKey(std::string_view url) {
+  auto authority_begin = url.find("://");
+  authority_begin =
+      authority_begin == std::string_view::npos ? 0 : authority_begin + 3;
+  const auto authority_end = url.find_first_of("/?#", authority_begin);
+  return url.substr(0, authority_end);
+}
+
 std::error_code TestsuiteResponseHook(Status status_code,
                                       const Headers& headers,
                                       tracing::Span& span) {
@@ -255,6 +264,20 @@ void RequestState::SetDestinationMetricName(const std::string& destination) {
   dest_req_stats_ = dest_stats_->GetStatisticsForDestination(destination);
 }
 
+std::optional<std::chrono::milliseconds>
+RequestState::GetDestinationTimingPercentile(double percent) const {
+  if (!dest_req_stats_) return std::nullopt;
+  return dest_req_stats_->GetTimingPercentile(percent);
+}
+
+void RequestState::AccountHedge() {
+  WithRequestStats([](RequestStats& stats) { stats.AccountHedge(); });
+}
+
+void RequestState::AccountHedgeWin() {
+  WithRequestStats([](RequestStats& stats) { stats.AccountHedgeWin(); });
+}
+
 void RequestState::SetTestsuiteConfig(
     const std::shared_ptr<const TestsuiteConfig>& config) {
   testsuite_config_ = config;
@@ -492,6 +515,7 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform() {
 
   auto future = StartNewPromise();
   ApplyTestsuiteConfig();
+  BindToHost();
   StartStats();
 
   // if we need retries call with special callback
@@ -525,6 +549,7 @@ void RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue) {
   retry_.retries = 1;  // Force no retries
 
   ApplyTestsuiteConfig();
+  BindToHost();
   StartStats();
 
   perform_request([holder = shared_from_this()](std::error_code err) mutable {
@@ -745,6 +770,15 @@ void RequestState::StartNewSpan() {
   span.DetachFromCoroStack();
 }
 
+void RequestState::BindToHost() {
+  // Connections are cached by scheme, host and port; with a proxy they all
+  // go to the proxy
+  auto stats = easy_->BindToHost(
+      proxy_url_.empty() ? GetConnectionKey(easy().get_original_url())
+                         : std::string_view{proxy_url_});
+  if (stats) stats_ = std::move(stats);
+}
+
 void RequestState::StartStats() {
   if (!dest_req_stats_) {
     dest_req_stats_ =
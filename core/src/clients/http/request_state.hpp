@@ -90,6 +90,17 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetDestinationMetricName(const std::string& destination);
 
+  /// timing percentile of the destination for the last minute, available
+  /// after the request was started
+  std::optional<std::chrono::milliseconds> GetDestinationTimingPercentile(
+      double percent) const;
+
+  /// account the request as a hedged attempt, must be called after the
+  /// request was started
+  void AccountHedge();
+  /// account the request as a hedged attempt that was the first to respond
+  void AccountHedgeWin();
+
   void SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& config);
 
   void SetAllowedUrlsExtra(const std::vector<std::string>& urls);
@@ -146,6 +157,7 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   engine::Future<std::shared_ptr<Response>> StartNewPromise();
   void ApplyTestsuiteConfig();
   void StartNewSpan();
+  void BindToHost();
   void StartStats();
 
   template <typename Func>
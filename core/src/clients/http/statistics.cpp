@@ -70,6 +70,15 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
   ++stats_.cancelled_by_deadline_;
 }
 
+void RequestStats::AccountHedge() noexcept { ++stats_.hedges_; }
+
+void RequestStats::AccountHedgeWin() noexcept { ++stats_.hedge_wins_; }
+
+std::optional<std::chrono::milliseconds> RequestStats::GetTimingPercentile(
+    double percent) const {
+  return stats_.GetTimingPercentile(percent);
+}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
   using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -132,6 +141,13 @@ void Statistics::AccountError(ErrorGroup error) {
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+std::optional<std::chrono::milliseconds> Statistics::GetTimingPercentile(
+    double percent) const {
+  const auto timings = timings_percentile_.GetStatsForPeriod();
+  if (timings.Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 formats::json::ValueBuilder StatisticsToJson(const InstanceStatistics& stats,
                                              FormatMode format_mode) {
   formats::json::ValueBuilder json;
@@ -156,6 +172,9 @@ formats::json::ValueBuilder StatisticsToJson(const InstanceStatistics& stats,
   json["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
   json["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
+  json["hedging"]["attempts"] = stats.hedges;
+  json["hedging"]["wins"] = stats.hedge_wins;
+
   if (format_mode == FormatMode::kModeAll) {
     json["last-time-to-start-us"] =
         SumToMean(stats.last_time_to_start_us, stats.instances_aggregated);
@@ -171,6 +190,11 @@ formats::json::ValueBuilder StatisticsToJson(const InstanceStatistics& stats,
         stats.multi.socket_open - stats.multi.socket_close;
   }
   json["sockets"]["open"] = stats.multi.socket_open;
+  // Each opened socket means a TCP (and TLS) handshake, a value close to 1
+  // means that connections are not reused
+  json["sockets"]["handshakes-per-request"] =
+      SumToMean(static_cast<double>(stats.multi.socket_open),
+                stats.GetRequestsCount());
 
   return json;
 }
@@ -199,7 +223,9 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       reply_status(other.reply_status_.GetSnapshot()),
       retries(other.retries_.load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.load()),
-      cancelled_by_deadline(other.cancelled_by_deadline_.load()) {
+      cancelled_by_deadline(other.cancelled_by_deadline_.load()),
+      hedges(other.hedges_.load()),
+      hedge_wins(other.hedge_wins_.load()) {
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].load();
   multi.socket_open = other.socket_open_;
@@ -217,6 +243,12 @@ uint64_t InstanceStatistics::GetNotOkErrorCount() const {
   return result;
 }
 
+uint64_t InstanceStatistics::GetRequestsCount() const {
+  uint64_t result{0};
+  for (const auto count : error_count) result += count;
+  return result;
+}
+
 InstanceStatistics& InstanceStatistics::operator+=(
     const InstanceStatistics& stat) {
   instances_aggregated += stat.instances_aggregated;
@@ -233,6 +265,8 @@ InstanceStatistics& InstanceStatistics::operator+=(
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
+  hedges += stat.hedges;
+  hedge_wins += stat.hedge_wins;
 
   multi += stat.multi;
   return *this;
@@ -2,12 +2,13 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/datetime.hpp>
-#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 #include <utils/statistics/http_codes.hpp>
 
@@ -33,6 +34,12 @@ class RequestStats final {
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
 
+  void AccountHedge() noexcept;
+  void AccountHedgeWin() noexcept;
+
+  std::optional<std::chrono::milliseconds> GetTimingPercentile(
+      double percent) const;
+
  private:
   void StoreTiming() noexcept;
 
@@ -55,10 +62,10 @@ struct MultiStats {
   }
 };
 
+// Milliseconds up to ~131 seconds with 3% precision
 using Percentile =
-    utils::statistics::Percentile</*buckets =*/2000, unsigned int,
-                                  /*extra_buckets=*/1180,
-                                  /*extra_bucket_size=*/100>;
+    utils::statistics::LogLinearHistogram</*precision_bits=*/5,
+                                          /*max_value_bits=*/17>;
 
 class Statistics {
  public:
@@ -89,6 +96,13 @@ class Statistics {
 
   void AccountStatus(int);
 
+  std::uint64_t GetPendingRequests() const { return easy_handles_.load(); }
+
+  /// @returns the timing percentile for the last minute or std::nullopt if
+  /// there were no requests
+  std::optional<std::chrono::milliseconds> GetTimingPercentile(
+      double percent) const;
+
  private:
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -102,6 +116,8 @@ class Statistics {
 
   std::atomic<std::uint64_t> timeout_updated_by_deadline_{0};
   std::atomic<std::uint64_t> cancelled_by_deadline_{0};
+  std::atomic<std::uint64_t> hedges_{0};
+  std::atomic<std::uint64_t> hedge_wins_{0};
   utils::statistics::HttpCodes reply_status_;
 
   friend struct InstanceStatistics;
@@ -115,6 +131,8 @@ struct InstanceStatistics {
 
   uint64_t GetNotOkErrorCount() const;
 
+  uint64_t GetRequestsCount() const;
+
   InstanceStatistics& operator+=(const InstanceStatistics& stat);
 
   using ErrorGroup = Statistics::ErrorGroup;
@@ -132,6 +150,9 @@ struct InstanceStatistics {
   std::uint64_t timeout_updated_by_deadline{0};
   std::uint64_t cancelled_by_deadline{0};
 
+  std::uint64_t hedges{0};
+  std::uint64_t hedge_wins{0};
+
   MultiStats multi;
 };
 
@@ -1,19 +1,61 @@
 #include <userver/components/tracer.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/json/value_builder.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <tracing/span_exporter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
 namespace {
 constexpr std::string_view kNativeTrace = "native";
+
+tracing::impl::SpanExporterConfig ParseSpanExporterConfig(
+    const yaml_config::YamlConfig& config) {
+  tracing::impl::SpanExporterConfig result;
+  result.endpoint = config["endpoint"].As<std::string>({});
+  result.file_path = config["file"].As<std::string>({});
+  result.sampling_probability =
+      config["sampling-probability"].As<double>(result.sampling_probability);
+
+  const auto tail = config["tail-sampling"];
+  result.tail_latency_threshold =
+      tail["latency-threshold"].As<std::optional<std::chrono::milliseconds>>();
+  result.tail_keep_errors = tail["keep-errors"].As<bool>(false);
+  result.tail_decision_timeout =
+      tail["decision-timeout"].As<std::chrono::milliseconds>(
+          result.tail_decision_timeout);
+  result.tail_max_traces =
+      tail["max-traces"].As<std::size_t>(result.tail_max_traces);
+
+  result.batch_size = config["batch-size"].As<std::size_t>(result.batch_size);
+  result.flush_interval =
+      config["flush-interval"].As<std::chrono::milliseconds>(
+          result.flush_interval);
+  result.queue_size = config["queue-size"].As<std::size_t>(result.queue_size);
+  return result;
+}
+
+formats::json::ValueBuilder GetSpanExporterStatistics(
+    const tracing::impl::SpanExporter& exporter) {
+  const auto stats = exporter.GetStatistics();
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  result["exported"] = stats.exported;
+  result["sampled-out"] = stats.sampled_out;
+  result["dropped"] = stats.dropped;
+  result["batches"] = stats.batches;
+  result["errors"] = stats.errors;
+  return result;
 }
+}  // namespace
 
 Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
   auto& logging_component = context.FindComponent<Logging>();
@@ -37,6 +79,29 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
   }
 
   tracing::Tracer::SetTracer(std::move(tracer));
+
+  const auto exporter_config = config["span-exporter"];
+  if (!exporter_config.IsMissing()) {
+    auto exporter = std::make_shared<tracing::impl::SpanExporter>(
+        service_name, ParseSpanExporterConfig(exporter_config));
+    tracing::impl::SetSpanExporter(exporter);
+    LOG_INFO() << "Span export enabled, opentracing logger is not used";
+
+    auto* statistics_storage =
+        context.FindComponentOptional<components::StatisticsStorage>();
+    if (statistics_storage) {
+      statistics_holder_ = statistics_storage->GetStorage().RegisterExtender(
+          "tracing.span-exporter",
+          [exporter = std::move(exporter)](const auto& /*request*/) {
+            return GetSpanExporterStatistics(*exporter);
+          });
+    }
+  }
+}
+
+Tracer::~Tracer() {
+  statistics_holder_.Unregister();
+  tracing::impl::SetSpanExporter({});
 }
 
 yaml_config::Schema Tracer::GetStaticConfigSchema() {
@@ -52,6 +117,58 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    span-exporter:
+        type: object
+        description: |
+            export finished spans in batches of OTLP protobuf instead of
+            logging them to the 'opentracing' logger
+        additionalProperties: false
+        properties:
+            endpoint:
+                type: string
+                description: host:port of an OTLP/HTTP collector, exclusive with 'file'
+            file:
+                type: string
+                description: |
+                    file to append length-delimited OTLP
+                    ExportTraceServiceRequest messages to, exclusive with
+                    'endpoint'
+            sampling-probability:
+                type: number
+                description: share of the traces to export, the decision is made by trace id
+                defaultDescription: 1.0
+            tail-sampling:
+                type: object
+                description: export the traces that were not sampled if they are slow or errored
+                additionalProperties: false
+                properties:
+                    latency-threshold:
+                        type: string
+                        description: export the trace if any of its spans took longer
+                    keep-errors:
+                        type: boolean
+                        description: export the trace if any of its spans has the error tag
+                        defaultDescription: false
+                    decision-timeout:
+                        type: string
+                        description: time to wait for the local root span of a trace
+                        defaultDescription: 30s
+                    max-traces:
+                        type: integer
+                        description: max number of traces awaiting the decision
+                        defaultDescription: 10000
+            batch-size:
+                type: integer
+                description: max number of spans in a single export request
+                defaultDescription: 512
+            flush-interval:
+                type: string
+                description: max time a span waits for the batch to fill up
+                defaultDescription: 1s
+            queue-size:
+                type: integer
+                description: max number of spans awaiting export, new spans are dropped on overflow
+                defaultDescription: 65536
 )");
 }
 
@@ -83,6 +83,11 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
   return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::SetMulti(multi& multi_handle) {
+  UASSERT_MSG(!multi_registered_, "Can not rebind a performing easy handle");
+  multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
   easy* easy_handle = nullptr;
   native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE,
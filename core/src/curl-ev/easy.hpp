@@ -170,6 +170,10 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   const multi* GetMulti() const { return multi_; }
 
+  // Moves an idle handle to another multi, so that the next request uses the
+  // connection cache and the event loop of that multi.
+  void SetMulti(multi& multi_handle);
+
   inline native::CURL* native_handle() { return handle_; }
   engine::ev::ThreadControl& GetThreadControl();
 
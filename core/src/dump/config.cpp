@@ -19,9 +19,14 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kCompressed = "compressed";
+constexpr std::string_view kCompressionParallelFrames =
+    "compression-parallel-frames";
+constexpr std::string_view kMemoryMapped = "memory-mapped";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr auto kDefaultCompressionParallelFrames = std::size_t{4};
 
 }  // namespace
 
@@ -67,6 +72,11 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_compressed(config[kCompressed].As<bool>(false)),
+      compression_parallel_frames(
+          config[kCompressionParallelFrames].As<std::size_t>(
+              kDefaultCompressionParallelFrames)),
+      dump_is_memory_mapped(config[kMemoryMapped].As<bool>(false)),
       dumps_enabled(config[kDumpsEnabled].As<bool>()),
       min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +88,19 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (compression_parallel_frames == 0) {
+    throw std::logic_error(fmt::format("{}: {} must not be 0", this->name,
+                                       kCompressionParallelFrames));
+  }
+  if (dump_is_encrypted && dump_is_compressed) {
+    throw std::logic_error(fmt::format("{}: {} and {} can not be used together",
+                                       this->name, kEncrypted, kCompressed));
+  }
+  if (dump_is_memory_mapped && (dump_is_encrypted || dump_is_compressed)) {
+    throw std::logic_error(fmt::format(
+        "{}: {} can not be used together with {} or {}", this->name,
+        kMemoryMapped, kEncrypted, kCompressed));
+  }
 }
 
 Config Config::MergeWith(const ConfigPatch& patch) const {
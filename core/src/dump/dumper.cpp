@@ -31,6 +31,7 @@
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dump/factory.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/testsuite/dump_control.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -86,6 +87,14 @@ Config ParseConfig(const components::ComponentConfig& config,
       context.FindComponent<components::DumpConfigurator>().GetDumpRoot()};
 }
 
+// Only compressed dumps differ in file and data sizes
+template <typename Compressed, typename Operations>
+std::uint64_t GetUncompressedSize(const Operations& operations,
+                                  std::uint64_t file_size) {
+  const auto* compressed = dynamic_cast<const Compressed*>(&operations);
+  return compressed ? compressed->GetUncompressedSize() : file_size;
+}
+
 }  // namespace
 
 class Dumper::Impl {
@@ -310,6 +319,7 @@ void Dumper::Impl::DoDump(TimePoint update_time, tracing::ScopeTime& scope,
   const auto dump_start = std::chrono::steady_clock::now();
 
   std::uint64_t dump_size = 0;
+  std::uint64_t uncompressed_size = 0;
   try {
     auto dump_stats = dump_data.locator.RegisterNewDump(update_time, config);
     const auto& dump_path = dump_stats.full_path;
@@ -317,6 +327,8 @@ void Dumper::Impl::DoDump(TimePoint update_time, tracing::ScopeTime& scope,
     dump_data.dumpable.GetAndWrite(*writer);
     writer->Finish();
     dump_size = boost::filesystem::file_size(dump_path);
+    uncompressed_size =
+        GetUncompressedSize<CompressedWriter>(*writer, dump_size);
   } catch (const std::exception& ex) {
     LOG_ERROR() << Name() << ": error while writing a dump. Reason: " << ex;
     throw;
@@ -325,6 +337,7 @@ void Dumper::Impl::DoDump(TimePoint update_time, tracing::ScopeTime& scope,
   LOG_INFO() << Name() << ": a new dump has been written";
 
   statistics_.last_written_size = dump_size;
+  statistics_.last_written_uncompressed_size = uncompressed_size;
   statistics_.last_nontrivial_write_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::steady_clock::now() - dump_start);
@@ -434,6 +447,8 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(DumpData& dump_data,
     return {};
   }
 
+  std::uint64_t dump_size = 0;
+  std::uint64_t uncompressed_size = 0;
   const std::optional<TimePoint> update_time =
       utils::Async(fs_task_processor_, "read-dump", [&] {
         try {
@@ -444,6 +459,9 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(DumpData& dump_data,
               dump_data.rw_factory->CreateReader(dump_stats->full_path);
           dump_data.dumpable.ReadAndSet(*reader);
           reader->Finish();
+          dump_size = boost::filesystem::file_size(dump_stats->full_path);
+          uncompressed_size =
+              GetUncompressedSize<CompressedReader>(*reader, dump_size);
 
           return std::optional{dump_stats->update_time};
         } catch (const std::exception& ex) {
@@ -469,6 +487,8 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(DumpData& dump_data,
   statistics_.load_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::steady_clock::now() - load_start);
+  statistics_.loaded_size = dump_size;
+  statistics_.loaded_uncompressed_size = uncompressed_size;
   return update_time;
 }
 
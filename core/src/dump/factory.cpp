@@ -1,8 +1,10 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mapped.hpp>
 #include <userver/storages/secdist/component.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,6 +21,12 @@ boost::filesystem::perms GetPerms(const Config& config) {
     return perms::owner_read;
 }
 
+CompressionSettings GetCompressionSettings(const Config& config) {
+  CompressionSettings settings;
+  settings.max_parallel_frames = config.compression_parallel_frames;
+  return settings;
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
@@ -30,6 +38,11 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
     return std::make_unique<dump::EncryptedOperationsFactory>(
         std::move(secret_key), dump_perms);
+  } else if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(
+        dump_perms, GetCompressionSettings(config));
+  } else if (config.dump_is_memory_mapped) {
+    return std::make_unique<dump::MappedOperationsFactory>(dump_perms);
   } else {
     return std::make_unique<dump::FileOperationsFactory>(dump_perms);
   }
@@ -38,6 +51,13 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
+  if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(
+        dump_perms, GetCompressionSettings(config));
+  }
+  if (config.dump_is_memory_mapped) {
+    return std::make_unique<dump::MappedOperationsFactory>(dump_perms);
+  }
   return std::make_unique<dump::FileOperationsFactory>(dump_perms);
 }
 
@@ -0,0 +1,345 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// File format:
+//   magic
+//   (header, compressed data)... for each frame
+//   header filled with zeroes
+// Header fields are 32-bit little-endian integers:
+//   uncompressed size, compressed size, CRC32 of the uncompressed data
+constexpr std::string_view kMagic{"UDMPZ\0\0\1", 8};
+constexpr std::size_t kFrameHeaderSize = 12;
+constexpr std::size_t kMaxFrameSize = 1 << 30;
+
+struct FrameHeader final {
+  std::uint32_t uncompressed_size{0};
+  std::uint32_t compressed_size{0};
+  std::uint32_t checksum{0};
+};
+
+void StoreUint32(char* out, std::uint32_t value) noexcept {
+  for (int i = 0; i < 4; ++i) {
+    out[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  }
+}
+
+std::uint32_t LoadUint32(const char* data) noexcept {
+  std::uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(static_cast<unsigned char>(data[i]))
+             << (8 * i);
+  }
+  return value;
+}
+
+FrameHeader ParseFrameHeader(const char* data) noexcept {
+  return {LoadUint32(data), LoadUint32(data + 4), LoadUint32(data + 8)};
+}
+
+std::uint32_t Checksum(std::string_view data) noexcept {
+  return ::crc32(0L, reinterpret_cast<const Bytef*>(data.data()),
+                 static_cast<uInt>(data.size()));
+}
+
+// Returns the frame ready to be written to the file, with the header
+std::string CompressFrame(const std::string& frame, int level) {
+  auto compressed_size = ::compressBound(frame.size());
+  std::string result(kFrameHeaderSize + compressed_size, '\0');
+
+  const auto rc = ::compress2(
+      reinterpret_cast<Bytef*>(result.data() + kFrameHeaderSize),
+      &compressed_size, reinterpret_cast<const Bytef*>(frame.data()),
+      frame.size(), level);
+  if (rc != Z_OK) {
+    throw Error(fmt::format("Failed to compress a dump frame: zlib error {}",
+                            rc));
+  }
+
+  result.resize(kFrameHeaderSize + compressed_size);
+  StoreUint32(result.data(), static_cast<std::uint32_t>(frame.size()));
+  StoreUint32(result.data() + 4, static_cast<std::uint32_t>(compressed_size));
+  StoreUint32(result.data() + 8, Checksum(frame));
+  return result;
+}
+
+std::string DecompressFrame(const std::string& compressed, FrameHeader header,
+                            const std::string& path) {
+  std::string result(header.uncompressed_size, '\0');
+  uLongf size = header.uncompressed_size;
+
+  const auto rc = ::uncompress(
+      reinterpret_cast<Bytef*>(result.data()), &size,
+      reinterpret_cast<const Bytef*>(compressed.data()), compressed.size());
+  if (rc != Z_OK || size != header.uncompressed_size) {
+    throw Error(fmt::format(
+        "Failed to decompress a frame of the dump file \"{}\": zlib error {}",
+        path, rc));
+  }
+  if (Checksum(result) != header.checksum) {
+    throw Error(fmt::format(
+        "Checksum mismatch in a frame of the dump file \"{}\"", path));
+  }
+  return result;
+}
+
+}  // namespace
+
+CompressedWriter::CompressedWriter(std::string path,
+                                   boost::filesystem::perms perms,
+                                   const CompressionSettings& settings,
+                                   tracing::ScopeTime& scope)
+    : final_path_(std::move(path)),
+      path_(final_path_ + ".tmp"),
+      perms_(perms),
+      settings_(settings),
+      cpu_relax_(kCheckTimeAfterBytes, &scope) {
+  UASSERT(settings_.frame_size > 0 && settings_.frame_size <= kMaxFrameSize);
+  UASSERT(settings_.max_parallel_frames > 0);
+
+  constexpr fs::blocking::OpenMode mode{
+      fs::blocking::OpenFlag::kWrite, fs::blocking::OpenFlag::kExclusiveCreate};
+  const auto tmp_perms = perms_ | boost::filesystem::perms::owner_write;
+
+  try {
+    file_ = fs::blocking::CFile{path_, mode, tmp_perms};
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to open the dump file for write \"{}\": {}",
+                            path_, ex.what()));
+  }
+
+  WriteToFile(kMagic);
+  frame_.reserve(settings_.frame_size);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+std::uint64_t CompressedWriter::GetUncompressedSize() const {
+  return cpu_relax_.GetBytesProcessed();
+}
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  const auto data_size = data.size();
+  while (!data.empty()) {
+    const auto size =
+        std::min(data.size(), settings_.frame_size - frame_.size());
+    frame_.append(data.data(), size);
+    data.remove_prefix(size);
+    if (frame_.size() == settings_.frame_size) StartFrameCompression();
+  }
+  cpu_relax_.Relax(data_size);
+}
+
+void CompressedWriter::StartFrameCompression() {
+  if (pending_frames_.size() == settings_.max_parallel_frames) {
+    WriteCompressedFrame();
+  }
+
+  pending_frames_.push_back(engine::AsyncNoSpan(
+      [frame = std::move(frame_), level = settings_.level] {
+        return CompressFrame(frame, level);
+      }));
+
+  frame_.clear();
+  frame_.reserve(settings_.frame_size);
+}
+
+void CompressedWriter::WriteCompressedFrame() {
+  auto task = std::move(pending_frames_.front());
+  pending_frames_.pop_front();
+  WriteToFile(task.Get());
+}
+
+void CompressedWriter::WriteToFile(std::string_view data) {
+  try {
+    file_.Write(data);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to write to the dump file \"{}\": {}",
+                            path_, ex.what()));
+  }
+}
+
+void CompressedWriter::Finish() {
+  if (!frame_.empty()) StartFrameCompression();
+  while (!pending_frames_.empty()) WriteCompressedFrame();
+
+  const char last_frame_header[kFrameHeaderSize]{};
+  WriteToFile({last_frame_header, kFrameHeaderSize});
+
+  try {
+    file_.Flush();
+    std::move(file_).Close();
+    fs::blocking::Chmod(path_, perms_);  // drop perms::owner_write
+    fs::blocking::Rename(path_, final_path_);
+    fs::blocking::SyncDirectoryContents(
+        boost::filesystem::path(final_path_).parent_path().string());
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to finalize dump \"{}\". Reason: {}", path_,
+                            ex.what()));
+  }
+}
+
+CompressedReader::CompressedReader(std::string path,
+                                   const CompressionSettings& settings)
+    : path_(std::move(path)), settings_(settings) {
+  UASSERT(settings_.max_parallel_frames > 0);
+
+  try {
+    file_ = fs::blocking::CFile(path_, fs::blocking::OpenFlag::kRead);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+
+  char magic[kMagic.size()];
+  if (ReadFromFile(magic, kMagic.size()) != kMagic.size() ||
+      std::string_view{magic, kMagic.size()} != kMagic) {
+    throw Error(
+        fmt::format("The dump file \"{}\" is not a compressed dump", path_));
+  }
+
+  StartFramesDecompression();
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::uint64_t CompressedReader::GetUncompressedSize() const {
+  return uncompressed_size_;
+}
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  if (frame_.size() - frame_offset_ >= max_size) {
+    const std::string_view result{frame_.data() + frame_offset_, max_size};
+    frame_offset_ += max_size;
+    uncompressed_size_ += max_size;
+    return result;
+  }
+
+  // The data spans several frames, gather it into chunk_
+  chunk_.assign(frame_, frame_offset_);
+  frame_offset_ = frame_.size();
+  while (chunk_.size() < max_size && NextFrame()) {
+    const auto size = std::min(max_size - chunk_.size(), frame_.size());
+    chunk_.append(frame_, 0, size);
+    frame_offset_ = size;
+  }
+
+  uncompressed_size_ += chunk_.size();
+  return chunk_;
+}
+
+bool CompressedReader::NextFrame() {
+  if (pending_frames_.empty()) return false;
+
+  auto task = std::move(pending_frames_.front());
+  pending_frames_.pop_front();
+  StartFramesDecompression();
+
+  frame_ = task.Get();
+  frame_offset_ = 0;
+  return true;
+}
+
+void CompressedReader::StartFramesDecompression() {
+  while (!is_last_frame_read_ &&
+         pending_frames_.size() < settings_.max_parallel_frames) {
+    char header_data[kFrameHeaderSize];
+    if (ReadFromFile(header_data, kFrameHeaderSize) != kFrameHeaderSize) {
+      throw Error(fmt::format("The dump file \"{}\" is truncated", path_));
+    }
+
+    const auto header = ParseFrameHeader(header_data);
+    if (header.uncompressed_size == 0) {
+      is_last_frame_read_ = true;
+      break;
+    }
+    if (header.uncompressed_size > kMaxFrameSize ||
+        header.compressed_size > ::compressBound(header.uncompressed_size)) {
+      throw Error(fmt::format(
+          "Invalid frame header in the dump file \"{}\": "
+          "uncompressed-size={}, compressed-size={}",
+          path_, header.uncompressed_size, header.compressed_size));
+    }
+
+    std::string compressed(header.compressed_size, '\0');
+    if (ReadFromFile(compressed.data(), compressed.size()) !=
+        compressed.size()) {
+      throw Error(fmt::format("The dump file \"{}\" is truncated", path_));
+    }
+
+    pending_frames_.push_back(engine::AsyncNoSpan(
+        [compressed = std::move(compressed), header, &path = path_] {
+          return DecompressFrame(compressed, header, path);
+        }));
+  }
+}
+
+std::size_t CompressedReader::ReadFromFile(char* buffer, std::size_t size) {
+  try {
+    return file_.Read(buffer, size);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            path_, ex.what()));
+  }
+}
+
+void CompressedReader::Finish() {
+  if (frame_offset_ != frame_.size() || !pending_frames_.empty()) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of the compressed dump file \"{}\"",
+        path_));
+  }
+  UASSERT(is_last_frame_read_);
+
+  char extra_byte = 0;
+  if (ReadFromFile(&extra_byte, 1) != 0) {
+    throw Error(fmt::format(
+        "Unexpected data after the last frame of the compressed dump file "
+        "\"{}\"",
+        path_));
+  }
+
+  try {
+    std::move(file_).Close();
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to finalize dump file \"{}\". Reason: {}",
+                            path_, ex.what()));
+  }
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    boost::filesystem::perms perms, const CompressionSettings& settings)
+    : perms_(perms), settings_(settings) {}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(std::move(full_path), settings_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(std::move(full_path), perms_,
+                                            settings_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
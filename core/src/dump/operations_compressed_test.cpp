@@ -0,0 +1,115 @@
+#include <userver/utest/utest.hpp>
+
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+dump::CompressionSettings MakeSettings() {
+  dump::CompressionSettings settings;
+  settings.frame_size = 1000;
+  settings.max_parallel_frames = 3;
+  return settings;
+}
+
+}  // namespace
+
+UTEST(DumpCompressedFile, Smoke) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           MakeSettings(), scope_time);
+
+  w.Write(1);
+  UEXPECT_NO_THROW(w.Finish());
+  EXPECT_EQ(w.GetUncompressedSize(), 1);
+
+  dump::CompressedReader r(path, MakeSettings());
+  EXPECT_EQ(r.Read<int32_t>(), 1);
+
+  UEXPECT_THROW(r.Read<int32_t>(), dump::Error);
+
+  UEXPECT_NO_THROW(r.Finish());
+}
+
+UTEST_MT(DumpCompressedFile, ManyFrames, 4) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           MakeSettings(), scope_time);
+
+  for (int i = 0; i < 10000; i++) w.Write(i);
+  w.Write(std::string(5000, 'a'));
+  UEXPECT_NO_THROW(w.Finish());
+
+  EXPECT_LT(boost::filesystem::file_size(path), w.GetUncompressedSize());
+
+  dump::CompressedReader r(path, MakeSettings());
+  for (int i = 0; i < 10000; i++) EXPECT_EQ(r.Read<int32_t>(), i);
+  EXPECT_EQ(r.Read<std::string>(), std::string(5000, 'a'));
+  UEXPECT_NO_THROW(r.Finish());
+  EXPECT_EQ(r.GetUncompressedSize(), w.GetUncompressedSize());
+}
+
+UTEST(DumpCompressedFile, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           MakeSettings(), scope_time);
+
+  w.Write(1);
+  UEXPECT_NO_THROW(w.Finish());
+
+  dump::CompressedReader r(path, MakeSettings());
+
+  UEXPECT_THROW(r.Finish(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, Corrupted) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           MakeSettings(), scope_time);
+
+  w.Write(std::string(100, 'a'));
+  UEXPECT_NO_THROW(w.Finish());
+
+  boost::filesystem::permissions(path, boost::filesystem::perms::owner_write |
+                                           boost::filesystem::perms::owner_read);
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    // Corrupt the checksum of the first frame
+    file.seekp(16);
+    file.put('\x55');
+  }
+
+  dump::CompressedReader r(path, MakeSettings());
+  UEXPECT_THROW(r.Read<std::string>(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, NotCompressed) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  std::ofstream(path) << "not a compressed dump";
+
+  UEXPECT_THROW(dump::CompressedReader(path, MakeSettings()), dump::Error);
+}
+
+USERVER_NAMESPACE_END
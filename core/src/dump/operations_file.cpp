@@ -14,6 +14,10 @@ namespace dump {
 
 namespace {
 constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// Small writes are collected and passed to the file in large blocks, so that
+// the dump is written with a few large write calls
+constexpr std::size_t kWriteBufferSize{1 << 20};
 }
 
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
@@ -36,7 +40,18 @@ FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
 
 void FileWriter::WriteRaw(std::string_view data) {
   try {
-    file_.Write(data);
+    if (buffer_.size() + data.size() > kWriteBufferSize) {
+      file_.Write(buffer_);
+      buffer_.clear();
+    }
+    if (data.size() >= kWriteBufferSize) {
+      file_.Write(data);
+    } else {
+      if (buffer_.capacity() < kWriteBufferSize) {
+        buffer_.reserve(kWriteBufferSize);
+      }
+      buffer_.append(data);
+    }
   } catch (const std::exception& ex) {
     throw Error(fmt::format("Failed to write to the dump file \"{}\": {}",
                             path_, ex.what()));
@@ -46,6 +61,8 @@ void FileWriter::WriteRaw(std::string_view data) {
 
 void FileWriter::Finish() {
   try {
+    file_.Write(buffer_);
+    buffer_.clear();
     file_.Flush();
     std::move(file_).Close();
     fs::blocking::Chmod(path_, perms_);  // drop perms::owner_write
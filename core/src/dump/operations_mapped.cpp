@@ -0,0 +1,104 @@
+#include <userver/dump/operations_mapped.hpp>
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+MappedFile::MappedFile(const std::string& path) {
+  try {
+    auto file =
+        fs::blocking::FileDescriptor::Open(path, fs::blocking::OpenFlag::kRead);
+    size_ = file.GetSize();
+    // An empty file can not be mapped, and there is nothing to map
+    if (size_ == 0) return;
+
+    void* data =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.GetNative(), 0);
+    if (data == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category(), "mmap");
+    }
+    data_ = static_cast<const char*>(data);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to map the dump file \"{}\". Reason: {}",
+                            path, ex.what()));
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (data_) ::munmap(const_cast<char*>(data_), size_);
+}
+
+std::string_view MappedFile::GetData() const { return {data_, size_}; }
+
+void MappedFile::AdviseSequential() const {
+  // The hint is optional, failures are ignored
+  if (data_) ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+}
+
+void MappedFile::AdviseNormal() const {
+  if (data_) ::madvise(const_cast<char*>(data_), size_, MADV_NORMAL);
+}
+
+MappedFileReader::MappedFileReader(std::string path)
+    : path_(std::move(path)),
+      mapping_(std::make_shared<const MappedFile>(path_)),
+      unread_(mapping_->GetData()) {
+  mapping_->AdviseSequential();
+}
+
+std::shared_ptr<const MappedFile> MappedFileReader::GetMapping() const {
+  return mapping_;
+}
+
+std::string_view MappedFileReader::ReadRaw(std::size_t max_size) {
+  const auto result = unread_.substr(0, max_size);
+  unread_.remove_prefix(result.size());
+  return result;
+}
+
+void MappedFileReader::Finish() {
+  if (!unread_.empty()) {
+    const auto file_size = mapping_->GetData().size();
+    const auto position = file_size - unread_.size();
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, file_size, position, unread_.size()));
+  }
+
+  // The data may be used in place after the load, in any order
+  mapping_->AdviseNormal();
+}
+
+std::shared_ptr<const MappedFile> TryGetMapping(const Reader& reader) {
+  const auto* mapped_reader = dynamic_cast<const MappedFileReader*>(&reader);
+  return mapped_reader ? mapped_reader->GetMapping() : nullptr;
+}
+
+MappedOperationsFactory::MappedOperationsFactory(boost::filesystem::perms perms)
+    : perms_(perms) {}
+
+std::unique_ptr<Reader> MappedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<MappedFileReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> MappedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<FileWriter>(std::move(full_path), perms_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,236 @@
+#include <userver/dump/operations_mapped.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/dumper.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/testsuite/dump_control.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+#include <dump/internal_helpers_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+void WriteStrings(const std::string& path,
+                  const std::vector<std::string>& strings) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(strings.size());
+  for (const auto& string : strings) {
+    writer.Write(string.size());
+    WriteStringViewUnsafe(writer, string);
+  }
+  writer.Finish();
+}
+
+// Views into the dump file, usable after the reader is destroyed
+struct MappedStrings {
+  std::shared_ptr<const dump::MappedFile> mapping;
+  std::vector<std::string_view> strings;
+};
+
+MappedStrings ReadStrings(const std::string& path) {
+  dump::MappedFileReader reader(path);
+  MappedStrings result{reader.GetMapping(), {}};
+
+  const auto size = reader.Read<std::size_t>();
+  result.strings.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.strings.push_back(ReadStringViewUnsafe(reader));
+  }
+  reader.Finish();
+  return result;
+}
+
+// A cache of strings that keeps the views into a memory-mapped dump
+class MappedStringsCache final : public dump::DumpableEntity {
+ public:
+  static constexpr auto kName = "mapped-strings-cache";
+
+  explicit MappedStringsCache(std::vector<std::string> owned = {})
+      : owned_(std::move(owned)), views_(owned_.begin(), owned_.end()) {}
+
+  void GetAndWrite(dump::Writer& writer) const override {
+    writer.Write(views_.size());
+    for (const auto view : views_) {
+      writer.Write(view.size());
+      WriteStringViewUnsafe(writer, view);
+    }
+  }
+
+  void ReadAndSet(dump::Reader& reader) override {
+    mapping_ = dump::TryGetMapping(reader);
+    ASSERT_TRUE(mapping_);
+
+    const auto size = reader.Read<std::size_t>();
+    views_.clear();
+    views_.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      views_.push_back(ReadStringViewUnsafe(reader));
+    }
+  }
+
+  const std::shared_ptr<const dump::MappedFile>& GetMapping() const {
+    return mapping_;
+  }
+
+  const std::vector<std::string_view>& GetViews() const { return views_; }
+
+ private:
+  std::vector<std::string> owned_;
+  std::shared_ptr<const dump::MappedFile> mapping_;
+  std::vector<std::string_view> views_;
+};
+
+const std::string kMappedConfig = R"(
+enable: true
+world-readable: true
+format-version: 0
+max-age:  # unlimited
+max-count: 1
+memory-mapped: true
+)";
+
+dump::Dumper MakeDumper(const dump::Config& config,
+                        const dynamic_config::StorageMock& config_storage,
+                        utils::statistics::Storage& statistics_storage,
+                        testsuite::DumpControl& control,
+                        dump::DumpableEntity& dumpable) {
+  return dump::Dumper{
+      config,
+      dump::CreateDefaultOperationsFactory(config),
+      engine::current_task::GetTaskProcessor(),
+      config_storage.GetSource(),
+      statistics_storage,
+      control,
+      dumpable,
+  };
+}
+
+}  // namespace
+
+UTEST(DumpOperationsMapped, ZeroCopyStrings) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  const std::vector<std::string> strings{"foo", "", std::string(10000, 'a'),
+                                         "bar"};
+  WriteStrings(path, strings);
+
+  const auto mapped = ReadStrings(path);
+  const auto data = mapped.mapping->GetData();
+  ASSERT_EQ(mapped.strings.size(), strings.size());
+  for (std::size_t i = 0; i < strings.size(); ++i) {
+    EXPECT_EQ(mapped.strings[i], strings[i]);
+    EXPECT_GE(mapped.strings[i].data(), data.data());
+    EXPECT_LE(mapped.strings[i].data() + mapped.strings[i].size(),
+              data.data() + data.size());
+  }
+}
+
+UTEST(DumpOperationsMapped, CacheKeepsViewsIntoMapping) {
+  const auto root = fs::blocking::TempDirectory::Create();
+  const auto config =
+      dump::ConfigFromYaml(kMappedConfig, root, MappedStringsCache::kName);
+  const dynamic_config::StorageMock config_storage{{dump::kConfigSet, {}}};
+  utils::statistics::Storage statistics_storage;
+  testsuite::DumpControl control;
+
+  const std::vector<std::string> strings{"foo", "", std::string(10000, 'a'),
+                                         "bar"};
+  {
+    MappedStringsCache cache{strings};
+    auto dumper =
+        MakeDumper(config, config_storage, statistics_storage, control, cache);
+    dumper.OnUpdateCompleted(
+        std::chrono::time_point_cast<dump::TimePoint::duration>(
+            utils::datetime::Now()),
+        dump::UpdateType::kModified);
+    dumper.WriteDumpSyncDebug();
+  }
+
+  MappedStringsCache cache;
+  {
+    auto dumper =
+        MakeDumper(config, config_storage, statistics_storage, control, cache);
+    dumper.ReadDumpDebug();
+  }
+
+  // The dumper and its reader are gone, the views are kept alive by the cache
+  ASSERT_TRUE(cache.GetMapping());
+  const auto data = cache.GetMapping()->GetData();
+  ASSERT_EQ(cache.GetViews().size(), strings.size());
+  for (std::size_t i = 0; i < strings.size(); ++i) {
+    const auto view = cache.GetViews()[i];
+    EXPECT_EQ(view, strings[i]);
+    EXPECT_GE(view.data(), data.data());
+    EXPECT_LE(view.data() + view.size(), data.data() + data.size());
+  }
+}
+
+UTEST(DumpOperationsMapped, NoMappingForOtherReaders) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteStrings(path, {"foo"});
+
+  dump::FileReader file_reader(path);
+  EXPECT_FALSE(dump::TryGetMapping(file_reader));
+
+  dump::MappedFileReader mapped_reader(path);
+  EXPECT_EQ(dump::TryGetMapping(mapped_reader), mapped_reader.GetMapping());
+}
+
+UTEST(DumpOperationsMapped, EmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Finish();
+
+  dump::MappedFileReader reader(path);
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 0), "");
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpOperationsMapped, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteStrings(path, {"foo"});
+
+  dump::MappedFileReader reader(path);
+  EXPECT_EQ(reader.Read<std::size_t>(), 1);
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsMapped, ReadPastEnd) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  WriteStrings(path, {});
+
+  dump::MappedFileReader reader(path);
+  EXPECT_EQ(reader.Read<std::size_t>(), 0);
+  UEXPECT_THROW(reader.Read<std::size_t>(), dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,29 @@
 #include <dump/statistics.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 #include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
+namespace {
+
+double GetCompressionRatio(std::size_t size, std::size_t uncompressed_size) {
+  if (size == 0) return 1.0;
+  return static_cast<double>(uncompressed_size) / size;
+}
+
+std::uint64_t GetThroughputKbPerSecond(std::size_t uncompressed_size,
+                                       std::chrono::milliseconds duration) {
+  const auto ms = std::max(duration.count(), std::int64_t{1});
+  return uncompressed_size * 1000 / 1024 / ms;
+}
+
+}  // namespace
+
 formats::json::Value Serialize(const Statistics& stats,
                                formats::serialize::To<formats::json::Value>) {
   formats::json::ValueBuilder result(formats::json::Type::kObject);
@@ -13,7 +31,15 @@ formats::json::Value Serialize(const Statistics& stats,
   const bool is_loaded = stats.is_loaded.load();
   result["is-loaded-from-dump"] = is_loaded ? 1 : 0;
   if (is_loaded) {
-    result["load-duration-ms"] = stats.load_duration.load().count();
+    const auto load_duration = stats.load_duration.load();
+    const auto loaded_size = stats.loaded_size.load();
+    const auto loaded_uncompressed_size = stats.loaded_uncompressed_size.load();
+    result["load-duration-ms"] = load_duration.count();
+    result["load-size-kb"] = loaded_size / 1024;
+    result["load-compression-ratio"] =
+        GetCompressionRatio(loaded_size, loaded_uncompressed_size);
+    result["load-throughput-kb-per-second"] =
+        GetThroughputKbPerSecond(loaded_uncompressed_size, load_duration);
   }
   result["is-current-from-dump"] = stats.is_current_from_dump.load() ? 1 : 0;
 
@@ -26,8 +52,15 @@ formats::json::Value Serialize(const Statistics& stats,
             std::chrono::steady_clock::now() -
             stats.last_nontrivial_write_start_time.load())
             .count();
-    write["duration-ms"] = stats.last_nontrivial_write_duration.load().count();
-    write["size-kb"] = stats.last_written_size.load() / 1024;
+    const auto duration = stats.last_nontrivial_write_duration.load();
+    const auto size = stats.last_written_size.load();
+    const auto uncompressed_size = stats.last_written_uncompressed_size.load();
+    write["duration-ms"] = duration.count();
+    write["size-kb"] = size / 1024;
+    write["uncompressed-size-kb"] = uncompressed_size / 1024;
+    write["compression-ratio"] = GetCompressionRatio(size, uncompressed_size);
+    write["throughput-kb-per-second"] =
+        GetThroughputKbPerSecond(uncompressed_size, duration);
     result["last-nontrivial-write"] = write.ExtractValue();
   }
 
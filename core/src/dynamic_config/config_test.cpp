@@ -183,6 +183,42 @@ std::vector<dynamic_config::KeyValue> MakeBarConfig() {
   return {{kBoolConfig, false}};
 }
 
+/// [Sample keyed UpdateAndListen]
+class IntConfigListener final {
+ public:
+  explicit IntConfigListener(dynamic_config::Source source) {
+    subscription_ = source.UpdateAndListen(
+        this, "int-config-listener", &IntConfigListener::OnConfigUpdate,
+        kIntConfig);
+  }
+
+  ~IntConfigListener() { subscription_.Unsubscribe(); }
+
+  int GetUpdatesCount() const { return updates_count_; }
+
+ private:
+  void OnConfigUpdate(const dynamic_config::Snapshot& config) {
+    EXPECT_NO_THROW(config[kIntConfig]);
+    ++updates_count_;
+  }
+
+  int updates_count_{0};
+  concurrent::AsyncEventSubscriberScope subscription_;
+};
+
+UTEST(DynamicConfig, KeyedUpdateAndListen) {
+  auto storage = MakeFooConfig();
+  IntConfigListener listener{storage.GetSource()};
+  EXPECT_EQ(listener.GetUpdatesCount(), 1);
+
+  storage.Extend(MakeBarConfig());
+  EXPECT_EQ(listener.GetUpdatesCount(), 1);
+
+  storage.Extend({{kIntConfig, 10}});
+  EXPECT_EQ(listener.GetUpdatesCount(), 2);
+}
+/// [Sample keyed UpdateAndListen]
+
 UTEST(DynamicConfig, Extend2) {
   auto storage = MakeFooConfig();
   storage.Extend(MakeBarConfig());
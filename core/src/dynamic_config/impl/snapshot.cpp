@@ -1,11 +1,14 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/cpu_relax.hpp>
-#include <userver/utils/enumerate.hpp>
+#include <userver/utils/scope_guard.hpp>
 #include <utils/impl/static_registration.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,32 +16,70 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config::impl {
 namespace {
 
-std::vector<impl::Factory>& Registry() {
-  static std::vector<impl::Factory> registry;
+struct RegisteredKey final {
+  Factory factory;
+  std::type_index key_type;
+};
+
+std::vector<RegisteredKey>& Registry() {
+  static std::vector<RegisteredKey> registry;
   return registry;
 }
 
 }  // namespace
 
+struct SnapshotData::Entry final {
+  std::any value;
+
+  // Names of the docs that were read by the parser, sorted and unique
+  std::vector<std::string> docs;
+  std::chrono::microseconds parse_duration{0};
+  bool is_parsed{false};
+};
+
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
   throw std::logic_error(fmt::format("Error in Config::Get<{}>: {}",
                                      compiler::GetTypeName(type), ex.what()));
 }
 
-impl::ConfigId Register(impl::Factory factory) {
+impl::ConfigId Register(impl::Factory factory, std::type_index key_type) {
   utils::impl::AssertStaticRegistrationAllowed(
       "dynamic_config::Key registration");
   auto& registry = Registry();
-  registry.push_back(factory);
+  registry.push_back({factory, key_type});
   return registry.size() - 1;
 }
 
+std::string GetKeyName(ConfigId id) {
+  const auto& registry = Registry();
+  UASSERT(id < registry.size());
+  return compiler::GetTypeName(registry[id].key_type);
+}
+
+bool AreDocsUnchanged(const std::vector<std::string>& docs,
+                      const DocsMap& docs_map,
+                      const DocsMap& previous_docs_map) {
+  const bool are_unchanged =
+      std::all_of(docs.begin(), docs.end(), [&](const std::string& name) {
+        return docs_map.IsDocEqual(name, previous_docs_map);
+      });
+  // The updater fetches only the requested docs with load-only-my-values,
+  // the docs of the reused configs must stay requested
+  if (are_unchanged) {
+    for (const auto& name : docs) docs_map.MarkRequested(name);
+  }
+  return are_unchanged;
+}
+
 SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   utils::impl::AssertStaticRegistrationFinished();
   user_configs_.resize(Registry().size());
+  updated_.resize(Registry().size(), false);
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    const auto id = config_variable.GetId();
+    user_configs_[id] = MakeEntry(config_variable.GetValue());
+    updated_[id] = true;
   }
 }
 
@@ -46,28 +87,102 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
-  for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
-      user_configs_[id] = factory(defaults);
+      Parse(id, defaults);
     }
   }
 }
 
 SnapshotData::SnapshotData(const SnapshotData& defaults,
                            const std::vector<KeyValue>& overrides)
-    : user_configs_(defaults.user_configs_) {
+    : user_configs_(defaults.user_configs_),
+      updated_(user_configs_.size(), false) {
   for (const auto& config_variable : overrides) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    const auto id = config_variable.GetId();
+    user_configs_[id] = MakeEntry(config_variable.GetValue());
+    updated_[id] = true;
+  }
+
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    if (user_configs_[id] && !updated_[id]) ++reused_count_;
+  }
+}
+
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const SnapshotData& previous,
+                           const DocsMap& previous_docs_map)
+    : user_configs_(previous.user_configs_),
+      updated_(user_configs_.size(), false) {
+  UASSERT(user_configs_.size() == Registry().size());
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    const auto& entry = user_configs_[id];
+    const bool is_up_to_date =
+        entry && entry->is_parsed &&
+        AreDocsUnchanged(entry->docs, docs_map, previous_docs_map);
+
+    if (is_up_to_date) {
+      ++reused_count_;
+    } else {
+      relax.Relax(1);
+      Parse(id, docs_map);
+    }
   }
 }
 
+bool SnapshotData::HasUpdates(const std::vector<ConfigId>& ids) const {
+  return std::any_of(ids.begin(), ids.end(), [this](ConfigId id) {
+    return id < updated_.size() && updated_[id];
+  });
+}
+
+std::chrono::microseconds SnapshotData::GetParseDuration(ConfigId id) const {
+  UASSERT(id < user_configs_.size());
+  const auto& entry = user_configs_[id];
+  return entry ? entry->parse_duration : std::chrono::microseconds{0};
+}
+
+std::shared_ptr<const SnapshotData::Entry> SnapshotData::MakeEntry(
+    std::any value) {
+  auto entry = std::make_shared<Entry>();
+  entry->value = std::move(value);
+  return entry;
+}
+
 const std::any& SnapshotData::Get(impl::ConfigId id) const {
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config || !config->value.has_value()) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return config->value;
+}
+
+void SnapshotData::Parse(ConfigId id, const DocsMap& docs_map) {
+  auto entry = std::make_shared<Entry>();
+
+  {
+    docs_map.SetRequestsRecorder(&entry->docs);
+    utils::ScopeGuard recorder_reset(
+        [&docs_map] { docs_map.SetRequestsRecorder(nullptr); });
+
+    const auto start = std::chrono::steady_clock::now();
+    entry->value = Registry()[id].factory(docs_map);
+    entry->parse_duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+  }
+
+  auto& docs = entry->docs;
+  std::sort(docs.begin(), docs.end());
+  docs.erase(std::unique(docs.begin(), docs.end()), docs.end());
+  entry->is_parsed = true;
+
+  user_configs_[id] = std::move(entry);
+  updated_[id] = true;
+  ++parsed_count_;
 }
 
 }  // namespace dynamic_config::impl
@@ -19,6 +19,18 @@ concurrent::AsyncEventSubscriberScope Source::DoUpdateAndListen(
                                              [&] { func_copy(GetSnapshot()); });
 }
 
+concurrent::AsyncEventSubscriberScope Source::DoUpdateAndListen(
+    concurrent::FunctionId id, std::string_view name,
+    EventSource::Function&& func, std::vector<impl::ConfigId> ids) {
+  auto func_copy = func;
+  auto filtered_func = [func = std::move(func),
+                        ids = std::move(ids)](const Snapshot& config) {
+    if (config.GetData().HasUpdates(ids)) func(config);
+  };
+  return storage_->channel.DoUpdateAndListen(id, name, std::move(filtered_func),
+                                             [&] { func_copy(GetSnapshot()); });
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
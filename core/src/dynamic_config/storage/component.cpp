@@ -8,6 +8,7 @@
 #include <fmt/format.h>
 
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/mutex.hpp>
@@ -15,6 +16,8 @@
 #include <userver/fs/write.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/metadata.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <dynamic_config/storage_data.hpp>
@@ -47,6 +50,7 @@ void CheckRegistered(bool registered) {
 class DynamicConfig::Impl final {
  public:
   Impl(const ComponentConfig&, const ComponentContext&);
+  ~Impl();
 
   dynamic_config::Source GetSource();
   auto& GetChannel() { return cache_.channel; }
@@ -67,9 +71,15 @@ class DynamicConfig::Impl final {
   void ReadFsCache();
   void WriteFsCache(const dynamic_config::DocsMap&);
 
+  formats::json::Value ExtendStatistics() const;
+
   dynamic_config::impl::StorageData cache_{
       dynamic_config::impl::SnapshotData{{}}};
 
+  // The docs `cache_` was built from. Updates are serialized, because only a
+  // single updater may be active.
+  dynamic_config::DocsMap docs_map_;
+
   const std::string fs_cache_path_;
   engine::TaskProcessor* fs_task_processor_;
   std::string fs_loading_error_msg_;
@@ -78,6 +88,11 @@ class DynamicConfig::Impl final {
   mutable engine::Mutex loaded_mutex_;
   mutable engine::ConditionVariable loaded_cv_;
   bool config_load_cancelled_{false};
+
+  std::atomic<std::uint64_t> updates_{0};
+  std::atomic<std::uint64_t> parsed_keys_{0};
+  std::atomic<std::uint64_t> reused_keys_{0};
+  utils::statistics::Entry statistics_holder_;
 };
 
 DynamicConfig::Impl::Impl(const ComponentConfig& config,
@@ -109,9 +124,16 @@ DynamicConfig::Impl::Impl(const ComponentConfig& config,
                          "config: {}",
                          fmt::join(AllConfigUpdaters(), ", ")));
 
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = statistics_storage.RegisterExtender(
+      std::string{kName}, [this](const auto&) { return ExtendStatistics(); });
+
   ReadFsCache();
 }
 
+DynamicConfig::Impl::~Impl() { statistics_holder_.Unregister(); }
+
 dynamic_config::Source DynamicConfig::Impl::GetSource() {
   WaitUntilLoaded();
   return dynamic_config::Source{cache_};
@@ -153,7 +175,19 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
-  auto config = dynamic_config::impl::SnapshotData(value, {});
+  // Only the configs that depend on the changed docs are parsed again
+  const auto previous = cache_.config.Read();
+  auto config =
+      dynamic_config::impl::SnapshotData(value, *previous, docs_map_);
+  docs_map_ = value;
+
+  LOG_DEBUG() << "Dynamic config snapshot is built, parsed "
+              << config.GetParsedCount() << " configs, reused "
+              << config.GetReusedCount();
+  ++updates_;
+  parsed_keys_ += config.GetParsedCount();
+  reused_keys_ += config.GetReusedCount();
+
   {
     std::lock_guard lock(loaded_mutex_);
     cache_.config.Assign(std::move(config));
@@ -244,6 +278,24 @@ void DynamicConfig::Impl::WriteFsCache(
   }
 }
 
+formats::json::Value DynamicConfig::Impl::ExtendStatistics() const {
+  formats::json::ValueBuilder result;
+  result["updates"] = updates_.load();
+  result["parsed-keys"] = parsed_keys_.load();
+  result["reused-keys"] = reused_keys_.load();
+
+  const auto snapshot = cache_.config.Read();
+  formats::json::ValueBuilder parse_times(formats::json::Type::kObject);
+  for (dynamic_config::impl::ConfigId id = 0; id < snapshot->Size(); ++id) {
+    parse_times[dynamic_config::impl::GetKeyName(id)] =
+        snapshot->GetParseDuration(id).count();
+  }
+  utils::statistics::SolomonChildrenAreLabelValues(parse_times, "config_key");
+  result["last-parse-time-us"] = std::move(parse_times);
+
+  return result.ExtractValue();
+}
+
 DynamicConfig::NoblockSubscriber::NoblockSubscriber(
     DynamicConfig& config_component) noexcept
     : config_component_(config_component) {}
@@ -11,12 +11,15 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(const std::string& name) const {
+  // a missing doc is a dependency too: the parser may fall back to a default
+  // and has to be rerun once the doc appears
+  requested_names_.insert(name);
+  if (requests_recorder_) requests_recorder_->push_back(name);
+
   const auto it = docs_.find(name);
   if (it == docs_.end()) {
     throw std::runtime_error("Can't find doc for '" + name + "'");
   }
-
-  requested_names_.insert(name);
   return it->second;
 }
 
@@ -78,6 +81,23 @@ bool DocsMap::AreContentsEqual(const DocsMap& other) const {
   return docs_ == other.docs_;
 }
 
+bool DocsMap::IsDocEqual(const std::string& name, const DocsMap& other) const {
+  const auto it = docs_.find(name);
+  const auto other_it = other.docs_.find(name);
+  if (it == docs_.end() || other_it == other.docs_.end()) {
+    return it == docs_.end() && other_it == other.docs_.end();
+  }
+  return it->second == other_it->second;
+}
+
+void DocsMap::SetRequestsRecorder(std::vector<std::string>* recorder) const {
+  requests_recorder_ = recorder;
+}
+
+void DocsMap::MarkRequested(const std::string& name) const {
+  requested_names_.insert(name);
+}
+
 const std::string kValueDictDefaultName = "__default__";
 
 }  // namespace dynamic_config
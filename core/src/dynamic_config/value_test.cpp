@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include <boost/range/adaptor/map.hpp>
 
+#include <userver/dynamic_config/impl/snapshot.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(DocsMap, AreContentsEqualTrue) {
@@ -29,6 +32,75 @@ TEST(DocsMap, AreContentsEqualFalse) {
   EXPECT_FALSE(docs_map1.AreContentsEqual(docs_map2));
 }
 
+TEST(DocsMap, IsDocEqual) {
+  dynamic_config::DocsMap docs_map1;
+  docs_map1.Parse(R"({"a": "a", "b": "b", "c": "c"})", false);
+
+  dynamic_config::DocsMap docs_map2;
+  docs_map2.Parse(R"({"a": "a", "b": "c", "d": "d"})", false);
+
+  EXPECT_TRUE(docs_map1.IsDocEqual("a", docs_map2));
+  EXPECT_FALSE(docs_map1.IsDocEqual("b", docs_map2));
+  EXPECT_FALSE(docs_map1.IsDocEqual("c", docs_map2));
+  EXPECT_FALSE(docs_map2.IsDocEqual("d", docs_map1));
+  EXPECT_TRUE(docs_map1.IsDocEqual("missing", docs_map2));
+}
+
+TEST(DocsMap, RequestsRecorder) {
+  dynamic_config::DocsMap docs_map;
+  docs_map.Parse(R"({"a": "a", "b": "b"})", false);
+
+  std::vector<std::string> recorded;
+  docs_map.SetRequestsRecorder(&recorded);
+  (void)docs_map.Get("b");
+  docs_map.SetRequestsRecorder(nullptr);
+  (void)docs_map.Get("a");
+
+  EXPECT_EQ(recorded, std::vector<std::string>{"b"});
+}
+
+TEST(DocsMap, RequestsRecorderMissingDoc) {
+  dynamic_config::DocsMap docs_map;
+  docs_map.Parse(R"({"a": "a"})", false);
+
+  std::vector<std::string> recorded;
+  docs_map.SetRequestsRecorder(&recorded);
+  EXPECT_THROW(docs_map.Get("missing"), std::runtime_error);
+  docs_map.SetRequestsRecorder(nullptr);
+  EXPECT_EQ(recorded, std::vector<std::string>{"missing"});
+
+  // a parser that has probed the missing doc is reparsed once it appears
+  dynamic_config::DocsMap new_docs_map = docs_map;
+  new_docs_map.Set("missing", formats::json::ValueBuilder{42}.ExtractValue());
+  EXPECT_FALSE(new_docs_map.IsDocEqual("missing", docs_map));
+}
+
+TEST(DocsMap, ReusedConfigsKeepDocsRequested) {
+  // the docs read by two configs on the first update
+  dynamic_config::DocsMap docs_map1;
+  docs_map1.Parse(R"({"a": 1, "b": 2, "unused": 3})", false);
+  std::vector<std::string> docs_a;
+  docs_map1.SetRequestsRecorder(&docs_a);
+  (void)docs_map1.Get("a");
+  std::vector<std::string> docs_b;
+  docs_map1.SetRequestsRecorder(&docs_b);
+  (void)docs_map1.Get("b");
+  docs_map1.SetRequestsRecorder(nullptr);
+
+  // the second update changes only "b", the config of "a" is reused
+  dynamic_config::DocsMap docs_map2;
+  docs_map2.Parse(R"({"a": 1, "b": 5, "unused": 3})", false);
+  EXPECT_TRUE(
+      dynamic_config::impl::AreDocsUnchanged(docs_a, docs_map2, docs_map1));
+  EXPECT_FALSE(
+      dynamic_config::impl::AreDocsUnchanged(docs_b, docs_map2, docs_map1));
+  (void)docs_map2.Get("b");
+
+  // with load-only-my-values, the next update fetches both of the docs
+  EXPECT_EQ(docs_map2.GetRequestedNames(),
+            (std::unordered_set<std::string>{"a", "b"}));
+}
+
 TEST(ValueDict, UseAsRange) {
   using ValueDict = dynamic_config::ValueDict<int>;
 
@@ -0,0 +1,71 @@
+#include "spin_then_park_mutex.hpp"
+
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// A few hundred nanoseconds, enough for a wait list operation
+constexpr int kSpinIterations = 128;
+
+void CpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+void Park(std::atomic<std::uint32_t>& state, std::uint32_t value) noexcept {
+#ifdef __linux__
+  // Returns immediately if the state has already changed
+  ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&state),
+            FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+#else
+  (void)state;
+  (void)value;
+  std::this_thread::yield();
+#endif
+}
+
+void UnparkOne([[maybe_unused]] std::atomic<std::uint32_t>& state) noexcept {
+#ifdef __linux__
+  ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&state),
+            FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+}  // namespace
+
+void SpinThenParkMutex::LockSlow() noexcept {
+  for (int i = 0; i < kSpinIterations; ++i) {
+    CpuRelax();
+    if (state_.load(std::memory_order_relaxed) == kUnlocked && try_lock()) {
+      return;
+    }
+  }
+
+  // See "Futexes Are Tricky" by Ulrich Drepper, mutex take 3. Once parked,
+  // the thread keeps kLockedWithParked on acquisition, as it does not know
+  // whether there are other parked threads.
+  auto state = state_.exchange(kLockedWithParked, std::memory_order_acquire);
+  while (state != kUnlocked) {
+    Park(state_, kLockedWithParked);
+    state = state_.exchange(kLockedWithParked, std::memory_order_acquire);
+  }
+}
+
+void SpinThenParkMutex::WakeUpOne() noexcept { UnparkOne(state_); }
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
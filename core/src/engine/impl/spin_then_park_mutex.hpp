@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// @brief Mutex for tiny critical sections that are entered from many threads
+///
+/// Spins for a short while and only then parks the thread in the kernel
+/// (futex on Linux, yield elsewhere). Unlike std::mutex it does not go to the
+/// kernel as long as the owner leaves the critical section within the spin
+/// budget, which is the usual case for engine wait lists.
+///
+/// Satisfies the Lockable requirements.
+class SpinThenParkMutex final {
+ public:
+  SpinThenParkMutex() noexcept = default;
+
+  SpinThenParkMutex(const SpinThenParkMutex&) = delete;
+  SpinThenParkMutex& operator=(const SpinThenParkMutex&) = delete;
+
+  void lock() noexcept {
+    if (!try_lock()) LockSlow();
+  }
+
+  bool try_lock() noexcept {
+    auto expected = kUnlocked;
+    return state_.compare_exchange_strong(expected, kLocked,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed);
+  }
+
+  void unlock() noexcept {
+    if (state_.exchange(kUnlocked, std::memory_order_release) ==
+        kLockedWithParked) {
+      WakeUpOne();
+    }
+  }
+
+ private:
+  static constexpr std::uint32_t kUnlocked = 0;
+  static constexpr std::uint32_t kLocked = 1;
+  static constexpr std::uint32_t kLockedWithParked = 2;
+
+  void LockSlow() noexcept;
+  void WakeUpOne() noexcept;
+
+  std::atomic<std::uint32_t> state_{kUnlocked};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
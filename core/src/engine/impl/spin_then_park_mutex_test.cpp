@@ -0,0 +1,58 @@
+#include <engine/impl/spin_then_park_mutex.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(SpinThenParkMutex, TryLock) {
+  engine::impl::SpinThenParkMutex mutex;
+  EXPECT_TRUE(mutex.try_lock());
+  EXPECT_FALSE(mutex.try_lock());
+  mutex.unlock();
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+TEST(SpinThenParkMutex, Contention) {
+  constexpr std::size_t kThreads = 8;
+  constexpr std::size_t kIterations = 100000;
+
+  engine::impl::SpinThenParkMutex mutex;
+  std::size_t counter = 0;
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        std::lock_guard lock(mutex);
+        ++counter;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(kThreads * kIterations, counter);
+}
+
+TEST(SpinThenParkMutex, LongCriticalSection) {
+  engine::impl::SpinThenParkMutex mutex;
+  std::unique_lock lock(mutex);
+
+  std::thread waiter([&] {
+    // Runs out of the spin budget and parks
+    std::lock_guard waiter_lock(mutex);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  lock.unlock();
+  waiter.join();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/impl/spin_then_park_mutex.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -26,7 +27,7 @@ class WaitList final {
     void unlock() { impl_.unlock(); }
 
    private:
-    std::unique_lock<std::mutex> impl_;
+    std::unique_lock<SpinThenParkMutex> impl_;
   };
 
   // This guard is used to optimize the hot path of unlocking:
@@ -74,7 +75,9 @@ class WaitList final {
 
  private:
   std::atomic<std::size_t> sleepies_{0};
-  std::mutex mutex_;
+  // Critical sections are a few pointer updates long, so contending threads
+  // spin instead of going to the kernel
+  SpinThenParkMutex mutex_;
 
   struct List;
   static constexpr std::size_t kListSize = sizeof(void*) * 2;
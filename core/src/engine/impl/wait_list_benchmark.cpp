@@ -143,7 +143,7 @@ void wait_list_add_remove_contention(benchmark::State& state) {
 }
 BENCHMARK(wait_list_add_remove_contention)
     ->RangeMultiplier(2)
-    ->Range(1, 2)
+    ->Range(1, 16)
     ->UseRealTime();
 
 void wait_list_add_remove_contention_unbalanced(benchmark::State& state) {
@@ -188,7 +188,7 @@ void wait_list_add_remove_contention_unbalanced(benchmark::State& state) {
 // minutes on a modern CPU.
 //
 // That happened because each thread of the benchmark locks and unlocks the same
-// std::mutex in a rapid succession. Most of the times, the thread, which
+// mutex in a rapid succession. Most of the times, the thread, which
 // previously owned the mutex, just re-locks it again without giving the other
 // threads an opportunity to work on the WaitList. On top of it, for a benchmark
 // iteration to complete, the rare ownership switch is required to have occurred
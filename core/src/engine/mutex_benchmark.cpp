@@ -11,6 +11,8 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/rand.hpp>
 
+#include <engine/impl/spin_then_park_mutex.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -65,6 +67,11 @@ struct PoolForImpl<std::mutex> {
   using Pool = ThreadPool;
 };
 
+template <>
+struct PoolForImpl<engine::impl::SpinThenParkMutex> {
+  using Pool = ThreadPool;
+};
+
 template <>
 struct PoolForImpl<engine::Mutex> {
   using Pool = AsyncCoroPool;
@@ -223,6 +230,10 @@ void mutex_std_lock(benchmark::State& state) {
   generic_lock<std::mutex>(state);
 }
 
+void mutex_spin_park_lock(benchmark::State& state) {
+  generic_lock<engine::impl::SpinThenParkMutex>(state);
+}
+
 void mutex_coro_unlock(benchmark::State& state) {
   engine::RunStandalone([&] { generic_unlock<engine::Mutex>(state); });
 }
@@ -231,6 +242,10 @@ void mutex_std_unlock(benchmark::State& state) {
   generic_lock<std::mutex>(state);
 }
 
+void mutex_spin_park_unlock(benchmark::State& state) {
+  generic_unlock<engine::impl::SpinThenParkMutex>(state);
+}
+
 void mutex_coro_contention(benchmark::State& state) {
   engine::RunStandalone(state.range(0),
                         [&] { generic_contention<engine::Mutex>(state); });
@@ -240,6 +255,10 @@ void mutex_std_contention(benchmark::State& state) {
   generic_contention<std::mutex>(state);
 }
 
+void mutex_spin_park_contention(benchmark::State& state) {
+  generic_contention<engine::impl::SpinThenParkMutex>(state);
+}
+
 void mutex_coro_contention_with_payload(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     generic_contention_with_payload<engine::Mutex>(state);
@@ -250,18 +269,28 @@ void mutex_std_contention_with_payload(benchmark::State& state) {
   generic_contention_with_payload<std::mutex>(state);
 }
 
+void mutex_spin_park_contention_with_payload(benchmark::State& state) {
+  generic_contention_with_payload<engine::impl::SpinThenParkMutex>(state);
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
 BENCHMARK(mutex_std_lock);
+BENCHMARK(mutex_spin_park_lock);
 
 BENCHMARK(mutex_coro_unlock);
 BENCHMARK(mutex_std_unlock);
+BENCHMARK(mutex_spin_park_unlock);
 
 BENCHMARK(mutex_coro_contention)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(mutex_spin_park_contention)->RangeMultiplier(2)->Range(1, 32);
 
 BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(mutex_spin_park_contention_with_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
 
 USERVER_NAMESPACE_END
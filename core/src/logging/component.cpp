@@ -11,13 +11,14 @@
 
 #include <fmt/format.h>
 
-#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
 #include <logging/logger_with_info.hpp>
 #include <logging/reopening_file_sink.hpp>
+#include <logging/ring_buffer_logger.hpp>
 #include <logging/spdlog_helpers.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/logging/format.hpp>
@@ -25,7 +26,8 @@
 #include <userver/logging/logger.hpp>
 #include <userver/os_signals/component.hpp>
 #include <userver/utils/algo.hpp>
-#include <userver/utils/thread_name.hpp>
+#include <userver/utils/statistics/metadata.hpp>
+#include <userver/utils/statistics/percentile_format_json.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include "config.hpp"
@@ -103,28 +105,57 @@ std::shared_ptr<logging::impl::LoggerWithInfo> CreateAsyncLogger(
     return logging::MakeStdoutLogger(logger_name, logger_config.format,
                                      logger_config.level);
 
-  auto overflow_policy = spdlog::async_overflow_policy::overrun_oldest;
+  auto overflow_behavior =
+      logging::impl::RingBufferLogger::OverflowBehavior::kDiscard;
   if (logger_config.queue_overflow_behavior ==
       logging::LoggerConfig::QueueOveflowBehavior::kBlock) {
-    overflow_policy = spdlog::async_overflow_policy::block;
+    overflow_behavior =
+        logging::impl::RingBufferLogger::OverflowBehavior::kBlock;
   }
 
   CreateLogDirectory(logger_name, logger_config.file_path);
 
   auto file_sink =
       std::make_shared<logging::ReopeningFileSinkMT>(logger_config.file_path);
-  auto tp = std::make_shared<spdlog::details::thread_pool>(
-      logger_config.message_queue_size, logger_config.thread_pool_size);
 
-  auto old_thread_name = utils::GetCurrentThreadName();
-  utils::SetCurrentThreadName("log/" + logger_name);
-
-  utils::SetCurrentThreadName(old_thread_name);
+  auto ring_logger = utils::MakeSharedRef<logging::impl::RingBufferLogger>(
+      logger_name, std::move(file_sink), logger_config.message_queue_size,
+      overflow_behavior);
+  auto* record_writer =
+      logger_config.structured_records ? &*ring_logger : nullptr;
 
   return std::make_shared<logging::impl::LoggerWithInfo>(
-      logger_config.format, tp,
-      utils::MakeSharedRef<spdlog::async_logger>(
-          logger_name, std::move(file_sink), tp, overflow_policy));
+      logger_config.format, std::move(ring_logger), record_writer);
+}
+
+formats::json::Value GetLoggerStatistics(
+    const logging::impl::LoggerWithInfo& logger) {
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  const auto* ring_logger =
+      dynamic_cast<const logging::impl::RingBufferLogger*>(&*logger.ptr);
+  if (!ring_logger) return result.ExtractValue();
+
+  result["total"]["written"] = ring_logger->GetWrittenCount();
+  result["total"]["dropped"] = ring_logger->GetDroppedCount();
+  result["thread-queues"] = ring_logger->GetRingsCount();
+  result["queue-latency-us"]["1min"] =
+      utils::statistics::PercentileToJson(ring_logger->GetQueueLatency());
+  utils::statistics::SolomonSkip(result["queue-latency-us"]["1min"]);
+
+  for (const auto& sink : ring_logger->sinks()) {
+    const auto* file_sink =
+        dynamic_cast<const logging::ReopeningFileSinkMT*>(sink.get());
+    if (!file_sink) continue;
+
+    const auto stats = file_sink->GetStatistics();
+    result["file"]["written-bytes"] = stats.written_bytes;
+    result["file"]["writes"] = stats.writes;
+    result["file"]["errors"] = stats.errors;
+    result["file"]["write-latency-us"]["1min"] =
+        utils::statistics::PercentileToJson(stats.write_latency);
+    utils::statistics::SolomonSkip(result["file"]["write-latency-us"]["1min"]);
+  }
+  return result.ExtractValue();
 }
 
 }  // namespace
@@ -223,6 +254,16 @@ Logging::Logging(const ComponentConfig& config, const ComponentContext& context)
       }
     }
   }
+
+  auto* statistics_storage =
+      context.FindComponentOptional<components::StatisticsStorage>();
+  if (statistics_storage) {
+    statistics_holder_ = statistics_storage->GetStorage().RegisterExtender(
+        "logger", [this](const auto& request) {
+          return ExtendStatistics(request);
+        });
+  }
+
   flush_task_.Start("log_flusher",
                     utils::PeriodicTask::Settings(
                         std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -235,6 +276,7 @@ Logging::~Logging() {
   /// [Signals sample - destr]
   signal_subscriber_.Unsubscribe();
   /// [Signals sample - destr]
+  statistics_holder_.Unregister();
   flush_task_.Stop();
 }
 
@@ -296,6 +338,17 @@ void Logging::FlushLogs() {
   }
 }
 
+formats::json::Value Logging::ExtendStatistics(
+    const utils::statistics::StatisticsRequest& /*request*/) {
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  result["default"] = GetLoggerStatistics(*logging::DefaultLogger());
+  for (const auto& [name, logger] : loggers_) {
+    result[name] = GetLoggerStatistics(*logger);
+  }
+  utils::statistics::SolomonChildrenAreLabelValues(result, "logger");
+  return result.ExtractValue();
+}
+
 yaml_config::Schema Logging::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<impl::ComponentBase>(R"(
 type: object
@@ -329,14 +382,15 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - json
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
                     defaultDescription: warning
                 message_queue_size:
                     type: integer
-                    description: the size of internal message queue, must be a power of 2
-                    defaultDescription: 65536
+                    description: the size of a per-thread message queue, must be a power of 2
+                    defaultDescription: 4096
                 overflow_behavior:
                     type: string
                     description: "message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue"
@@ -344,6 +398,10 @@ properties:
                     enum:
                       - discard
                       - block
+                structured_records:
+                    type: boolean
+                    description: capture messages without formatting them, the formatting is done by the logger thread
+                    defaultDescription: false
                 testsuite-capture:
                     type: object
                     description: if exists, setups additional TCP log sink for testing purposes
@@ -44,7 +44,8 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
 
   config.message_queue_size = value["message_queue_size"].As<size_t>(
       LoggerConfig::kDefaultMessageQueueSize);
-  if (config.message_queue_size & (config.message_queue_size - 1)) {
+  if (!config.message_queue_size ||
+      (config.message_queue_size & (config.message_queue_size - 1))) {
     throw std::runtime_error("log message queue size must be a power of 2");
   }
 
@@ -52,8 +53,7 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
       value["overflow_behavior"].As<LoggerConfig::QueueOveflowBehavior>(
           LoggerConfig::QueueOveflowBehavior::kDiscard);
 
-  config.thread_pool_size = value["thread_pool_size"].As<size_t>(
-      LoggerConfig::kDefaultThreadPoolSize);
+  config.structured_records = value["structured_records"].As<bool>(false);
 
   return config;
 }
@@ -13,8 +13,7 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 struct LoggerConfig {
-  static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
-  static constexpr size_t kDefaultThreadPoolSize = 1;
+  static constexpr size_t kDefaultMessageQueueSize = 1 << 12;
 
   enum class QueueOveflowBehavior { kDiscard, kBlock };
 
@@ -24,11 +23,12 @@ struct LoggerConfig {
   std::string pattern;  // deprecated
   Level flush_level = Level::kWarning;
 
-  // must be a power of 2
+  // per-thread queue size, must be a power of 2
   size_t message_queue_size = kDefaultMessageQueueSize;
   QueueOveflowBehavior queue_overflow_behavior = QueueOveflowBehavior::kDiscard;
 
-  size_t thread_pool_size = kDefaultThreadPoolSize;
+  // messages are formatted by the writer thread of the logger
+  bool structured_records = false;
 };
 
 LoggerConfig Parse(const yaml_config::YamlConfig& value,
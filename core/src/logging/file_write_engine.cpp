@@ -0,0 +1,246 @@
+#include <logging/file_write_engine.hpp>
+
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// Chunks are gathered into a single writev by this many
+constexpr std::size_t kMaxIovecs = 64;
+
+// Files keep this many written chunks to reuse their buffers
+constexpr std::size_t kMaxSpareChunks = 4;
+
+// Chunks larger than that are not reused
+constexpr std::size_t kMaxSpareChunkCapacity = 1 << 20;
+
+fs::blocking::FileDescriptor OpenForAppend(const std::string& path,
+                                           bool truncate) {
+  fs::blocking::OpenMode mode{fs::blocking::OpenFlag::kWrite,
+                              fs::blocking::OpenFlag::kCreateIfNotExists,
+                              fs::blocking::OpenFlag::kAppend};
+  if (truncate) mode |= fs::blocking::OpenFlag::kTruncate;
+
+  using Perms = boost::filesystem::perms;
+  return fs::blocking::FileDescriptor::Open(
+      path, mode,
+      Perms::owner_read | Perms::owner_write | Perms::group_read |
+          Perms::others_read);
+}
+
+}  // namespace
+
+std::shared_ptr<FileWriteEngine> FileWriteEngine::GetShared() {
+  static std::mutex mutex;
+  static std::weak_ptr<FileWriteEngine> shared;
+
+  std::lock_guard lock(mutex);
+  auto engine = shared.lock();
+  if (!engine) {
+    engine = std::make_shared<FileWriteEngine>();
+    shared = engine;
+  }
+  return engine;
+}
+
+FileWriteEngine::FileWriteEngine() {
+  writer_ = std::thread([this] {
+    utils::SetCurrentThreadName("log/file-writer");
+    WriterLoop();
+  });
+}
+
+FileWriteEngine::~FileWriteEngine() {
+  {
+    std::lock_guard lock(mutex_);
+    UASSERT_MSG(files_.empty(), "Files hold the engine alive");
+    stop_ = true;
+  }
+  writer_cv_.notify_one();
+  writer_.join();
+}
+
+void FileWriteEngine::WriterLoop() {
+  std::vector<Batch> batches;
+
+  std::unique_lock lock(mutex_);
+  while (true) {
+    writer_cv_.wait(lock, [this] { return has_queued_ || stop_; });
+    if (!has_queued_) break;
+    has_queued_ = false;
+
+    for (auto* file : files_) {
+      if (file->queued_.empty()) continue;
+      auto& batch = batches.emplace_back();
+      batch.file = file;
+      batch.generation = file->queued_generation_;
+      batch.chunks.swap(file->queued_);
+    }
+
+    lock.unlock();
+    for (auto& batch : batches) {
+      try {
+        batch.file->WriteChunks(batch.chunks);
+      } catch (const std::exception&) {
+        batch.error = std::current_exception();
+      }
+    }
+    lock.lock();
+
+    for (auto& batch : batches) {
+      auto& file = *batch.file;
+      file.written_generation_ = batch.generation;
+      if (batch.error) file.error_ = std::move(batch.error);
+
+      for (auto& chunk : batch.chunks) {
+        if (file.spare_.size() >= kMaxSpareChunks) break;
+        if (chunk.capacity() > kMaxSpareChunkCapacity) continue;
+        chunk.clear();
+        file.spare_.push_back(std::move(chunk));
+      }
+    }
+    batches.clear();
+    written_cv_.notify_all();
+  }
+}
+
+FileWriteEngine::File::File(std::shared_ptr<FileWriteEngine> engine,
+                            std::string path)
+    : engine_(std::move(engine)),
+      path_(std::move(path)),
+      fd_(OpenForAppend(path_, /*truncate=*/false)) {
+  UASSERT(engine_);
+  std::lock_guard lock(engine_->mutex_);
+  engine_->files_.push_back(this);
+}
+
+FileWriteEngine::File::~File() {
+  std::unique_lock lock(engine_->mutex_);
+  engine_->written_cv_.wait(
+      lock, [this] { return written_generation_ == queued_generation_; });
+  auto& files = engine_->files_;
+  files.erase(std::remove(files.begin(), files.end(), this), files.end());
+}
+
+std::size_t FileWriteEngine::File::GetSize() const {
+  std::lock_guard lock(io_mutex_);
+  return fd_.GetSize();
+}
+
+void FileWriteEngine::File::Write(std::string& chunk) {
+  if (chunk.empty()) return;
+
+  {
+    std::lock_guard lock(engine_->mutex_);
+    queued_.push_back(std::move(chunk));
+    ++queued_generation_;
+    engine_->has_queued_ = true;
+
+    chunk.clear();
+    if (!spare_.empty()) {
+      chunk.swap(spare_.back());
+      spare_.pop_back();
+    }
+  }
+  engine_->writer_cv_.notify_one();
+}
+
+void FileWriteEngine::File::Flush() {
+  WaitWritten();
+
+  std::exception_ptr error;
+  {
+    std::lock_guard lock(engine_->mutex_);
+    error = std::exchange(error_, nullptr);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void FileWriteEngine::File::Reopen(bool truncate) {
+  WaitWritten();
+
+  auto fd = OpenForAppend(path_, truncate);
+  std::lock_guard lock(io_mutex_);
+  // the old file is closed by the temporary
+  std::swap(fd_, fd);
+}
+
+FileWriteEngine::File::Statistics FileWriteEngine::File::GetStatistics()
+    const {
+  Statistics result;
+  result.written_bytes = written_bytes_.load(std::memory_order_relaxed);
+  result.writes = writes_.load(std::memory_order_relaxed);
+  result.errors = errors_.load(std::memory_order_relaxed);
+  result.write_latency = write_latency_.GetStatsForPeriod();
+  return result;
+}
+
+void FileWriteEngine::File::WaitWritten() {
+  std::unique_lock lock(engine_->mutex_);
+  const auto generation = queued_generation_;
+  engine_->written_cv_.wait(
+      lock, [&] { return written_generation_ >= generation; });
+}
+
+void FileWriteEngine::File::WriteChunks(std::vector<std::string>& chunks) {
+  std::lock_guard lock(io_mutex_);
+  auto& latency = write_latency_.GetCurrentCounter();
+
+  std::array<::iovec, kMaxIovecs> iovecs{};
+  std::size_t next_chunk = 0;
+  while (next_chunk < chunks.size()) {
+    std::size_t count = 0;
+    for (; count < iovecs.size() && next_chunk < chunks.size(); ++next_chunk) {
+      auto& chunk = chunks[next_chunk];
+      iovecs[count++] = {chunk.data(), chunk.size()};
+    }
+
+    auto* iov = iovecs.data();
+    while (count > 0) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto written =
+          ::writev(fd_.GetNative(), iov, static_cast<int>(count));
+      if (written < 0) {
+        const int code = errno;
+        if (code == EINTR) continue;
+        errors_.fetch_add(1, std::memory_order_relaxed);
+        throw std::system_error(code, std::generic_category(),
+                                "writing to '" + path_ + "'");
+      }
+      latency.Account(std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count());
+      writes_.fetch_add(1, std::memory_order_relaxed);
+      written_bytes_.fetch_add(written, std::memory_order_relaxed);
+
+      // skip the written buffers, the write may be partial
+      auto left = static_cast<std::size_t>(written);
+      while (count > 0 && left >= iov->iov_len) {
+        left -= iov->iov_len;
+        ++iov;
+        --count;
+      }
+      if (count > 0) {
+        iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+        iov->iov_len -= left;
+      }
+    }
+  }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
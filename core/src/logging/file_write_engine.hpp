@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Writer thread shared by the log files.
+///
+/// Files hand over chunks of formatted messages without waiting, the writer
+/// thread writes all of the queued chunks of a file with a single `writev`.
+/// Chunks of all the files that are queued at the same time are written in
+/// one round, so the busy loggers do not spend their own threads in write
+/// calls.
+class FileWriteEngine final {
+ public:
+  // Microseconds up to ~1 second with 3% precision
+  using Histogram =
+      utils::statistics::LogLinearHistogram</*precision_bits=*/5,
+                                            /*max_value_bits=*/20>;
+
+  class File;
+
+  /// Returns the engine of the process, starts a new one if there is none
+  static std::shared_ptr<FileWriteEngine> GetShared();
+
+  FileWriteEngine();
+
+  FileWriteEngine(const FileWriteEngine&) = delete;
+  FileWriteEngine& operator=(const FileWriteEngine&) = delete;
+
+  ~FileWriteEngine();
+
+ private:
+  struct Batch {
+    File* file{nullptr};
+    std::uint64_t generation{0};
+    std::vector<std::string> chunks;
+    std::exception_ptr error;
+  };
+
+  void WriterLoop();
+
+  // protects the queues of the files and the list of files
+  std::mutex mutex_;
+  std::condition_variable writer_cv_;
+  std::condition_variable written_cv_;
+  std::vector<File*> files_;
+  bool has_queued_{false};
+  bool stop_{false};
+
+  std::thread writer_;
+};
+
+/// @brief A file opened for appending, written by the FileWriteEngine
+/// @note Write(), Flush() and Reopen() of a single file should not be called
+/// concurrently.
+class FileWriteEngine::File final {
+ public:
+  struct Statistics {
+    std::uint64_t written_bytes{0};
+    std::uint64_t writes{0};
+    std::uint64_t errors{0};
+    /// Duration of a `writev` call in microseconds, for the last minute
+    Histogram write_latency;
+  };
+
+  /// @brief Opens the file, creating it if it does not exist
+  /// @throws std::system_error
+  File(std::shared_ptr<FileWriteEngine> engine, std::string path);
+
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+
+  /// Waits for the queued chunks to be written
+  ~File();
+
+  /// Size of the file, including the data written by the other processes
+  std::size_t GetSize() const;
+
+  /// Queues the chunk for writing and replaces it with an empty buffer,
+  /// possibly with a capacity reserved
+  void Write(std::string& chunk);
+
+  /// @brief Waits until all of the queued chunks are written
+  /// @throws std::system_error if a write has failed since the last Flush()
+  void Flush();
+
+  /// @brief Writes out the queued chunks and opens the file by its path again
+  /// @throws std::system_error
+  void Reopen(bool truncate);
+
+  Statistics GetStatistics() const;
+
+ private:
+  friend class FileWriteEngine;
+
+  void WaitWritten();
+  void WriteChunks(std::vector<std::string>& chunks);
+
+  const std::shared_ptr<FileWriteEngine> engine_;
+  const std::string path_;
+
+  // protects fd_ from a concurrent write and reopen
+  mutable std::mutex io_mutex_;
+  fs::blocking::FileDescriptor fd_;
+
+  // protected by engine_->mutex_
+  std::vector<std::string> queued_;
+  std::vector<std::string> spare_;
+  std::uint64_t queued_generation_{0};
+  std::uint64_t written_generation_{0};
+  std::exception_ptr error_;
+
+  std::atomic<std::uint64_t> written_bytes_{0};
+  std::atomic<std::uint64_t> writes_{0};
+  std::atomic<std::uint64_t> errors_{0};
+  utils::statistics::RecentPeriod<Histogram, Histogram,
+                                  utils::datetime::SteadyClock>
+      write_latency_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <logging/file_write_engine.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using logging::impl::FileWriteEngine;
+
+}  // namespace
+
+TEST(FileWriteEngine, WritesFromSeveralFiles) {
+  constexpr std::size_t kFiles = 3;
+  constexpr std::size_t kChunks = 1000;
+
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto engine = std::make_shared<FileWriteEngine>();
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kFiles; ++i) {
+    threads.emplace_back([&, i] {
+      FileWriteEngine::File file{engine,
+                                 dir.GetPath() + "/" + std::to_string(i)};
+      std::string chunk;
+      for (std::size_t j = 0; j < kChunks; ++j) {
+        chunk = std::to_string(j) + '\n';
+        file.Write(chunk);
+        if (j % 100 == 0) file.Flush();
+      }
+      file.Flush();
+
+      const auto stats = file.GetStatistics();
+      EXPECT_EQ(stats.errors, 0u);
+      EXPECT_GE(stats.writes, 1u);
+      EXPECT_LE(stats.writes, kChunks);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  std::string expected;
+  for (std::size_t j = 0; j < kChunks; ++j) {
+    expected += std::to_string(j) + '\n';
+  }
+  for (std::size_t i = 0; i < kFiles; ++i) {
+    EXPECT_EQ(fs::blocking::ReadFileContents(dir.GetPath() + "/" +
+                                             std::to_string(i)),
+              expected);
+  }
+}
+
+TEST(FileWriteEngine, Reopen) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/log";
+  const auto rotated_path = dir.GetPath() + "/log.1";
+
+  FileWriteEngine::File file{FileWriteEngine::GetShared(), path};
+  std::string chunk = "before\n";
+  file.Write(chunk);
+
+  fs::blocking::Rename(path, rotated_path);
+  file.Reopen(/*truncate=*/false);
+  chunk = "after\n";
+  file.Write(chunk);
+  file.Flush();
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(rotated_path), "before\n");
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), "after\n");
+
+  const auto stats = file.GetStatistics();
+  EXPECT_EQ(stats.written_bytes, 13u);
+}
+
+TEST(FileWriteEngine, WritesOutOnDestruction) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/log";
+
+  {
+    FileWriteEngine::File file{FileWriteEngine::GetShared(), path};
+    std::string chunk(100000, 'a');
+    file.Write(chunk);
+  }
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), std::string(100000, 'a'));
+}
+
+USERVER_NAMESPACE_END
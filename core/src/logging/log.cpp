@@ -16,8 +16,9 @@ namespace logging {
 namespace {
 
 auto& DefaultLoggerInternal() {
+  // Read on each log record, replaced a few times on startup
   static rcu::Variable<LoggerPtr> default_logger_ptr(
-      MakeStderrLogger("default", Format::kTskv));
+      rcu::ReadMode::kThreadOwned, MakeStderrLogger("default", Format::kTskv));
   return default_logger_ptr;
 }
 
@@ -18,6 +18,7 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logger_with_info.hpp>
 #include <logging/spdlog.hpp>
+#include <logging/structured_record.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -28,6 +29,7 @@
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 #include <userver/utils/traceful_exception.hpp>
+#include <utils/thread_local_mem_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -37,53 +39,6 @@ constexpr char kPathLineSeparator = ':';
 
 namespace {
 
-template <typename T>
-class ThreadLocalMemPool {
- public:
-  static constexpr size_t kMaxSize = 1000;
-
-  template <typename... Args>
-  static std::unique_ptr<T> Pop(Args&&... args) {
-    auto& pool = GetPool();
-    if (pool.empty()) {
-      return std::make_unique<T>(std::forward<Args>(args)...);
-    }
-
-    auto& raw = pool.back();
-    // if ctor throws, memory remains in pool
-    new (raw.get()) T(std::forward<Args>(args)...);
-    // arm dtor, transfer ownership (noexcept)
-    std::unique_ptr<T> obj(reinterpret_cast<T*>(raw.release()));
-    // prune pool
-    pool.pop_back();
-    return obj;
-  }
-
-  // NOTE: Push might be called from a different thread than the one we got
-  // the object from (where the Pop() has been called). Because of this
-  // the object state must be completely torn down.
-  static void Push(std::unique_ptr<T> obj) {
-    auto& pool = GetPool();
-    if (pool.size() >= kMaxSize) return;
-
-    // disarm dtor, transfer ownership (noexcept)
-    std::unique_ptr<StorageType> raw(
-        reinterpret_cast<StorageType*>(obj.release()));
-    // call dtor (might throw)
-    reinterpret_cast<T*>(raw.get())->~T();
-    // store into pool (may throw on container allocation)
-    pool.push_back(std::move(raw));
-  }
-
- private:
-  using StorageType = std::aligned_storage_t<sizeof(T), alignof(T)>;
-
-  static auto& GetPool() {
-    thread_local std::vector<std::unique_ptr<StorageType>> pool_;
-    return pool_;
-  }
-};
-
 constexpr bool NeedsQuoteEscaping(char c) { return c == '\"' || c == '\\'; }
 
 // For the dynamic debug logging
@@ -105,10 +60,15 @@ LogHelper::LogHelper(LoggerPtr logger, Level level, std::string_view path,
     if (mode != Mode::kNoSpan) {
       LogSpan();
     }
-    LogModule(path, line, func);
-    LogIds();
+    if (pimpl_->IsStructured()) {
+      // Formatted by the logger
+      pimpl_->SetLocation(path, line, func);
+    } else {
+      LogModule(path, line, func);
+      LogIds();
+      LogTextKey();
+    }
 
-    LogTextKey();
     pimpl_->MarkTextBegin();
     // Must not log further system info after this point
 
@@ -130,7 +90,7 @@ LogHelper::LogHelper(LoggerPtr logger, Level level, std::string_view path,
 
 LogHelper::~LogHelper() {
   DoLog();
-  ThreadLocalMemPool<Impl>::Push(std::move(pimpl_));
+  utils::ThreadLocalMemPool<Impl>::Push(std::move(pimpl_));
 }
 
 constexpr size_t kSizeLimit = 10000;
@@ -141,6 +101,11 @@ bool LogHelper::IsLimitReached() const noexcept {
 
 void LogHelper::DoLog() noexcept {
   try {
+    if (pimpl_->IsStructured()) {
+      LogRecord();
+      return;
+    }
+
     AppendLogExtra();
     if (pimpl_->IsStreamInitialized()) {
       Stream().flush();
@@ -155,7 +120,7 @@ void LogHelper::DoLog() noexcept {
 std::unique_ptr<LogHelper::Impl> LogHelper::Impl::Make(LoggerPtr logger,
                                                        Level level) {
   auto new_level = logger ? AdjustLevel(level, *logger->ptr) : level;
-  return {ThreadLocalMemPool<Impl>::Pop(std::move(logger), new_level)};
+  return {utils::ThreadLocalMemPool<Impl>::Pop(std::move(logger), new_level)};
 }
 
 void LogHelper::InternalLoggingError(std::string_view message) noexcept {
@@ -185,6 +150,14 @@ void LogHelper::AppendLogExtra() {
   }
 }
 
+void LogHelper::LogRecord() {
+  impl::StructuredRecordView record;
+  for (const auto& item : *pimpl_->GetLogExtra().extra_) {
+    record.extra.emplace_back(item.first, &item.second.GetValue());
+  }
+  pimpl_->LogTheRecord(record);
+}
+
 void LogHelper::LogTextKey() {
   Put(utils::encoding::kTskvPairsSeparator);
   Put("text");
@@ -1,8 +1,13 @@
 #include "log_helper_impl.hpp"
 
+#include <pthread.h>
+
 #include <logging/spdlog.hpp>
 
+#include <engine/task/task_context.hpp>
 #include <logging/logger_with_info.hpp>
+#include <logging/ring_buffer_logger.hpp>
+#include <logging/structured_record.hpp>
 
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
@@ -19,6 +24,12 @@ class PutCharFmtBuffer final {
   void operator()(fmt::basic_memory_buffer<char, Size>& to, char ch) const {
     to.push_back(ch);
   }
+
+  template <size_t Size>
+  void Append(fmt::basic_memory_buffer<char, Size>& to, const char* first,
+              const char* last) const {
+    to.append(first, last);
+  }
 };
 
 char GetSeparatorFromLogger(const LoggerPtr& logger_ptr) {
@@ -33,12 +44,19 @@ char GetSeparatorFromLogger(const LoggerPtr& logger_ptr) {
     case Format::kRaw:
       return '=';
     case Format::kLtsv:
+    case Format::kJson:
       return ':';
   }
 
   UINVARIANT(false, "Invalid logging::Format enum value");
 }
 
+bool IsStructuredLogger(const LoggerPtr& logger_ptr) {
+  if (!logger_ptr) return false;
+  // JSON is produced only from the structured records
+  return logger_ptr->record_writer || logger_ptr->format == Format::kJson;
+}
+
 }  // namespace
 
 LogHelper::Impl::int_type LogHelper::Impl::BufferStd::overflow(int_type c) {
@@ -56,14 +74,16 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerPtr logger, Level level) noexcept
     : logger_(std::move(logger)),
       level_(level),
-      key_value_separator_(GetSeparatorFromLogger(logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(logger_)),
+      structured_(IsStructuredLogger(logger_)) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
 }
 
 std::streamsize LogHelper::Impl::xsputn(const char_type* s, std::streamsize n) {
-  switch (encode_mode_) {
+  // Structured records are escaped by the logger
+  switch (structured_ ? Encode::kNone : encode_mode_) {
     case Encode::kNone:
       msg_.append(s, s + n);
       break;
@@ -87,7 +107,7 @@ std::streamsize LogHelper::Impl::xsputn(const char_type* s, std::streamsize n) {
 LogHelper::Impl::int_type LogHelper::Impl::overflow(int_type c) {
   if (c == std::streambuf::traits_type::eof()) return c;
 
-  switch (encode_mode_) {
+  switch (structured_ ? Encode::kNone : encode_mode_) {
     case Encode::kNone:
       msg_.push_back(c);
       break;
@@ -125,6 +145,36 @@ void LogHelper::Impl::LogTheMessage() const {
   logger_->ptr->log(static_cast<spdlog::level::level_enum>(level_), message);
 }
 
+void LogHelper::Impl::LogTheRecord(impl::StructuredRecordView& record) const {
+  if (IsBroken()) {
+    return;
+  }
+
+  UASSERT(logger_);
+  UASSERT(structured_);
+  auto* task = engine::current_task::GetCurrentTaskContextUnchecked();
+
+  record.format = logger_->format;
+  record.path = path_;
+  record.line = line_;
+  record.func = func_;
+  record.task_id = reinterpret_cast<std::uint64_t>(task);
+  record.thread_id = reinterpret_cast<std::uint64_t>(pthread_self());
+  record.text = std::string_view(msg_.data(), msg_.size());
+
+  const auto level = static_cast<spdlog::level::level_enum>(level_);
+  if (logger_->record_writer) {
+    logger_->record_writer->LogRecord(level, record);
+    return;
+  }
+
+  // Synchronous loggers have no writer thread to format the record
+  if (!logger_->ptr->should_log(level)) return;
+  std::string message;
+  impl::FormatRecord(record, message);
+  logger_->ptr->log(level, std::string_view{message});
+}
+
 void LogHelper::Impl::MarkTextBegin() {
   UASSERT_MSG(initial_length_ == 0, "MarkTextBegin must only be called once");
   initial_length_ = msg_.size();
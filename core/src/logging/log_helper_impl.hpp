@@ -13,6 +13,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+namespace impl {
+struct StructuredRecordView;
+}  // namespace impl
+
 class LogHelper::Impl final {
  public:
   using char_type = std::streambuf::char_type;
@@ -34,6 +38,17 @@ class LogHelper::Impl final {
 
   LogExtra& GetLogExtra() { return extra_; }
 
+  /// The message is captured without formatting and is formatted by the
+  /// logger, the text is not escaped
+  bool IsStructured() const noexcept { return structured_; }
+
+  void SetLocation(std::string_view path, int line,
+                   std::string_view func) noexcept {
+    path_ = path;
+    line_ = line;
+    func_ = func;
+  }
+
   std::streamsize xsputn(const char_type* s, std::streamsize n);
   int_type overflow(int_type c);
 
@@ -41,6 +56,9 @@ class LogHelper::Impl final {
 
   void LogTheMessage() const;
 
+  /// Fills the rest of the record and passes it to the logger
+  void LogTheRecord(impl::StructuredRecordView& record) const;
+
   void MarkTextBegin();
   size_t TextSize() const { return msg_.size() - initial_length_; }
 
@@ -79,6 +97,11 @@ class LogHelper::Impl final {
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
   size_t initial_length_{0};
+
+  const bool structured_;
+  std::string_view path_;
+  int line_{0};
+  std::string_view func_;
 };
 
 }  // namespace logging
@@ -0,0 +1,49 @@
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST_F(LoggingJsonTest, Basic) {
+  constexpr auto kJsonTextToLog = "This is the \"JSON\" text\tto log\n";
+  LOG_INFO() << kJsonTextToLog
+             << logging::LogExtra{{"int", 42},
+                                  {"double", 0.5},
+                                  {"string", "value"},
+                                  {"with.period", "x"}};
+
+  logging::LogFlush();
+  auto str = GetStreamString();
+  ASSERT_FALSE(str.empty());
+  ASSERT_EQ(str.back(), '\n');
+  str.pop_back();
+  ASSERT_EQ(str.find('\n'), std::string::npos) << str;
+
+  const auto json = formats::json::FromString(str);
+  EXPECT_EQ(json["text"].As<std::string>(), kJsonTextToLog);
+  EXPECT_EQ(json["level"].As<std::string>(), "INFO");
+  EXPECT_TRUE(json.HasMember("timestamp"));
+  EXPECT_TRUE(json.HasMember("module"));
+  EXPECT_TRUE(json.HasMember("task_id"));
+  EXPECT_TRUE(json.HasMember("thread_id"));
+  EXPECT_EQ(json["int"].As<int>(), 42);
+  EXPECT_EQ(json["double"].As<double>(), 0.5);
+  EXPECT_EQ(json["string"].As<std::string>(), "value");
+  EXPECT_EQ(json["with.period"].As<std::string>(), "x");
+}
+
+TEST_F(LoggingJsonTest, NonFiniteNumbers) {
+  LOG_INFO() << logging::LogExtra{
+      {"inf", std::numeric_limits<double>::infinity()}};
+
+  logging::LogFlush();
+  const auto json = formats::json::FromString(GetStreamString());
+  EXPECT_EQ(json["inf"].As<std::string>(), "inf");
+}
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #include <benchmark/benchmark.h>
 
 #include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
 #include <userver/logging/logger.hpp>
 
 #include <ostream>
+#include <string>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -98,4 +100,65 @@ BENCHMARK_REGISTER_F(LogHelperBenchmark, LogStruct)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+namespace {
+
+// A JSON response body, as logged by handlers
+std::string MakeJsonBody(std::size_t size) {
+  std::string result = R"({"items":[)";
+  while (result.size() < size) {
+    result += R"({"id":"0b6e3a4c9f1d","name":"Item name","price":1234.5,)"
+              R"("tags":["first","second"],"path":"C:\\data\\file"},)";
+  }
+  result.resize(size);
+  return result;
+}
+
+// A pretty-printed body or a stacktrace with a lot of line breaks
+std::string MakeMultilineText(std::size_t size) {
+  std::string result;
+  while (result.size() < size) {
+    result += "  at handler::HandleRequestThrow(request.cpp:42)\n\t";
+  }
+  result.resize(size);
+  return result;
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogJsonBody)(benchmark::State& state) {
+  const auto msg = MakeJsonBody(state.range(0));
+  for (auto _ : state) {
+    LOG_INFO() << msg;
+  }
+  state.SetBytesProcessed(state.iterations() * msg.size());
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogJsonBody)
+    ->RangeMultiplier(4)
+    ->Range(64, 64 << 10);
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogMultilineText)
+(benchmark::State& state) {
+  const auto msg = MakeMultilineText(state.range(0));
+  for (auto _ : state) {
+    LOG_INFO() << msg;
+  }
+  state.SetBytesProcessed(state.iterations() * msg.size());
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogMultilineText)
+    ->RangeMultiplier(4)
+    ->Range(64, 64 << 10);
+
+BENCHMARK_DEFINE_F(LogHelperBenchmark, LogExtraJsonBody)
+(benchmark::State& state) {
+  const logging::LogExtra extra{{"body", MakeJsonBody(state.range(0))},
+                                {"meta_type", "/v1/items"}};
+  for (auto _ : state) {
+    LOG_INFO() << "Response" << extra;
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_REGISTER_F(LogHelperBenchmark, LogExtraJsonBody)
+    ->RangeMultiplier(4)
+    ->Range(64, 64 << 10);
+
 USERVER_NAMESPACE_END
@@ -11,18 +11,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+class RingBufferLogger;
+
 class LoggerWithInfo final {
  public:
-  LoggerWithInfo(Format format,
-                 std::shared_ptr<spdlog::details::thread_pool> thread_pool,
-                 utils::SharedRef<spdlog::logger> ptr)
-      : format(format),
-        thread_pool(std::move(thread_pool)),
-        ptr(std::move(ptr)) {}
+  LoggerWithInfo(Format format, utils::SharedRef<spdlog::logger> ptr,
+                 RingBufferLogger* record_writer = nullptr)
+      : format(format), ptr(std::move(ptr)), record_writer(record_writer) {}
 
   const Format format;
-  const std::shared_ptr<const spdlog::details::thread_pool> thread_pool;
   const utils::SharedRef<spdlog::logger> ptr;
+
+  /// If set, the messages are passed to it as structured records and are
+  /// formatted on its writer thread. Points to `*ptr`.
+  RingBufferLogger* const record_writer;
 };
 
 }  // namespace logging::impl
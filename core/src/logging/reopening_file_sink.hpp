@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -7,52 +8,84 @@
 // to override spdlog's level names
 #include <logging/spdlog.hpp>
 
-#include <spdlog/details/file_helper.h>
-#include <spdlog/details/fmt_helper.h>
 #include <spdlog/details/null_mutex.h>
+#include <spdlog/details/os.h>
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/sinks/base_sink.h>
 #include <spdlog/spdlog.h>
 #include <spdlog/version.h>
 
+#include <logging/file_write_engine.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+/// @brief File sink that collects the messages into chunks and passes them
+/// to the impl::FileWriteEngine shared by all of the file sinks.
+///
+/// Messages are written when a chunk fills up or on flush, the flush waits
+/// for the write. Reopen() writes out the messages to the old file.
 template <typename Mutex>
 class ReopeningFileSink final : public spdlog::sinks::base_sink<Mutex> {
  public:
   using filename_t = spdlog::filename_t;
   using sink = spdlog::sinks::base_sink<Mutex>;
+  using Statistics = impl::FileWriteEngine::File::Statistics;
+
+  static constexpr std::size_t kChunkSize = 64 * 1024;
 
-  ReopeningFileSink(filename_t filename) : filename_{std::move(filename)} {
-    file_helper_.open(filename_);
+  ReopeningFileSink(filename_t filename)
+      : ReopeningFileSink(std::move(filename),
+                          impl::FileWriteEngine::GetShared()) {}
 
-    if (file_helper_.size() > 0) {
-      spdlog::memory_buf_t formatted;
-      spdlog::details::fmt_helper::append_string_view("\n", formatted);
+  ReopeningFileSink(filename_t filename,
+                    std::shared_ptr<impl::FileWriteEngine> engine)
+      : file_(CreateFile(std::move(filename), std::move(engine))) {
+    chunk_.reserve(kChunkSize);
+    if (file_->GetSize() > 0) chunk_.push_back('\n');
+  }
 
-      file_helper_.write(formatted);
+  ~ReopeningFileSink() override {
+    try {
+      file_->Write(chunk_);
+    } catch (const std::exception&) {
+      // the file is destroyed with the sink anyway
     }
   }
+
   void Reopen(bool truncate) {
     std::lock_guard<Mutex> lock(this->mutex_);
-    file_helper_.reopen(truncate);
+    file_->Write(chunk_);
+    file_->Reopen(truncate);
   }
-  void Close() { file_helper_.close(); }
+
+  Statistics GetStatistics() const { return file_->GetStatistics(); }
 
  protected:
   void sink_it_(const spdlog::details::log_msg& msg) override {
-    spdlog::memory_buf_t formatted;
-    sink::formatter_->format(msg, formatted);
-    file_helper_.write(formatted);
+    formatted_.clear();
+    sink::formatter_->format(msg, formatted_);
+    chunk_.append(formatted_.data(), formatted_.size());
+    if (chunk_.size() >= kChunkSize) file_->Write(chunk_);
   }
 
-  void flush_() override { file_helper_.flush(); }
+  void flush_() override {
+    file_->Write(chunk_);
+    file_->Flush();
+  }
 
  private:
-  filename_t filename_;
-  spdlog::details::file_helper file_helper_;
+  static std::unique_ptr<impl::FileWriteEngine::File> CreateFile(
+      filename_t filename, std::shared_ptr<impl::FileWriteEngine> engine) {
+    spdlog::details::os::create_dir(spdlog::details::os::dir_name(filename));
+    return std::make_unique<impl::FileWriteEngine::File>(std::move(engine),
+                                                         std::move(filename));
+  }
+
+  const std::unique_ptr<impl::FileWriteEngine::File> file_;
+  spdlog::memory_buf_t formatted_;
+  std::string chunk_;
 };
 
 using ReopeningFileSinkST = ReopeningFileSink<spdlog::details::null_mutex>;
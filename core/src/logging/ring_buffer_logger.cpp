@@ -0,0 +1,306 @@
+#include <logging/ring_buffer_logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/sink.h>
+
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// The writer wakes up at least this often even if nobody woke it up
+constexpr std::chrono::milliseconds kMaxIdleTime{100};
+
+// Slots keep buffers of at most this size between the uses
+constexpr std::size_t kMaxRetainedPayloadSize = 1024;
+
+std::atomic<std::uint64_t> next_logger_id{1};
+
+}  // namespace
+
+class RingBufferLogger::ThreadRings final {
+ public:
+  ThreadRings() = default;
+  ThreadRings(const ThreadRings&) = delete;
+  ThreadRings& operator=(const ThreadRings&) = delete;
+
+  ~ThreadRings() {
+    for (auto& entry : entries_) {
+      entry.ring->producer_alive.store(false);
+    }
+  }
+
+  Ring* Find(std::uint64_t logger_id) {
+    for (auto& entry : entries_) {
+      if (entry.logger_id == logger_id) return entry.ring.get();
+    }
+    return nullptr;
+  }
+
+  Ring& Add(std::uint64_t logger_id, std::shared_ptr<Ring> ring) {
+    // Rings of the destroyed loggers are not needed anymore
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                  [](const Entry& entry) {
+                                    return !entry.ring->logger_alive.load();
+                                  }),
+                   entries_.end());
+    entries_.push_back({logger_id, std::move(ring)});
+    return *entries_.back().ring;
+  }
+
+ private:
+  struct Entry {
+    std::uint64_t logger_id;
+    std::shared_ptr<Ring> ring;
+  };
+
+  std::vector<Entry> entries_;
+};
+
+RingBufferLogger::RingBufferLogger(std::string name, spdlog::sink_ptr sink,
+                                   std::size_t ring_size,
+                                   OverflowBehavior overflow_behavior)
+    : spdlog::logger(std::move(name), std::move(sink)),
+      id_(next_logger_id.fetch_add(1)),
+      ring_size_(ring_size),
+      overflow_behavior_(overflow_behavior) {
+  writer_ = std::thread([this] {
+    utils::SetCurrentThreadName("log/" + name_);
+    WriterLoop();
+  });
+}
+
+RingBufferLogger::~RingBufferLogger() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+    writer_cv_.notify_one();
+  }
+  writer_.join();
+
+  std::lock_guard lock(mutex_);
+  for (auto& ring : rings_) {
+    ring->logger_alive.store(false);
+  }
+}
+
+std::uint64_t RingBufferLogger::GetWrittenCount() const {
+  return written_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RingBufferLogger::GetDroppedCount() const {
+  return dropped_.load(std::memory_order_relaxed);
+}
+
+std::size_t RingBufferLogger::GetRingsCount() const {
+  return rings_count_.load(std::memory_order_relaxed);
+}
+
+RingBufferLogger::Percentile RingBufferLogger::GetQueueLatency() const {
+  return latency_.GetStatsForPeriod();
+}
+
+void RingBufferLogger::LogRecord(spdlog::level::level_enum level,
+                                 const StructuredRecordView& record) {
+  if (!should_log(level)) return;
+
+  const auto time = spdlog::log_clock::now();
+  const auto thread_id = spdlog::details::os::thread_id();
+  Push([&](Record& slot) {
+    slot.level = level;
+    slot.time = time;
+    slot.thread_id = thread_id;
+    slot.is_structured = true;
+    Assign(slot.structured, record);
+  });
+}
+
+void RingBufferLogger::sink_it_(const spdlog::details::log_msg& msg) {
+  Push([&msg](Record& record) {
+    record.level = msg.level;
+    record.time = msg.time;
+    record.thread_id = msg.thread_id;
+    record.payload.assign(msg.payload.data(), msg.payload.size());
+    record.is_structured = false;
+  });
+}
+
+void RingBufferLogger::flush_() {
+  flush_requested_.store(true);
+  WakeUpWriter();
+}
+
+template <typename Fill>
+void RingBufferLogger::Push(const Fill& fill) {
+  auto& ring = GetThreadRing();
+  if (!ring.records.TryPush(fill)) {
+    if (overflow_behavior_ == OverflowBehavior::kDiscard) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    do {
+      WakeUpWriter();
+      std::this_thread::yield();
+    } while (!ring.records.TryPush(fill));
+  }
+  WakeUpWriter();
+}
+
+RingBufferLogger::Ring& RingBufferLogger::GetThreadRing() {
+  thread_local ThreadRings thread_rings;
+  if (auto* ring = thread_rings.Find(id_)) return *ring;
+
+  auto ring = std::make_shared<Ring>(ring_size_);
+  {
+    std::lock_guard lock(mutex_);
+    rings_.push_back(ring);
+    rings_count_.store(rings_.size(), std::memory_order_relaxed);
+  }
+  rings_changed_.store(true);
+  return thread_rings.Add(id_, std::move(ring));
+}
+
+void RingBufferLogger::WakeUpWriter() {
+  // Pairs with the fence in WriterLoop: either the writer sees the new
+  // record, or we see that it is going to sleep
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (writer_idle_.load(std::memory_order_relaxed)) {
+    std::lock_guard lock(mutex_);
+    writer_cv_.notify_one();
+  }
+}
+
+void RingBufferLogger::WriterLoop() {
+  std::vector<std::shared_ptr<Ring>> rings;
+  while (true) {
+    const bool stopping = stop_.load();
+    if (rings_changed_.exchange(false)) {
+      std::lock_guard lock(mutex_);
+      rings = rings_;
+    }
+
+    const auto drained = Drain(rings);
+    if (flush_requested_.exchange(false)) FlushSinks();
+    if (drained) continue;
+    if (stopping) break;
+
+    std::unique_lock lock(mutex_);
+    writer_idle_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool has_work =
+        stop_ || flush_requested_ || rings_changed_ ||
+        std::any_of(rings.begin(), rings.end(),
+                    [](const auto& ring) { return !ring->records.IsEmpty(); });
+    if (!has_work) writer_cv_.wait_for(lock, kMaxIdleTime);
+    writer_idle_.store(false, std::memory_order_relaxed);
+  }
+  FlushSinks();
+}
+
+std::size_t RingBufferLogger::Drain(std::vector<std::shared_ptr<Ring>>& rings) {
+  std::size_t drained = 0;
+  bool should_flush = false;
+  bool has_dead_rings = false;
+  const auto now = spdlog::log_clock::now();
+  auto& latency = latency_.GetCurrentCounter();
+
+  cursors_.clear();
+  for (const auto& ring : rings) {
+    // Read before draining, the producer may push its last records meanwhile
+    const bool producer_alive = ring->producer_alive.load();
+    const auto count = ring->records.Acquire();
+    if (count) cursors_.push_back({ring.get(), 0, count});
+    has_dead_rings = has_dead_rings || !producer_alive;
+  }
+
+  // Tasks migrate between threads, so the records of a task may be spread
+  // over several rings. The rings are merged by the record time.
+  const auto is_later = [](const Cursor& lhs, const Cursor& rhs) {
+    return lhs.ring->records.Peek(lhs.pos).time >
+           rhs.ring->records.Peek(rhs.pos).time;
+  };
+  std::make_heap(cursors_.begin(), cursors_.end(), is_later);
+  while (!cursors_.empty()) {
+    std::pop_heap(cursors_.begin(), cursors_.end(), is_later);
+    auto& cursor = cursors_.back();
+    auto& record = cursor.ring->records.Peek(cursor.pos);
+    WriteRecord(record, should_flush);
+    latency.Account(std::chrono::duration_cast<std::chrono::microseconds>(
+                        now - record.time)
+                        .count());
+    ++drained;
+
+    if (++cursor.pos == cursor.count) {
+      cursor.ring->records.Release(cursor.count);
+      cursors_.pop_back();
+    } else {
+      std::push_heap(cursors_.begin(), cursors_.end(), is_later);
+    }
+  }
+  written_.fetch_add(drained, std::memory_order_relaxed);
+  if (should_flush) FlushSinks();
+
+  if (has_dead_rings) {
+    std::lock_guard lock(mutex_);
+    rings_.erase(std::remove_if(rings_.begin(), rings_.end(),
+                                [](const auto& ring) {
+                                  return !ring->producer_alive.load() &&
+                                         ring->records.IsEmpty();
+                                }),
+                 rings_.end());
+    rings_count_.store(rings_.size(), std::memory_order_relaxed);
+    rings = rings_;
+  }
+  return drained;
+}
+
+void RingBufferLogger::WriteRecord(Record& record, bool& should_flush) {
+  if (record.is_structured) {
+    try {
+      FormatRecord(record.structured, record.payload);
+    } catch (const std::exception& e) {
+      err_handler_(e.what());
+      return;
+    }
+  }
+
+  spdlog::details::log_msg msg{record.time, spdlog::source_loc{}, name_,
+                               record.level, record.payload};
+  msg.thread_id = record.thread_id;
+  for (auto& sink : sinks_) {
+    if (!sink->should_log(msg.level)) continue;
+    try {
+      sink->log(msg);
+    } catch (const std::exception& e) {
+      err_handler_(e.what());
+    }
+  }
+  should_flush = should_flush || should_flush_(msg);
+
+  if (record.payload.capacity() > kMaxRetainedPayloadSize) {
+    std::string{}.swap(record.payload);
+  }
+  if (record.is_structured) {
+    ShrinkBuffers(record.structured, kMaxRetainedPayloadSize);
+  }
+}
+
+void RingBufferLogger::FlushSinks() {
+  for (auto& sink : sinks_) {
+    try {
+      sink->flush();
+    } catch (const std::exception& e) {
+      err_handler_(e.what());
+    }
+  }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// this header must be included before any spdlog headers
+// to override spdlog's level names
+#include <logging/spdlog.hpp>
+
+#include <logging/spsc_ring.hpp>
+#include <logging/structured_record.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Asynchronous logger with a lock-free ring per producer thread.
+///
+/// Each thread that logs gets its own single producer single consumer ring,
+/// a dedicated writer thread drains the rings into the sinks. Producers never
+/// take locks unless the writer is idle and has to be woken up. Messages of
+/// a single thread are written in order. The messages that are drained from
+/// several rings at once are written in the order of their timestamps, so the
+/// messages of a task that has migrated between threads keep their order,
+/// unless the task has migrated within a few microseconds between a log call
+/// and the start of a drain round.
+///
+/// Messages passed with LogRecord() are formatted on the writer thread.
+class RingBufferLogger final : public spdlog::logger {
+ public:
+  enum class OverflowBehavior {
+    kDiscard,  ///< drop the message and count it
+    kBlock,    ///< spin until the writer frees a slot, stalls the thread
+  };
+
+  using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+
+  /// @param ring_size capacity of a per-thread ring, must be a power of 2
+  RingBufferLogger(std::string name, spdlog::sink_ptr sink,
+                   std::size_t ring_size, OverflowBehavior overflow_behavior);
+
+  /// Writes out all of the queued messages
+  ~RingBufferLogger() override;
+
+  /// Copies the unformatted message into the ring, it is formatted by the
+  /// writer thread
+  void LogRecord(spdlog::level::level_enum level,
+                 const StructuredRecordView& record);
+
+  /// Number of messages passed to the sinks
+  std::uint64_t GetWrittenCount() const;
+  /// Number of messages dropped because of a full ring
+  std::uint64_t GetDroppedCount() const;
+  /// Number of per-thread rings
+  std::size_t GetRingsCount() const;
+  /// Time from a log call to the write to the sinks in microseconds, for the
+  /// last minute
+  Percentile GetQueueLatency() const;
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override;
+  void flush_() override;
+
+ private:
+  struct Record {
+    spdlog::level::level_enum level{spdlog::level::off};
+    spdlog::log_clock::time_point time;
+    std::size_t thread_id{0};
+    std::string payload;
+    // If set, the payload is formatted from the structured record
+    bool is_structured{false};
+    StructuredRecord structured;
+  };
+
+  struct Ring {
+    explicit Ring(std::size_t size) : records(size) {}
+
+    SpscRing<Record> records;
+    std::atomic<bool> producer_alive{true};
+    std::atomic<bool> logger_alive{true};
+  };
+
+  class ThreadRings;
+
+  template <typename Fill>
+  void Push(const Fill& fill);
+  Ring& GetThreadRing();
+  void WakeUpWriter();
+
+  // The acquired records of a ring within a drain round
+  struct Cursor {
+    Ring* ring{nullptr};
+    std::size_t pos{0};
+    std::size_t count{0};
+  };
+
+  void WriterLoop();
+  std::size_t Drain(std::vector<std::shared_ptr<Ring>>& rings);
+  void WriteRecord(Record& record, bool& should_flush);
+  void FlushSinks();
+
+  const std::uint64_t id_;
+  const std::size_t ring_size_;
+  const OverflowBehavior overflow_behavior_;
+
+  // protects rings_ and the writer wake ups
+  mutable std::mutex mutex_;
+  std::condition_variable writer_cv_;
+  std::vector<std::shared_ptr<Ring>> rings_;
+  std::atomic<bool> rings_changed_{false};
+  std::atomic<bool> writer_idle_{false};
+  std::atomic<bool> flush_requested_{false};
+  std::atomic<bool> stop_{false};
+
+  std::atomic<std::uint64_t> written_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::size_t> rings_count_{0};
+  utils::statistics::RecentPeriod<Percentile, Percentile,
+                                  utils::datetime::SteadyClock>
+      latency_;
+
+  // used by the writer thread only
+  std::vector<Cursor> cursors_;
+
+  std::thread writer_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
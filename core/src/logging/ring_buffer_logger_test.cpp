@@ -0,0 +1,147 @@
+#include <logging/ring_buffer_logger.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using logging::impl::RingBufferLogger;
+
+class RecordingSink final : public spdlog::sinks::base_sink<std::mutex> {
+ public:
+  std::vector<std::string> GetMessages() {
+    std::lock_guard lock(mutex_);
+    return messages_;
+  }
+
+  void Pause() {
+    std::lock_guard lock(mutex_);
+    paused_ = true;
+  }
+
+  void Resume() {
+    {
+      std::lock_guard lock(mutex_);
+      paused_ = false;
+    }
+    resumed_.notify_all();
+  }
+
+ protected:
+  void sink_it_(const spdlog::details::log_msg& msg) override {
+    std::unique_lock lock(mutex_, std::adopt_lock);
+    resumed_.wait(lock, [this] { return !paused_; });
+    lock.release();
+    messages_.emplace_back(msg.payload.data(), msg.payload.size());
+  }
+
+  void flush_() override {}
+
+ private:
+  std::condition_variable_any resumed_;
+  bool paused_{false};
+  std::vector<std::string> messages_;
+};
+
+}  // namespace
+
+TEST(RingBufferLogger, KeepsPerThreadOrder) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kMessages = 10000;
+
+  auto sink = std::make_shared<RecordingSink>();
+  auto logger = std::make_unique<RingBufferLogger>(
+      "test", sink, 16, RingBufferLogger::OverflowBehavior::kBlock);
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&logger, i] {
+      for (std::size_t j = 0; j < kMessages; ++j) {
+        logger->info("{} {}", i, j);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  logger.reset();
+
+  const auto messages = sink->GetMessages();
+  ASSERT_EQ(kThreads * kMessages, messages.size());
+
+  std::vector<std::size_t> next(kThreads, 0);
+  for (const auto& message : messages) {
+    const auto space = message.find(' ');
+    const auto thread = std::stoul(message.substr(0, space));
+    const auto index = std::stoul(message.substr(space + 1));
+    ASSERT_LT(thread, kThreads);
+    ASSERT_EQ(next[thread]++, index) << "thread " << thread;
+  }
+}
+
+TEST(RingBufferLogger, DiscardsOnOverflow) {
+  constexpr std::size_t kMessages = 100;
+  constexpr std::size_t kRingSize = 4;
+
+  auto sink = std::make_shared<RecordingSink>();
+  RingBufferLogger logger("test", sink, kRingSize,
+                          RingBufferLogger::OverflowBehavior::kDiscard);
+
+  sink->Pause();
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    logger.info("message {}", i);
+  }
+  // At most one drain round is blocked in the sink, and one ring is queued
+  EXPECT_GE(logger.GetDroppedCount(), kMessages - 2 * kRingSize);
+  sink->Resume();
+
+  logger.flush();
+  while (logger.GetWrittenCount() + logger.GetDroppedCount() != kMessages) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(logger.GetWrittenCount(), sink->GetMessages().size());
+}
+
+TEST(RingBufferLogger, MergesRingsByTime) {
+  auto sink = std::make_shared<RecordingSink>();
+  auto logger = std::make_unique<RingBufferLogger>(
+      "test", sink, 8, RingBufferLogger::OverflowBehavior::kBlock);
+
+  // the next messages are drained in a single round
+  sink->Pause();
+  logger->info("first");
+  logger->info("a1");
+  std::thread([&logger] { logger->info("b1"); }).join();
+  logger->info("a2");
+  sink->Resume();
+  logger.reset();
+
+  const auto messages = sink->GetMessages();
+  std::vector<std::string> expected{"first", "a1", "b1", "a2"};
+  EXPECT_EQ(messages, expected);
+}
+
+TEST(RingBufferLogger, OutlivesProducerThreads) {
+  auto sink = std::make_shared<RecordingSink>();
+  RingBufferLogger logger("test", sink, 8,
+                          RingBufferLogger::OverflowBehavior::kBlock);
+
+  for (int i = 0; i < 10; ++i) {
+    std::thread([&logger] { logger.info("message"); }).join();
+  }
+  while (logger.GetWrittenCount() != 10 || logger.GetRingsCount() != 0) {
+    logger.flush();
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(10, sink->GetMessages().size());
+}
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,9 @@ const std::string& GetSpdlogPattern(Format format) {
   static const std::string kSpdlogLtsvPattern =
       "timestamp:%Y-%m-%dT%H:%M:%S.%f\tlevel:%l\t%v";
   static const std::string kSpdlogRawPattern = "%v";
+  // LogHelper writes the rest of the object members
+  static const std::string kSpdlogJsonPattern =
+      R"({"timestamp":"%Y-%m-%dT%H:%M:%S.%f","level":"%l",%v})";
 
   switch (format) {
     case Format::kTskv:
@@ -20,6 +23,8 @@ const std::string& GetSpdlogPattern(Format format) {
       return kSpdlogLtsvPattern;
     case Format::kRaw:
       return kSpdlogRawPattern;
+    case Format::kJson:
+      return kSpdlogJsonPattern;
   }
 
   UINVARIANT(false, "Invalid logging::Format enum value");
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Bounded lock-free single producer single consumer queue.
+///
+/// Elements are filled and consumed in place, so that the slots keep their
+/// buffers between the uses and the steady state is allocation-free.
+template <typename T>
+class SpscRing final {
+ public:
+  /// @param capacity must be a power of 2
+  explicit SpscRing(std::size_t capacity)
+      : slots_(capacity), mask_(capacity - 1) {
+    UASSERT_MSG(capacity && !(capacity & mask_),
+                "SpscRing capacity must be a power of 2");
+  }
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  /// Producer side. Calls `fill(T&)` for a free slot.
+  /// @returns false if the ring is full
+  template <typename Filler>
+  bool TryPush(Filler&& fill) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == slots_.size()) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == slots_.size()) return false;
+    }
+    fill(slots_[tail & mask_]);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Consumer side.
+  /// @returns the number of the available elements, they are accessed with
+  /// Peek() and stay in the ring until Release()
+  std::size_t Acquire() const {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_relaxed);
+  }
+
+  /// Consumer side. Returns the `index`-th of the acquired elements.
+  T& Peek(std::size_t index) {
+    return slots_[(head_.load(std::memory_order_relaxed) + index) & mask_];
+  }
+
+  /// Consumer side. Frees the first `count` of the acquired elements for
+  /// reuse.
+  void Release(std::size_t count) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    UASSERT(count <= tail_.load(std::memory_order_relaxed) - head);
+    head_.store(head + count, std::memory_order_release);
+  }
+
+  bool IsEmpty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+  }
+
+  std::size_t Capacity() const { return slots_.size(); }
+
+ private:
+  std::vector<T> slots_;
+  const std::size_t mask_;
+
+  // Producer and consumer indices live on separate cache lines
+  alignas(64) std::atomic<std::size_t> head_{0};
+  alignas(64) std::atomic<std::size_t> tail_{0};
+  std::size_t cached_head_{0};  // producer only
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,233 @@
+#include <logging/structured_record.hpp>
+
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+const LogExtra::Value& GetValue(const LogExtra::Value& value) { return value; }
+
+const LogExtra::Value& GetValue(const LogExtra::Value* value) {
+  UASSERT(value);
+  return *value;
+}
+
+void AppendJsonEscaped(std::string_view value, std::string& out) {
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          fmt::format_to(std::back_inserter(out), FMT_COMPILE("\\u{:04x}"),
+                         static_cast<int>(c));
+        } else {
+          out.push_back(c);
+        }
+    }
+  }
+}
+
+class TskvFormatter final {
+ public:
+  TskvFormatter(std::string& out, char key_value_separator)
+      : out_(out), key_value_separator_(key_value_separator) {}
+
+  void Module(std::string_view func, std::string_view path, int line) {
+    out_ += "module";
+    out_.push_back(key_value_separator_);
+    fmt::format_to(std::back_inserter(out_), FMT_COMPILE("{} ( {}:{} ) "),
+                   func, path, line);
+  }
+
+  void Ids(std::uint64_t task_id, std::uint64_t thread_id) {
+    Key("task_id");
+    fmt::format_to(std::back_inserter(out_), FMT_COMPILE("{:X}"), task_id);
+    Key("thread_id");
+    fmt::format_to(std::back_inserter(out_), FMT_COMPILE("0x{:016X}"),
+                   thread_id);
+  }
+
+  void Text(std::string_view text) {
+    Key("text");
+    utils::encoding::EncodeTskv(out_, text.data(), text.size(),
+                                utils::encoding::EncodeTskvMode::kValue);
+  }
+
+  void Extra(std::string_view key, const LogExtra::Value& value) {
+    out_.push_back(utils::encoding::kTskvPairsSeparator);
+    utils::encoding::EncodeTskv(
+        out_, key.data(), key.size(),
+        utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+    out_.push_back(key_value_separator_);
+    std::visit(
+        [this](const auto& val) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(val)>,
+                                       std::string>) {
+            utils::encoding::EncodeTskv(
+                out_, val, utils::encoding::EncodeTskvMode::kValue);
+          } else {
+            fmt::format_to(std::back_inserter(out_), FMT_COMPILE("{}"), val);
+          }
+        },
+        value);
+  }
+
+ private:
+  void Key(std::string_view key) {
+    out_.push_back(utils::encoding::kTskvPairsSeparator);
+    out_ += key;
+    out_.push_back(key_value_separator_);
+  }
+
+  std::string& out_;
+  const char key_value_separator_;
+};
+
+// Produces the members of a JSON object, the braces come from the pattern
+class JsonFormatter final {
+ public:
+  explicit JsonFormatter(std::string& out) : out_(out) {}
+
+  void Module(std::string_view func, std::string_view path, int line) {
+    out_ += "\"module\":\"";
+    AppendJsonEscaped(func, out_);
+    out_ += " ( ";
+    AppendJsonEscaped(path, out_);
+    fmt::format_to(std::back_inserter(out_), FMT_COMPILE(":{} ) \""), line);
+  }
+
+  void Ids(std::uint64_t task_id, std::uint64_t thread_id) {
+    fmt::format_to(
+        std::back_inserter(out_),
+        FMT_COMPILE(",\"task_id\":\"{:X}\",\"thread_id\":\"0x{:016X}\""),
+        task_id, thread_id);
+  }
+
+  void Text(std::string_view text) {
+    out_ += ",\"text\":\"";
+    AppendJsonEscaped(text, out_);
+    out_.push_back('"');
+  }
+
+  void Extra(std::string_view key, const LogExtra::Value& value) {
+    out_ += ",\"";
+    AppendJsonEscaped(key, out_);
+    out_ += "\":";
+    std::visit(
+        [this](const auto& val) {
+          using Value = std::decay_t<decltype(val)>;
+          if constexpr (std::is_same_v<Value, std::string>) {
+            out_.push_back('"');
+            AppendJsonEscaped(val, out_);
+            out_.push_back('"');
+          } else if constexpr (std::is_floating_point_v<Value>) {
+            // NaN and infinities are not representable in JSON
+            if (std::isfinite(val)) {
+              fmt::format_to(std::back_inserter(out_), FMT_COMPILE("{}"), val);
+            } else {
+              fmt::format_to(std::back_inserter(out_), FMT_COMPILE("\"{}\""),
+                             val);
+            }
+          } else {
+            fmt::format_to(std::back_inserter(out_), FMT_COMPILE("{}"), val);
+          }
+        },
+        value);
+  }
+
+ private:
+  std::string& out_;
+};
+
+template <typename Formatter, typename Record>
+void FormatRecordWith(Formatter formatter, const Record& record) {
+  formatter.Module(record.func, record.path, record.line);
+  formatter.Ids(record.task_id, record.thread_id);
+  formatter.Text(record.text);
+  for (const auto& [key, value] : record.extra) {
+    formatter.Extra(key, GetValue(value));
+  }
+}
+
+template <typename Record>
+void FormatRecordImpl(const Record& record, std::string& out) {
+  out.clear();
+  switch (record.format) {
+    case Format::kTskv:
+    case Format::kRaw:
+      FormatRecordWith(TskvFormatter{out, '='}, record);
+      return;
+    case Format::kLtsv:
+      FormatRecordWith(TskvFormatter{out, ':'}, record);
+      return;
+    case Format::kJson:
+      FormatRecordWith(JsonFormatter{out}, record);
+      return;
+  }
+
+  UINVARIANT(false, "Invalid logging::Format enum value");
+}
+
+}  // namespace
+
+void Assign(StructuredRecord& record, const StructuredRecordView& view) {
+  record.format = view.format;
+  record.path.assign(view.path);
+  record.line = view.line;
+  record.func.assign(view.func);
+  record.task_id = view.task_id;
+  record.thread_id = view.thread_id;
+  record.text.assign(view.text);
+
+  record.extra.resize(view.extra.size());
+  for (std::size_t i = 0; i < view.extra.size(); ++i) {
+    record.extra[i].first.assign(view.extra[i].first);
+    // Reuses the string buffer if the old value was a string too
+    record.extra[i].second = GetValue(view.extra[i].second);
+  }
+}
+
+void ShrinkBuffers(StructuredRecord& record, std::size_t max_size) {
+  if (record.text.capacity() > max_size) std::string{}.swap(record.text);
+  for (auto& [key, value] : record.extra) {
+    auto* string = std::get_if<std::string>(&value);
+    if (string && string->capacity() > max_size) std::string{}.swap(*string);
+  }
+}
+
+void FormatRecord(const StructuredRecord& record, std::string& out) {
+  FormatRecordImpl(record, out);
+}
+
+void FormatRecord(const StructuredRecordView& record, std::string& out) {
+  FormatRecordImpl(record, out);
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
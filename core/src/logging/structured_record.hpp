@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/logging/format.hpp>
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// Parts of a log message that are referenced until the message is passed to
+/// the logger
+struct StructuredRecordView final {
+  static constexpr std::size_t kInlineExtraSize = 24;
+
+  Format format{Format::kTskv};
+  std::string_view path;
+  int line{0};
+  std::string_view func;
+  std::uint64_t task_id{0};
+  std::uint64_t thread_id{0};
+  /// Message text, not escaped
+  std::string_view text;
+  boost::container::small_vector<
+      std::pair<std::string_view, const LogExtra::Value*>, kInlineExtraSize>
+      extra;
+};
+
+/// Log message that is captured without formatting, so that it is formatted
+/// by the writer thread of the logger
+struct StructuredRecord final {
+  Format format{Format::kTskv};
+  std::string path;
+  int line{0};
+  std::string func;
+  std::uint64_t task_id{0};
+  std::uint64_t thread_id{0};
+  std::string text;
+  std::vector<std::pair<std::string, LogExtra::Value>> extra;
+};
+
+/// Copies the view into the record, reusing the buffers of the record
+void Assign(StructuredRecord& record, const StructuredRecordView& view);
+
+/// Releases the buffers of the record that are larger than `max_size`
+void ShrinkBuffers(StructuredRecord& record, std::size_t max_size);
+
+/// Formats the message without the timestamp and level that are added by the
+/// logger pattern, the output matches the one of LogHelper for TSKV and LTSV
+/// @{
+void FormatRecord(const StructuredRecord& record, std::string& out);
+void FormatRecord(const StructuredRecordView& record, std::string& out);
+/// @}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <logging/structured_record.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <logging/ring_buffer_logger.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+logging::LoggerPtr MakeStructuredStreamLogger(std::ostream& stream,
+                                              logging::Format format) {
+  auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+  auto ring_logger =
+      utils::MakeSharedRef<logging::impl::RingBufferLogger>(
+          "structured", std::move(sink), 16,
+          logging::impl::RingBufferLogger::OverflowBehavior::kBlock);
+  ring_logger->set_pattern("%v");
+  auto* record_writer = &*ring_logger;
+  return std::make_shared<logging::impl::LoggerWithInfo>(
+      format, std::move(ring_logger), record_writer);
+}
+
+logging::LoggerPtr MakeFormattingStreamLogger(std::ostream& stream,
+                                              logging::Format format) {
+  auto logger = MakeNamedStreamLogger("formatting", stream, format);
+  logger->ptr->set_pattern("%v");
+  return logger;
+}
+
+// Logs from the same line, so that the module is the same
+void LogTo(const logging::LoggerPtr& logger) {
+  LOG_TO(logger, logging::Level::kInfo)
+      << "text with\ttabs=\nand \"quotes\" " << 42 << ' ' << 0.5
+      << logging::LogExtra{{"string", "a\tb"},
+                           {"int", -1},
+                           {"float", 1.5f},
+                           {"key.with.periods", 1u}};
+}
+
+class StructuredRecordFormat
+    : public ::testing::TestWithParam<logging::Format> {};
+
+}  // namespace
+
+TEST_P(StructuredRecordFormat, SameAsLogHelper) {
+  std::ostringstream formatted;
+  std::ostringstream structured;
+
+  LogTo(MakeFormattingStreamLogger(formatted, GetParam()));
+  // The logger writes out all of the messages on destruction
+  LogTo(MakeStructuredStreamLogger(structured, GetParam()));
+
+  EXPECT_FALSE(formatted.str().empty());
+  EXPECT_EQ(formatted.str(), structured.str());
+}
+
+INSTANTIATE_TEST_SUITE_P(/*no prefix*/, StructuredRecordFormat,
+                         ::testing::Values(logging::Format::kTskv,
+                                           logging::Format::kLtsv,
+                                           logging::Format::kJson));
+
+TEST(StructuredRecord, Format) {
+  const logging::LogExtra::Value value{std::string{"v\t"}};
+
+  logging::impl::StructuredRecordView record;
+  record.path = "file.cpp";
+  record.line = 10;
+  record.func = "Func";
+  record.task_id = 0xab;
+  record.thread_id = 1;
+  record.text = "text\n";
+  record.extra.emplace_back("a.b", &value);
+
+  std::string output;
+  logging::impl::FormatRecord(record, output);
+  EXPECT_EQ(output,
+            "module=Func ( file.cpp:10 ) \ttask_id=AB\t"
+            "thread_id=0x0000000000000001\ttext=text\\n\ta_b=v\\t");
+
+  logging::impl::StructuredRecord copy;
+  logging::impl::Assign(copy, record);
+  std::string copy_output;
+  logging::impl::FormatRecord(copy, copy_output);
+  EXPECT_EQ(output, copy_output);
+
+  record.format = logging::Format::kJson;
+  logging::impl::FormatRecord(record, output);
+  EXPECT_EQ(output,
+            R"("module":"Func ( file.cpp:10 ) ","task_id":"AB",)"
+            R"("thread_id":"0x0000000000000001","text":"text\n","a.b":"v\t")");
+}
+
+USERVER_NAMESPACE_END
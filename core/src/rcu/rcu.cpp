@@ -2,15 +2,72 @@
 
 #include <atomic>
 
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace rcu::impl {
 
+namespace {
+
+#if defined(__linux__) && defined(MEMBARRIER_CMD_PRIVATE_EXPEDITED)
+
+bool RegisterMembarrier() noexcept {
+  const auto commands = syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0);
+  if (commands < 0 || !(commands & MEMBARRIER_CMD_PRIVATE_EXPEDITED)) {
+    return false;
+  }
+  return syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED,
+                 0) == 0;
+}
+
+void Membarrier() noexcept {
+  [[maybe_unused]] const auto result =
+      syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+  // Readers rely on it instead of fences, there is no way to recover
+  UINVARIANT(result == 0, "membarrier failed after a successful registration");
+}
+
+#else
+
+bool RegisterMembarrier() noexcept { return false; }
+
+void Membarrier() noexcept {}
+
+#endif
+
+bool InitAsymmetricThreadFenceOnce() noexcept {
+  static const bool registered = [] {
+    const bool result = RegisterMembarrier();
+    has_asymmetric_thread_fence.store(result);
+    return result;
+  }();
+  return registered;
+}
+
+}  // namespace
+
+std::atomic<bool> has_asymmetric_thread_fence{false};
+
 uint64_t GetNextEpoch() noexcept {
   static std::atomic<uint64_t> counter{1};  // 0 is the default value in data
   return counter++;
 }
 
+void InitAsymmetricThreadFence() noexcept { InitAsymmetricThreadFenceOnce(); }
+
+void AsymmetricThreadFenceHeavy() noexcept {
+  if (InitAsymmetricThreadFenceOnce()) {
+    Membarrier();
+  } else {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
 }  // namespace rcu::impl
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -13,57 +14,64 @@
 
 USERVER_NAMESPACE_BEGIN
 
-template <int VariableCount>
+template <int VariableCount, rcu::ReadMode Mode>
 void rcu_read(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
-    {
-      std::uint64_t i = 0;
-      for (auto& var : vars) {
-        var.Assign(i++);
-      }
+    std::vector<std::unique_ptr<rcu::Variable<std::uint64_t>>> vars;
+    for (std::uint64_t i = 0; i < VariableCount; ++i) {
+      vars.push_back(std::make_unique<rcu::Variable<std::uint64_t>>(Mode, i));
     }
 
     {
       std::uint64_t i = 0;
       for (auto _ : state) {
-        auto reader = vars[i++ % VariableCount].Read();
+        auto reader = vars[i++ % VariableCount]->Read();
         benchmark::DoNotOptimize(*reader);
       }
     }
   });
 }
-BENCHMARK_TEMPLATE(rcu_read, 1);
-BENCHMARK_TEMPLATE(rcu_read, 2);
-BENCHMARK_TEMPLATE(rcu_read, 4);
-
-template <int VariableCount>
+BENCHMARK_TEMPLATE(rcu_read, 1, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_read, 2, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_read, 4, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_read, 1, rcu::ReadMode::kThreadOwned);
+BENCHMARK_TEMPLATE(rcu_read, 2, rcu::ReadMode::kThreadOwned);
+BENCHMARK_TEMPLATE(rcu_read, 4, rcu::ReadMode::kThreadOwned);
+
+template <int VariableCount, rcu::ReadMode Mode>
 void rcu_write(benchmark::State& state) {
   engine::RunStandalone([&] {
-    rcu::Variable<std::uint64_t> vars[VariableCount];
+    std::vector<std::unique_ptr<rcu::Variable<std::uint64_t>>> vars;
+    for (std::uint64_t i = 0; i < VariableCount; ++i) {
+      vars.push_back(std::make_unique<rcu::Variable<std::uint64_t>>(Mode));
+    }
 
     std::uint64_t i = 0;
     for (auto _ : state) {
-      vars[i % VariableCount].Assign(i);
+      vars[i % VariableCount]->Assign(i);
       ++i;
     }
   });
 }
-BENCHMARK_TEMPLATE(rcu_write, 1);
-BENCHMARK_TEMPLATE(rcu_write, 2);
-BENCHMARK_TEMPLATE(rcu_write, 4);
+BENCHMARK_TEMPLATE(rcu_write, 1, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_write, 2, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_write, 4, rcu::ReadMode::kShared);
+BENCHMARK_TEMPLATE(rcu_write, 1, rcu::ReadMode::kThreadOwned);
+BENCHMARK_TEMPLATE(rcu_write, 2, rcu::ReadMode::kThreadOwned);
+BENCHMARK_TEMPLATE(rcu_write, 4, rcu::ReadMode::kThreadOwned);
 
 void rcu_contention(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
   const std::size_t writers_count = state.range(1);
   const std::size_t kept_readable_pointers_count = state.range(2);
+  const auto read_mode = static_cast<rcu::ReadMode>(state.range(3));
 
   const std::size_t thread_count =
       std::min(readers_count + writers_count, std::size_t{6});
 
   engine::RunStandalone(thread_count, [&] {
     std::atomic<bool> run{true};
-    rcu::Variable<std::uint64_t> var{0};
+    rcu::Variable<std::uint64_t> var{read_mode, 0};
 
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(readers_count - 1 + writers_count);
@@ -112,18 +120,20 @@ void rcu_contention(benchmark::State& state) {
     }
   });
 }
+// The last argument is rcu::ReadMode: 0 for kShared, 1 for kThreadOwned
 BENCHMARK(rcu_contention)
     ->RangeMultiplier(2)
-    ->Ranges({{1, 16}, {0, 1}, {1, 4}})
-    ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
+    ->Ranges({{1, 16}, {0, 1}, {1, 4}, {0, 1}})
+    ->Ranges({{2048, 2048}, {0, 1}, {1, 4}, {0, 1}});
 
 void rcu_of_shared_ptr(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
+  const auto read_mode = static_cast<rcu::ReadMode>(state.range(1));
 
   engine::RunStandalone(readers_count, [&] {
     std::atomic<bool> run{true};
     rcu::Variable<std::shared_ptr<std::uint64_t>> var{
-        std::make_shared<std::uint64_t>(42)};
+        read_mode, std::make_shared<std::uint64_t>(42)};
 
     std::vector<engine::TaskWithResult<void>> tasks;
     tasks.reserve(readers_count - 1);
@@ -148,6 +158,8 @@ void rcu_of_shared_ptr(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(rcu_of_shared_ptr)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 32}, {0, 1}});
 
 USERVER_NAMESPACE_END
@@ -448,6 +448,75 @@ UTEST_MT(Rcu, TortureTest, kTotalTasks) {
   keep_running = false;
 }
 
+UTEST_MT(Rcu, ThreadOwnedTortureTest, kTotalTasks) {
+  rcu::Variable<CleaningUpInt> data{rcu::ReadMode::kThreadOwned, 1};
+  std::atomic<bool> keep_running{true};
+
+  engine::Mutex ping_pong_mutex;
+  rcu::ReadablePtr<CleaningUpInt> ptr = data.Read();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < kReadablePtrPingPongTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::lock_guard lock(ping_pong_mutex);
+        // release a ptr that was created by another thread
+        ptr = rcu::ReadablePtr{ptr};
+        ASSERT_GT(ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kReadingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto first = data.Read();
+        // the thread-owned record is busy, falls back to a shared one
+        const auto second = data.Read();
+        ASSERT_GT(first->value, 0);
+        ASSERT_GT(second->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kWritingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto old = data.Read();
+        data.Assign(CleaningUpInt{old->value + 1});
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  keep_running = false;
+}
+
+UTEST(Rcu, ThreadOwnedManyVariables) {
+  // more variables than the per-thread cache holds
+  std::vector<std::unique_ptr<rcu::Variable<int>>> vars;
+  for (int i = 0; i < 20; ++i) {
+    vars.push_back(
+        std::make_unique<rcu::Variable<int>>(rcu::ReadMode::kThreadOwned, i));
+  }
+
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 20; ++i) {
+      auto reader = vars[i]->Read();
+      EXPECT_EQ(i + round, *reader);
+      vars[i]->Assign(i + round + 1);
+      EXPECT_EQ(i + round, *reader);
+    }
+  }
+
+  // readers cache records of the destroyed variables
+  vars.resize(10);
+  vars.push_back(
+      std::make_unique<rcu::Variable<int>>(rcu::ReadMode::kThreadOwned, 42));
+  EXPECT_EQ(42, vars.back()->ReadCopy());
+}
+
 UTEST(Rcu, WritablePtrUnlocksInCommit) {
   rcu::Variable<int> var{1};
 
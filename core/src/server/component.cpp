@@ -124,8 +124,12 @@ properties:
                 properties:
                     in_buffer_size:
                         type: integer
-                        description: "size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU"
+                        description: "size of the receive buffers, connections take them from a shared pool only while data is pending: bigger values use more RAM and less CPU"
                         defaultDescription: 32 * 1024
+                    in_buffers_max_idle:
+                        type: integer
+                        description: max number of receive buffers kept in the shared pool of the listener when they are not used by any connection
+                        defaultDescription: 1024
                     requests_queue_size_threshold:
                         type: integer
                         description: drop requests from handlers that allow trottling if there's more pending requests than allowed by this value
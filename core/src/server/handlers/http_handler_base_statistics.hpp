@@ -11,7 +11,7 @@
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/statistics/aggregated_values.hpp>
-#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 #include <utils/statistics/http_codes.hpp>
 
@@ -36,7 +36,8 @@ class HttpHandlerMethodStatistics final {
     return reply_codes_.GetSnapshot();
   }
 
-  using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+  // Milliseconds up to ~65 seconds with 3% precision
+  using Percentile = utils::statistics::LogLinearHistogram<5, 16>;
 
   Percentile GetTimings() const { return timings_.GetStatsForPeriod(); }
 
@@ -113,7 +114,8 @@ class HttpRequestMethodStatistics final {
  public:
   void Account(const HttpRequestStatisticsEntry& stats) noexcept;
 
-  using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+  // Milliseconds up to ~65 seconds with 3% precision
+  using Percentile = utils::statistics::LogLinearHistogram<5, 16>;
 
   Percentile GetTimings() const { return timings_.GetStatsForPeriod(); }
 
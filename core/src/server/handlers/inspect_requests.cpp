@@ -23,7 +23,7 @@ formats::json::ValueBuilder FormatHeadersAsJson(
     const http::HttpRequestImpl& request) {
   formats::json::ValueBuilder result(formats::json::Type::kObject);
   for (const auto& name : request.GetHeaderNames())
-    result[name] = request.GetHeader(name);
+    result[std::string{name}] = request.GetHeader(name);
 
   return result;
 }
@@ -45,7 +45,7 @@ formats::json::ValueBuilder FormatCookiesAsJson(
     const http::HttpRequestImpl& request) {
   formats::json::ValueBuilder result(formats::json::Type::kObject);
   for (const auto& name : request.GetCookieNames())
-    result[name] = request.GetCookie(name);
+    result[std::string{name}] = request.GetCookie(name);
 
   return result;
 }
@@ -46,16 +46,16 @@ std::chrono::duration<double> HttpRequest::GetResponseTime() const {
 
 const std::string& HttpRequest::GetHost() const { return impl_.GetHost(); }
 
-const std::string& HttpRequest::GetArg(const std::string& arg_name) const {
+const std::string& HttpRequest::GetArg(std::string_view arg_name) const {
   return impl_.GetArg(arg_name);
 }
 
 const std::vector<std::string>& HttpRequest::GetArgVector(
-    const std::string& arg_name) const {
+    std::string_view arg_name) const {
   return impl_.GetArgVector(arg_name);
 }
 
-bool HttpRequest::HasArg(const std::string& arg_name) const {
+bool HttpRequest::HasArg(std::string_view arg_name) const {
   return impl_.HasArg(arg_name);
 }
 
@@ -87,7 +87,7 @@ std::vector<std::string> HttpRequest::FormDataArgNames() const {
   return impl_.FormDataArgNames();
 }
 
-const std::string& HttpRequest::GetPathArg(const std::string& arg_name) const {
+const std::string& HttpRequest::GetPathArg(std::string_view arg_name) const {
   return impl_.GetPathArg(arg_name);
 }
 
@@ -95,7 +95,7 @@ const std::string& HttpRequest::GetPathArg(size_t index) const {
   return impl_.GetPathArg(index);
 }
 
-bool HttpRequest::HasPathArg(const std::string& arg_name) const {
+bool HttpRequest::HasPathArg(std::string_view arg_name) const {
   return impl_.HasPathArg(arg_name);
 }
 
@@ -106,11 +106,11 @@ bool HttpRequest::HasPathArg(size_t index) const {
 size_t HttpRequest::PathArgCount() const { return impl_.PathArgCount(); }
 
 const std::string& HttpRequest::GetHeader(
-    const std::string& header_name) const {
+    std::string_view header_name) const {
   return impl_.GetHeader(header_name);
 }
 
-bool HttpRequest::HasHeader(const std::string& header_name) const {
+bool HttpRequest::HasHeader(std::string_view header_name) const {
   return impl_.HasHeader(header_name);
 }
 
@@ -121,11 +121,11 @@ HttpRequest::HeadersMapKeys HttpRequest::GetHeaderNames() const {
 }
 
 const std::string& HttpRequest::GetCookie(
-    const std::string& cookie_name) const {
+    std::string_view cookie_name) const {
   return impl_.GetCookie(cookie_name);
 }
 
-bool HttpRequest::HasCookie(const std::string& cookie_name) const {
+bool HttpRequest::HasCookie(std::string_view cookie_name) const {
   return impl_.HasCookie(cookie_name);
 }
 
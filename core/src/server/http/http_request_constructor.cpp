@@ -17,7 +17,7 @@ namespace server::http {
 
 namespace {
 
-const std::string kCookieHeader = "Cookie";
+constexpr std::string_view kCookieHeader = "Cookie";
 
 inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(*begin)) ++begin;
@@ -159,6 +159,12 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
   header_value_.append(data, size);
 }
 
+void HttpRequestConstructor::ReserveBody(std::uint64_t content_length) {
+  // Big bodies arrive in several receive buffers, copy each of them only once
+  if (content_length == 0 || content_length > config_.max_request_size) return;
+  request_->request_body_.reserve(content_length);
+}
+
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
   request_->request_body_.append(data, size);
@@ -240,15 +246,15 @@ void HttpRequestConstructor::ParseArgs(const http_parser_url& url) {
 }
 
 void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
-  return USERVER_NAMESPACE::http::parser::ParseArgs(
-      std::string_view(data, size), request_->request_args_);
+  request_->ParseArgs(std::string_view(data, size));
 }
 
 void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
   auto it = request_->headers_.find(header_field_);
   if (it == request_->headers_.end()) {
-    request_->headers_.emplace(std::move(header_field_),
+    // header_field_ keeps its capacity for the next header
+    request_->headers_.emplace(request_->arena_.CopyString(header_field_),
                                std::move(header_value_));
   } else {
     it->second += ',';
@@ -286,9 +292,13 @@ void HttpRequestConstructor::ParseCookies() {
       }
       Strip(key_begin, key_end);
       if (key_begin < key_end) {
-        request_->cookies_.emplace(std::piecewise_construct,
-                                   std::tie(key_begin, key_end),
-                                   std::tie(value_begin, value_end));
+        const std::string_view key(key_begin, key_end - key_begin);
+        if (request_->cookies_.find(key) == request_->cookies_.end()) {
+          request_->cookies_.emplace(std::piecewise_construct,
+                                     std::forward_as_tuple(
+                                         request_->arena_.CopyString(key)),
+                                     std::tie(value_begin, value_end));
+        }
       }
       parse_key = true;
       key_begin = ptr + 1;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <http_parser.h>
@@ -50,6 +51,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void ParseUrl();
   void AppendHeaderField(const char* data, size_t size);
   void AppendHeaderValue(const char* data, size_t size);
+  void ReserveBody(std::uint64_t content_length);
   void AppendBody(const char* data, size_t size);
 
   void SetIsFinal(bool is_final);
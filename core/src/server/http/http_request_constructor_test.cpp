@@ -1,5 +1,6 @@
 #include <userver/utest/utest.hpp>
 
+#include <server/http/create_parser_test.hpp>
 #include <server/http/http_request_constructor.hpp>
 #include <userver/http/parser/http_request_parse_args.hpp>
 
@@ -15,4 +16,40 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+UTEST(HttpRequestConstructor, ArenaBackedLookups) {
+  const std::string long_value(5000, 'x');
+  const auto request =
+      "GET /path?arg=1&arg=2&" + std::string(30, 'a') + "=3 HTTP/1.1\r\n"
+      "X-Header: a\r\n"
+      "x-header: b\r\n"
+      "X-Long: " + long_value + "\r\n"
+      "Cookie: name=value\r\n\r\n";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        const auto& http_request =
+            dynamic_cast<server::http::HttpRequestImpl&>(*request);
+
+        const std::string_view header_name = "x-HEADER";
+        EXPECT_EQ(http_request.GetHeader(header_name), "a,b");
+        EXPECT_EQ(http_request.GetHeader("X-Long"), long_value);
+        EXPECT_FALSE(http_request.HasHeader("X-Missing"));
+        EXPECT_EQ(http_request.HeaderCount(), 3);
+
+        EXPECT_EQ(http_request.GetArgVector("arg"),
+                  (std::vector<std::string>{"1", "2"}));
+        EXPECT_EQ(http_request.GetArg(std::string(30, 'a')), "3");
+        EXPECT_EQ(http_request.ArgCount(), 2);
+        EXPECT_EQ(http_request.GetCookie("name"), "value");
+
+        // Small maps and names of a request fit into the initial arena buffer
+        EXPECT_EQ(http_request.GetArenaHeapBlocksCount(), 0);
+      });
+
+  parser.Parse(request.data(), request.size());
+  EXPECT_TRUE(parsed);
+}
+
 USERVER_NAMESPACE_END
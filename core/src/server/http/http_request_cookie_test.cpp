@@ -58,7 +58,8 @@ UTEST_P(HttpRequestCookies, Test) {
         size_t names_count = 0;
         for (const auto& name : http_request.GetCookieNames()) {
           ++names_count;
-          EXPECT_TRUE(param.expected.find(name) != param.expected.end());
+          EXPECT_TRUE(param.expected.find(std::string{name}) !=
+                      param.expected.end());
         }
         EXPECT_EQ(names_count, param.expected.size());
       });
@@ -64,12 +64,27 @@ std::string EscapeForAccessTskvLog(const std::string& str) {
 const std::string kEmptyString{};
 const std::vector<std::string> kEmptyVector{};
 
+constexpr std::size_t kBucketsCount = 16;
+
+template <typename Map>
+Map MakeArenaMap(utils::impl::MonotonicArena& arena,
+                 std::size_t buckets_count = 0) {
+  return Map(buckets_count, typename Map::hasher{}, typename Map::key_equal{},
+             typename Map::allocator_type{arena});
+}
+
 }  // namespace
 
 namespace server::http {
 
 HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter)
-    : response_(*this, data_accounter) {}
+    : request_args_(MakeArenaMap<ArgsMap>(arena_, kBucketsCount)),
+      path_args_(utils::impl::ArenaAllocator<std::string>{arena_}),
+      path_args_by_name_index_(
+          MakeArenaMap<decltype(path_args_by_name_index_)>(arena_)),
+      headers_(MakeArenaMap<impl::RequestHeadersMap>(arena_, kBucketsCount)),
+      cookies_(MakeArenaMap<impl::RequestCookiesMap>(arena_)),
+      response_(*this, data_accounter) {}
 
 HttpRequestImpl::~HttpRequestImpl() = default;
 
@@ -85,20 +100,20 @@ const std::string& HttpRequestImpl::GetHost() const {
   return GetHeader(USERVER_NAMESPACE::http::headers::kHost);
 }
 
-const std::string& HttpRequestImpl::GetArg(const std::string& arg_name) const {
+const std::string& HttpRequestImpl::GetArg(std::string_view arg_name) const {
   auto it = request_args_.find(arg_name);
   if (it == request_args_.end()) return kEmptyString;
   return it->second.at(0);
 }
 
 const std::vector<std::string>& HttpRequestImpl::GetArgVector(
-    const std::string& arg_name) const {
+    std::string_view arg_name) const {
   auto it = request_args_.find(arg_name);
   if (it == request_args_.end()) return kEmptyVector;
   return it->second;
 }
 
-bool HttpRequestImpl::HasArg(const std::string& arg_name) const {
+bool HttpRequestImpl::HasArg(std::string_view arg_name) const {
   auto it = request_args_.find(arg_name);
   return (it != request_args_.end());
 }
@@ -108,7 +123,7 @@ size_t HttpRequestImpl::ArgCount() const { return request_args_.size(); }
 std::vector<std::string> HttpRequestImpl::ArgNames() const {
   std::vector<std::string> res;
   res.reserve(request_args_.size());
-  for (const auto& arg : request_args_) res.push_back(arg.first);
+  for (const auto& arg : request_args_) res.emplace_back(arg.first);
   return res;
 }
 
@@ -147,7 +162,7 @@ std::vector<std::string> HttpRequestImpl::FormDataArgNames() const {
 }
 
 const std::string& HttpRequestImpl::GetPathArg(
-    const std::string& arg_name) const {
+    std::string_view arg_name) const {
   auto it = path_args_by_name_index_.find(arg_name);
   if (it == path_args_by_name_index_.end()) return kEmptyString;
   UASSERT(it->second < path_args_.size());
@@ -158,7 +173,7 @@ const std::string& HttpRequestImpl::GetPathArg(size_t index) const {
   return index < PathArgCount() ? path_args_[index] : kEmptyString;
 }
 
-bool HttpRequestImpl::HasPathArg(const std::string& arg_name) const {
+bool HttpRequestImpl::HasPathArg(std::string_view arg_name) const {
   return path_args_by_name_index_.find(arg_name) !=
          path_args_by_name_index_.end();
 }
@@ -170,13 +185,13 @@ bool HttpRequestImpl::HasPathArg(size_t index) const {
 size_t HttpRequestImpl::PathArgCount() const { return path_args_.size(); }
 
 const std::string& HttpRequestImpl::GetHeader(
-    const std::string& header_name) const {
+    std::string_view header_name) const {
   auto it = headers_.find(header_name);
   if (it == headers_.end()) return kEmptyString;
   return it->second;
 }
 
-bool HttpRequestImpl::HasHeader(const std::string& header_name) const {
+bool HttpRequestImpl::HasHeader(std::string_view header_name) const {
   auto it = headers_.find(header_name);
   return (it != headers_.end());
 }
@@ -188,13 +203,13 @@ HttpRequest::HeadersMapKeys HttpRequestImpl::GetHeaderNames() const {
 }
 
 const std::string& HttpRequestImpl::GetCookie(
-    const std::string& cookie_name) const {
+    std::string_view cookie_name) const {
   auto it = cookies_.find(cookie_name);
   if (it == cookies_.end()) return kEmptyString;
   return it->second;
 }
 
-bool HttpRequestImpl::HasCookie(const std::string& cookie_name) const {
+bool HttpRequestImpl::HasCookie(std::string_view cookie_name) const {
   return cookies_.count(cookie_name);
 }
 
@@ -208,9 +223,7 @@ void HttpRequestImpl::SetRequestBody(std::string body) {
   request_body_ = std::move(body);
 }
 
-void HttpRequestImpl::ParseArgsFromBody() {
-  USERVER_NAMESPACE::http::parser::ParseArgs(request_body_, request_args_);
-}
+void HttpRequestImpl::ParseArgsFromBody() { ParseArgs(request_body_); }
 
 bool HttpRequestImpl::IsBodyCompressed() const {
   auto encoding = GetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
@@ -226,11 +239,26 @@ void HttpRequestImpl::SetPathArgs(
   for (auto& [name, value] : args) {
     path_args_.push_back(std::move(value));
     if (!name.empty()) {
-      path_args_by_name_index_[std::move(name)] = path_args_.size() - 1;
+      path_args_by_name_index_[arena_.CopyString(name)] = path_args_.size() - 1;
     }
   }
 }
 
+void HttpRequestImpl::AddArg(std::string&& name, std::string&& value) {
+  auto it = request_args_.find(name);
+  if (it == request_args_.end()) {
+    it = request_args_.emplace(arena_.CopyString(name), kEmptyVector).first;
+  }
+  it->second.push_back(std::move(value));
+}
+
+void HttpRequestImpl::ParseArgs(std::string_view args) {
+  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
+      args, [this](std::string&& name, std::string&& value) {
+        AddArg(std::move(name), std::move(value));
+      });
+}
+
 void HttpRequestImpl::SetMatchedPathLength(size_t length) {
   path_suffix_ = request_path_.substr(length);
 }
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -12,6 +14,7 @@
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
+#include <userver/utils/impl/monotonic_arena.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -42,10 +45,10 @@ class HttpRequestImpl final : public request::RequestBase {
 
   const std::string& GetHost() const;
 
-  const std::string& GetArg(const std::string& arg_name) const;
+  const std::string& GetArg(std::string_view arg_name) const;
   const std::vector<std::string>& GetArgVector(
-      const std::string& arg_name) const;
-  bool HasArg(const std::string& arg_name) const;
+      std::string_view arg_name) const;
+  bool HasArg(std::string_view arg_name) const;
   size_t ArgCount() const;
   std::vector<std::string> ArgNames() const;
 
@@ -56,19 +59,19 @@ class HttpRequestImpl final : public request::RequestBase {
   size_t FormDataArgCount() const;
   std::vector<std::string> FormDataArgNames() const;
 
-  const std::string& GetPathArg(const std::string& arg_name) const;
+  const std::string& GetPathArg(std::string_view arg_name) const;
   const std::string& GetPathArg(size_t index) const;
-  bool HasPathArg(const std::string& arg_name) const;
+  bool HasPathArg(std::string_view arg_name) const;
   bool HasPathArg(size_t index) const;
   size_t PathArgCount() const;
 
-  const std::string& GetHeader(const std::string& header_name) const;
-  bool HasHeader(const std::string& header_name) const;
+  const std::string& GetHeader(std::string_view header_name) const;
+  bool HasHeader(std::string_view header_name) const;
   size_t HeaderCount() const;
   HttpRequest::HeadersMapKeys GetHeaderNames() const;
 
-  const std::string& GetCookie(const std::string& cookie_name) const;
-  bool HasCookie(const std::string& cookie_name) const;
+  const std::string& GetCookie(std::string_view cookie_name) const;
+  bool HasCookie(std::string_view cookie_name) const;
   size_t CookieCount() const;
   HttpRequest::CookiesMapKeys GetCookieNames() const;
 
@@ -101,6 +104,11 @@ class HttpRequestImpl final : public request::RequestBase {
 
   void SetPathArgs(std::vector<std::pair<std::string, std::string>> args);
 
+  /// @returns the number of heap blocks the request arena had to allocate
+  std::size_t GetArenaHeapBlocksCount() const {
+    return arena_.GetHeapBlocksCount();
+  }
+
   void SetMatchedPathLength(size_t length) override;
 
   void AccountResponseTime() override;
@@ -118,6 +126,18 @@ class HttpRequestImpl final : public request::RequestBase {
   friend class HttpRequestConstructor;
 
  private:
+  using ArgsMap = impl::ArenaMap<std::string_view, std::vector<std::string>>;
+
+  // Covers the URL arguments, headers and cookies of a typical request
+  static constexpr std::size_t kArenaInitialSize = 4096;
+
+  void AddArg(std::string&& name, std::string&& value);
+  void ParseArgs(std::string_view args);
+
+  // The arena backs the containers below and is declared first to outlive them
+  alignas(std::max_align_t) char arena_buffer_[kArenaInitialSize];
+  utils::impl::MonotonicArena arena_{arena_buffer_, kArenaInitialSize};
+
   // method_ = (orig_method_ == kHead ? kGet : orig_method_)
   HttpMethod method_{HttpMethod::kUnknown};
   HttpMethod orig_method_{HttpMethod::kUnknown};
@@ -127,12 +147,13 @@ class HttpRequestImpl final : public request::RequestBase {
   std::string request_path_;
   std::string request_body_;
   std::string path_suffix_;
-  std::unordered_map<std::string, std::vector<std::string>> request_args_;
+  ArgsMap request_args_;
   std::unordered_map<std::string, std::vector<FormDataArg>> form_data_args_;
-  std::vector<std::string> path_args_;
-  std::unordered_map<std::string, size_t> path_args_by_name_index_;
-  HttpRequest::HeadersMap headers_;
-  HttpRequest::CookiesMap cookies_;
+  std::vector<std::string, utils::impl::ArenaAllocator<std::string>>
+      path_args_;
+  impl::ArenaMap<std::string_view, size_t> path_args_by_name_index_;
+  impl::RequestHeadersMap headers_;
+  impl::RequestCookiesMap cookies_;
   bool is_final_{false};
 
   mutable HttpResponse response_;
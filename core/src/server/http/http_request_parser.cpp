@@ -177,6 +177,7 @@ int HttpRequestParser::OnHeadersCompleteImpl(http_parser* p) {
   if (!CheckUrlComplete(p)) return -1;
   try {
     request_constructor_->AppendHeaderField("", 0);
+    request_constructor_->ReserveBody(p->content_length);
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't append header value: " << ex;
     return -1;
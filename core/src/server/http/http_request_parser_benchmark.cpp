@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <server/http/http_request_parser.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::string kRequest =
+    "POST /v1/orders/search?order_id=2d7b6a0d4e8c4f5a&limit=20&"
+    "fields=status%2Cprice&locale=en HTTP/1.1\r\n"
+    "Host: orders.example.com\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36\r\n"
+    "Accept: application/json\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n"
+    "Content-Type: application/json\r\n"
+    "Content-Length: 17\r\n"
+    "X-YaRequestId: 6f3c2b1a0e9d8c7b6a5f4e3d2c1b0a99\r\n"
+    "X-YaTraceId: 0123456789abcdef0123456789abcdef\r\n"
+    "X-YaSpanId: 0123456789abcdef\r\n"
+    "X-Request-Application: orders-frontend\r\n"
+    "Cookie: session=7b6a0d4e8c4f5a2d; theme=dark; lang=en\r\n"
+    "\r\n"
+    "{\"query\":\"test\"}";
+
+void http_request_parser_parse(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const server::http::HandlerInfoIndex handler_info_index;
+    const server::request::HttpRequestConfig request_config{
+        /*.max_url_size = */ 8192,
+        /*.max_request_size = */ 1024 * 1024,
+        /*.max_headers_size = */ 65536,
+        /*.parse_args_from_body = */ false,
+        /*.testing_mode = */ true,
+        /*.decompress_request = */ false,
+    };
+    server::net::ParserStats stats;
+    server::request::ResponseDataAccounter accounter;
+
+    std::size_t arena_heap_blocks = 0;
+    server::http::HttpRequestParser parser(
+        handler_info_index, request_config,
+        [&](std::shared_ptr<server::request::RequestBase>&& request) {
+          const auto& http_request =
+              static_cast<const server::http::HttpRequestImpl&>(*request);
+          benchmark::DoNotOptimize(http_request.GetHeader("X-YaRequestId"));
+          benchmark::DoNotOptimize(http_request.GetArg("order_id"));
+          benchmark::DoNotOptimize(http_request.GetCookie("session"));
+          arena_heap_blocks += http_request.GetArenaHeapBlocksCount();
+        },
+        stats, accounter);
+
+    for (auto _ : state) {
+      parser.Parse(kRequest.data(), kRequest.size());
+    }
+
+    state.counters["arena_heap_blocks_per_request"] = benchmark::Counter(
+        static_cast<double>(arena_heap_blocks),
+        benchmark::Counter::kAvgIterations);
+    state.SetBytesProcessed(state.iterations() * kRequest.size());
+  });
+}
+
+}  // namespace
+
+BENCHMARK(http_request_parser_parse);
+
+USERVER_NAMESPACE_END
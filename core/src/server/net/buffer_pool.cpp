@@ -0,0 +1,69 @@
+#include <server/net/buffer_pool.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+BufferPool::Buffer::Buffer(std::unique_ptr<char[]> data,
+                           BufferPool& pool) noexcept
+    : data_(std::move(data)), pool_(&pool) {}
+
+BufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : data_(std::move(other.data_)), pool_(other.pool_) {}
+
+BufferPool::Buffer& BufferPool::Buffer::operator=(Buffer&& other) noexcept {
+  if (this == &other) return *this;
+
+  if (data_) pool_->Release(std::move(data_));
+  data_ = std::move(other.data_);
+  pool_ = other.pool_;
+  return *this;
+}
+
+BufferPool::Buffer::~Buffer() {
+  if (data_) pool_->Release(std::move(data_));
+}
+
+std::size_t BufferPool::Buffer::Size() const noexcept {
+  UASSERT(data_);
+  return pool_->GetBufferSize();
+}
+
+BufferPool::BufferPool(std::size_t buffer_size, std::size_t max_idle_buffers)
+    : buffer_size_(buffer_size), max_idle_buffers_(max_idle_buffers) {
+  UASSERT(buffer_size_ > 0);
+}
+
+BufferPool::Buffer BufferPool::Acquire() {
+  std::unique_ptr<char[]> data;
+  if (idle_buffers_.try_dequeue(data)) {
+    --idle_count_;
+  } else {
+    // Not value-initialized on purpose, the buffer is written by recv()
+    data.reset(new char[buffer_size_]);
+  }
+
+  ++active_count_;
+  return Buffer{std::move(data), *this};
+}
+
+BufferPool::Stats BufferPool::GetStats() const noexcept {
+  return {active_count_.load(), idle_count_.load()};
+}
+
+void BufferPool::Release(std::unique_ptr<char[]> data) noexcept {
+  --active_count_;
+
+  // The limit is approximate, concurrent releases may exceed it slightly
+  if (idle_count_.load() >= max_idle_buffers_) return;
+
+  if (idle_buffers_.enqueue(std::move(data))) ++idle_count_;
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <moodycamel/concurrentqueue.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// Pool of fixed size receive buffers shared by the connections of an
+/// endpoint. A connection holds a buffer only while there is data pending on
+/// its socket, so idle keep-alive connections do not hold receive memory.
+class BufferPool final {
+ public:
+  /// RAII handle that returns the buffer to the pool on destruction
+  class Buffer final {
+   public:
+    Buffer() noexcept = default;
+    Buffer(Buffer&& other) noexcept;
+    Buffer& operator=(Buffer&& other) noexcept;
+    ~Buffer();
+
+    char* Data() const noexcept { return data_.get(); }
+    std::size_t Size() const noexcept;
+
+    explicit operator bool() const noexcept { return data_ != nullptr; }
+
+   private:
+    friend class BufferPool;
+
+    Buffer(std::unique_ptr<char[]> data, BufferPool& pool) noexcept;
+
+    std::unique_ptr<char[]> data_;
+    BufferPool* pool_{nullptr};
+  };
+
+  struct Stats {
+    std::size_t active{0};
+    std::size_t idle{0};
+  };
+
+  BufferPool(std::size_t buffer_size, std::size_t max_idle_buffers);
+
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  /// Takes an idle buffer or allocates a new one
+  Buffer Acquire();
+
+  std::size_t GetBufferSize() const noexcept { return buffer_size_; }
+
+  Stats GetStats() const noexcept;
+
+ private:
+  void Release(std::unique_ptr<char[]> data) noexcept;
+
+  const std::size_t buffer_size_;
+  const std::size_t max_idle_buffers_;
+
+  moodycamel::ConcurrentQueue<std::unique_ptr<char[]>> idle_buffers_;
+  std::atomic<std::size_t> idle_count_{0};
+  std::atomic<std::size_t> active_count_{0};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <server/net/buffer_pool.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(BufferPool, AcquireRelease) {
+  server::net::BufferPool pool(1024, 2);
+
+  auto first = pool.Acquire();
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first.Size(), 1024);
+  auto* const first_data = first.Data();
+  first.Data()[1023] = 'x';
+
+  EXPECT_EQ(pool.GetStats().active, 1);
+  EXPECT_EQ(pool.GetStats().idle, 0);
+
+  first = {};
+  EXPECT_FALSE(first);
+  EXPECT_EQ(pool.GetStats().active, 0);
+  EXPECT_EQ(pool.GetStats().idle, 1);
+
+  auto second = pool.Acquire();
+  EXPECT_EQ(second.Data(), first_data);
+  EXPECT_EQ(pool.GetStats().idle, 0);
+}
+
+TEST(BufferPool, MaxIdle) {
+  server::net::BufferPool pool(16, 2);
+  {
+    auto a = pool.Acquire();
+    auto b = pool.Acquire();
+    auto c = pool.Acquire();
+    EXPECT_EQ(pool.GetStats().active, 3);
+  }
+
+  EXPECT_EQ(pool.GetStats().active, 0);
+  EXPECT_EQ(pool.GetStats().idle, 2);
+}
+
+TEST(BufferPool, Move) {
+  server::net::BufferPool pool(16, 1);
+  auto a = pool.Acquire();
+  auto b = std::move(a);
+  EXPECT_TRUE(b);
+  EXPECT_EQ(pool.GetStats().active, 1);
+
+  server::net::BufferPool::Buffer c;
+  c = std::move(b);
+  EXPECT_EQ(pool.GetStats().active, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -4,7 +4,6 @@
 #include <array>
 #include <stdexcept>
 #include <system_error>
-#include <vector>
 
 #include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
@@ -29,10 +28,11 @@ std::shared_ptr<Connection> Connection::Create(
     engine::io::Socket peer_socket,
     const http::RequestHandlerBase& request_handler,
     std::shared_ptr<Stats> stats,
-    request::ResponseDataAccounter& data_accounter) {
+    request::ResponseDataAccounter& data_accounter, BufferPool& in_buffers) {
   return std::make_shared<Connection>(
       task_processor, config, handler_defaults_config, std::move(peer_socket),
-      request_handler, std::move(stats), data_accounter, EmplaceEnabler{});
+      request_handler, std::move(stats), data_accounter, in_buffers,
+      EmplaceEnabler{});
 }
 
 Connection::Connection(
@@ -41,7 +41,8 @@ Connection::Connection(
     engine::io::Socket peer_socket,
     const http::RequestHandlerBase& request_handler,
     std::shared_ptr<Stats> stats,
-    request::ResponseDataAccounter& data_accounter, EmplaceEnabler)
+    request::ResponseDataAccounter& data_accounter, BufferPool& in_buffers,
+    EmplaceEnabler)
     : task_processor_(task_processor),
       config_(config),
       handler_defaults_config_(handler_defaults_config),
@@ -49,6 +50,7 @@ Connection::Connection(
       request_handler_(request_handler),
       stats_(std::move(stats)),
       data_accounter_(data_accounter),
+      in_buffers_(in_buffers),
       remote_address_(peer_socket_.Getpeername().PrimaryAddressString()),
       request_tasks_(Queue::Create()) {
   LOG_DEBUG() << "Incoming connection from " << peer_socket_.Getpeername()
@@ -151,11 +153,22 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
         },
         stats_->parser_stats, data_accounter_);
 
-    std::vector<char> buf(config_.in_buffer_size);
+    BufferPool::Buffer buf;
     while (is_accepting_requests_) {
       auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
+      if (!buf) {
+        // Idle connections wait for data without holding a buffer
+        if (!peer_socket_.WaitReadable(deadline)) {
+          if (engine::current_task::ShouldCancel()) {
+            throw engine::io::IoCancelled() << "WaitReadable";
+          }
+          throw engine::io::IoTimeout() << "WaitReadable";
+        }
+        buf = in_buffers_.Acquire();
+      }
+
       const auto bytes_read =
-          peer_socket_.RecvSome(buf.data(), buf.size(), deadline);
+          peer_socket_.RecvSome(buf.Data(), buf.Size(), deadline);
       if (!bytes_read) {
         LOG_TRACE() << "Peer " << peer_socket_.Getpeername() << " on fd "
                     << Fd() << " closed connection";
@@ -172,13 +185,17 @@ void Connection::ListenForRequests(Queue::Producer producer) noexcept {
       LOG_TRACE() << "Received " << bytes_read << " byte(s) from "
                   << peer_socket_.Getpeername() << " on fd " << Fd();
 
-      if (!request_parser.Parse(buf.data(), bytes_read)) {
+      if (!request_parser.Parse(buf.Data(), bytes_read)) {
         LOG_DEBUG() << "Malformed request from " << peer_socket_.Getpeername()
                     << " on fd " << Fd();
 
         // Stop accepting new requests, send previous answers.
         is_accepting_requests_ = false;
       }
+
+      // The parser copies out everything it needs. A partially filled buffer
+      // means that the socket is drained, return the buffer to the pool.
+      if (bytes_read < buf.Size()) buf = {};
     }
 
     send_stopper.Release();
@@ -5,6 +5,7 @@
 #include <string>
 
 #include <server/http/request_handler_base.hpp>
+#include <server/net/buffer_pool.hpp>
 #include <server/net/connection_config.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
@@ -36,7 +37,7 @@ class Connection final : public std::enable_shared_from_this<Connection> {
       engine::io::Socket peer_socket,
       const http::RequestHandlerBase& request_handler,
       std::shared_ptr<Stats> stats,
-      request::ResponseDataAccounter& data_accounter);
+      request::ResponseDataAccounter& data_accounter, BufferPool& in_buffers);
 
   // Use Create instead of this constructor
   Connection(engine::TaskProcessor& task_processor,
@@ -45,7 +46,8 @@ class Connection final : public std::enable_shared_from_this<Connection> {
              engine::io::Socket peer_socket,
              const http::RequestHandlerBase& request_handler,
              std::shared_ptr<Stats> stats,
-             request::ResponseDataAccounter& data_accounter, EmplaceEnabler);
+             request::ResponseDataAccounter& data_accounter,
+             BufferPool& in_buffers, EmplaceEnabler);
 
   void SetCloseCb(CloseCb close_cb);
 
@@ -79,6 +81,7 @@ class Connection final : public std::enable_shared_from_this<Connection> {
   const http::RequestHandlerBase& request_handler_;
   const std::shared_ptr<Stats> stats_;
   request::ResponseDataAccounter& data_accounter_;
+  BufferPool& in_buffers_;
   const std::string remote_address_;
 
   std::shared_ptr<Queue> request_tasks_;
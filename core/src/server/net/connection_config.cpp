@@ -12,6 +12,8 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
 
   config.in_buffer_size =
       value["in_buffer_size"].As<size_t>(config.in_buffer_size);
+  config.in_buffers_max_idle =
+      value["in_buffers_max_idle"].As<size_t>(config.in_buffers_max_idle);
   config.requests_queue_size_threshold =
       value["requests_queue_size_threshold"].As<size_t>(
           config.requests_queue_size_threshold);
@@ -11,6 +11,7 @@ namespace server::net {
 
 struct ConnectionConfig {
   size_t in_buffer_size = 32 * 1024;
+  size_t in_buffers_max_idle = 1024;
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
 };
@@ -112,11 +112,13 @@ UTEST(ServerNetConnection, EarlyCancel) {
   ASSERT_TRUE(peer.IsValid());
   auto stats = std::make_shared<net::Stats>();
   server::request::ResponseDataAccounter data_accounter;
+  net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
   TestHttprequestHandler handler;
 
   auto connection_ptr = net::Connection::Create(
       engine::current_task::GetTaskProcessor(), config.connection_config,
-      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter,
+      in_buffers);
 
   connection_ptr->Start();
   // Immediately canceling the `socket_listener_` task without giving it
@@ -150,13 +152,15 @@ UTEST(ServerNetConnection, EarlyTimeout) {
   ASSERT_TRUE(peer.IsValid());
   auto stats = std::make_shared<net::Stats>();
   server::request::ResponseDataAccounter data_accounter;
+  net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
   TestHttprequestHandler handler;
 
   UEXPECT_THROW(res.Get(), clients::http::TimeoutException);
 
   auto connection_ptr = net::Connection::Create(
       engine::current_task::GetTaskProcessor(), config.connection_config,
-      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter,
+      in_buffers);
 
   connection_ptr->Start();
   std::weak_ptr<net::Connection> weak = connection_ptr;
@@ -183,11 +187,13 @@ UTEST(ServerNetConnection, TimeoutWithTaskCancellation) {
   ASSERT_TRUE(peer.IsValid());
   auto stats = std::make_shared<net::Stats>();
   server::request::ResponseDataAccounter data_accounter;
+  net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
   TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kHang};
 
   auto connection_ptr = net::Connection::Create(
       engine::current_task::GetTaskProcessor(), config.connection_config,
-      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter,
+      in_buffers);
 
   connection_ptr->Start();
   std::weak_ptr<net::Connection> weak = connection_ptr;
@@ -233,11 +239,13 @@ UTEST(ServerNetConnection, RemoteClosed) {
   ASSERT_TRUE(peer.IsValid());
   auto stats = std::make_shared<net::Stats>();
   server::request::ResponseDataAccounter data_accounter;
+  net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
   TestHttprequestHandler handler;
 
   auto connection_ptr = net::Connection::Create(
       engine::current_task::GetTaskProcessor(), config.connection_config,
-      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter,
+      in_buffers);
 
   connection_ptr->Start();
   std::weak_ptr<net::Connection> weak = connection_ptr;
@@ -266,11 +274,13 @@ UTEST(ServerNetConnection, KeepAlive) {
   ASSERT_TRUE(peer.IsValid());
   auto stats = std::make_shared<net::Stats>();
   server::request::ResponseDataAccounter data_accounter;
+  net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
   TestHttprequestHandler handler;
 
   auto connection_ptr = net::Connection::Create(
       engine::current_task::GetTaskProcessor(), config.connection_config,
-      config.handler_defaults, std::move(peer), handler, stats, data_accounter);
+      config.handler_defaults, std::move(peer), handler, stats, data_accounter,
+      in_buffers);
 
   connection_ptr->Start();
   EXPECT_EQ(request.Get()->status_code(), 404);
@@ -298,12 +308,13 @@ UTEST(ServerNetConnection, CancelMultipleInFlight) {
     ASSERT_TRUE(peer.IsValid());
     auto stats = std::make_shared<net::Stats>();
     server::request::ResponseDataAccounter data_accounter;
+    net::BufferPool in_buffers(config.connection_config.in_buffer_size, 1);
     TestHttprequestHandler handler;
 
     auto connection_ptr = net::Connection::Create(
         engine::current_task::GetTaskProcessor(), config.connection_config,
         config.handler_defaults, std::move(peer), handler, stats,
-        data_accounter);
+        data_accounter, in_buffers);
 
     connection_ptr->Start();
     res.Wait();
@@ -6,7 +6,10 @@ namespace server::net {
 
 EndpointInfo::EndpointInfo(const ListenerConfig& listener_config,
                            http::HttpRequestHandler& request_handler)
-    : listener_config(listener_config), request_handler(request_handler) {}
+    : listener_config(listener_config),
+      request_handler(request_handler),
+      in_buffers(listener_config.connection_config.in_buffer_size,
+                 listener_config.connection_config.in_buffers_max_idle) {}
 
 std::string EndpointInfo::GetDescription() const {
   if (listener_config.unix_socket_path.empty())
@@ -3,6 +3,7 @@
 #include <atomic>
 
 #include <server/http/http_request_handler.hpp>
+#include <server/net/buffer_pool.hpp>
 #include <server/net/connection.hpp>
 #include <server/net/listener_config.hpp>
 
@@ -20,6 +21,7 @@ struct EndpointInfo {
   Connection::Type connection_type{Connection::Type::kRequest};
 
   std::atomic<size_t> connection_count{0};
+  BufferPool in_buffers;
 };
 
 }  // namespace server::net
@@ -177,6 +177,13 @@ formats::json::Value Server::GetMonitorData(
     json_conn_stats["opened"] = server_stats.connections_created.load();
     json_conn_stats["closed"] = server_stats.connections_closed.load();
 
+    if (pimpl->main_port_info_.endpoint_info_) {
+      const auto in_buffers =
+          pimpl->main_port_info_.endpoint_info_->in_buffers.GetStats();
+      json_conn_stats["in-buffers"]["active"] = in_buffers.active;
+      json_conn_stats["in-buffers"]["idle"] = in_buffers.idle;
+    }
+
     json_data["connections"] = std::move(json_conn_stats);
   }
   {
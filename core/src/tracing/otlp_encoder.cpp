@@ -0,0 +1,256 @@
+#include <tracing/otlp_encoder.hpp>
+
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+// Field numbers from opentelemetry/proto/trace/v1/trace.proto and
+// opentelemetry/proto/common/v1/common.proto
+namespace otlp {
+
+constexpr int kRequestResourceSpans = 1;
+
+constexpr int kResourceSpansResource = 1;
+constexpr int kResourceSpansScopeSpans = 2;
+
+constexpr int kResourceAttributes = 1;
+
+constexpr int kScopeSpansScope = 1;
+constexpr int kScopeSpansSpans = 2;
+
+constexpr int kScopeName = 1;
+
+constexpr int kSpanTraceId = 1;
+constexpr int kSpanSpanId = 2;
+constexpr int kSpanParentSpanId = 4;
+constexpr int kSpanName = 5;
+constexpr int kSpanKind = 6;
+constexpr int kSpanStartTime = 7;
+constexpr int kSpanEndTime = 8;
+constexpr int kSpanAttributes = 9;
+constexpr int kSpanStatus = 15;
+
+constexpr int kStatusCode = 3;
+
+constexpr int kKeyValueKey = 1;
+constexpr int kKeyValueValue = 2;
+
+constexpr int kAnyValueString = 1;
+constexpr int kAnyValueBool = 2;
+constexpr int kAnyValueInt = 3;
+
+constexpr std::uint64_t kSpanKindInternal = 1;
+constexpr std::uint64_t kStatusCodeError = 2;
+
+constexpr std::string_view kScope = "userver";
+constexpr std::string_view kServiceNameAttribute = "service.name";
+
+}  // namespace otlp
+
+enum class WireType : std::uint8_t {
+  kVarint = 0,
+  kFixed64 = 1,
+  kLengthDelimited = 2,
+};
+
+// Minimal protobuf writer, nested messages are written in place and are
+// prefixed with their length once complete
+class ProtobufWriter final {
+ public:
+  explicit ProtobufWriter(std::string& output) : output_(output) {}
+
+  void Varint(int field, std::uint64_t value) {
+    Tag(field, WireType::kVarint);
+    AppendVarint(value);
+  }
+
+  void Fixed64(int field, std::uint64_t value) {
+    Tag(field, WireType::kFixed64);
+    char bytes[sizeof(value)];
+    for (auto& byte : bytes) {
+      byte = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    output_.append(bytes, sizeof(bytes));
+  }
+
+  void Bytes(int field, std::string_view value) {
+    Tag(field, WireType::kLengthDelimited);
+    AppendVarint(value.size());
+    output_.append(value);
+  }
+
+  void AppendVarint(std::uint64_t value) {
+    char buffer[kMaxVarintSize];
+    output_.append(buffer, FormatVarint(value, buffer));
+  }
+
+  template <typename Func>
+  void Message(int field, Func&& func) {
+    Tag(field, WireType::kLengthDelimited);
+    const auto begin = output_.size();
+    func();
+
+    char length[kMaxVarintSize];
+    const auto length_size = FormatVarint(output_.size() - begin, length);
+    output_.insert(begin, length, length_size);
+  }
+
+ private:
+  static constexpr std::size_t kMaxVarintSize = 10;
+
+  void Tag(int field, WireType type) {
+    AppendVarint((static_cast<std::uint64_t>(field) << 3) |
+                 static_cast<std::uint64_t>(type));
+  }
+
+  static std::size_t FormatVarint(std::uint64_t value, char* buffer) {
+    std::size_t size = 0;
+    while (value >= 0x80) {
+      buffer[size++] = static_cast<char>((value & 0x7f) | 0x80);
+      value >>= 7;
+    }
+    buffer[size++] = static_cast<char>(value);
+    return size;
+  }
+
+  std::string& output_;
+};
+
+std::string_view AsBytes(const TraceIdBytes& id) {
+  return {reinterpret_cast<const char*>(id.data()), id.size()};
+}
+
+void WriteSpanId(ProtobufWriter& writer, int field, std::uint64_t id) {
+  // Ids are written big-endian to match their hex representation
+  char bytes[sizeof(id)];
+  for (std::size_t i = sizeof(id); i > 0; --i) {
+    bytes[i - 1] = static_cast<char>(id & 0xff);
+    id >>= 8;
+  }
+  writer.Bytes(field, {bytes, sizeof(bytes)});
+}
+
+void WriteAttribute(ProtobufWriter& writer, int field, std::string_view key,
+                    const SpanRecord::AttributeValue& value) {
+  writer.Message(field, [&] {
+    writer.Bytes(otlp::kKeyValueKey, key);
+    writer.Message(otlp::kKeyValueValue, [&] {
+      if (const auto* string = std::get_if<std::string>(&value)) {
+        writer.Bytes(otlp::kAnyValueString, *string);
+      } else if (const auto* integer = std::get_if<std::int64_t>(&value)) {
+        writer.Varint(otlp::kAnyValueInt, static_cast<std::uint64_t>(*integer));
+      } else {
+        writer.Varint(otlp::kAnyValueBool, std::get<bool>(value));
+      }
+    });
+  });
+}
+
+void WriteSpan(ProtobufWriter& writer, const SpanRecord& span) {
+  writer.Message(otlp::kScopeSpansSpans, [&] {
+    writer.Bytes(otlp::kSpanTraceId, AsBytes(span.trace_id));
+    WriteSpanId(writer, otlp::kSpanSpanId, span.span_id);
+    if (span.parent_span_id) {
+      WriteSpanId(writer, otlp::kSpanParentSpanId, span.parent_span_id);
+    }
+    writer.Bytes(otlp::kSpanName, span.name);
+    writer.Varint(otlp::kSpanKind, otlp::kSpanKindInternal);
+    writer.Fixed64(otlp::kSpanStartTime, span.start_unix_nano);
+    writer.Fixed64(otlp::kSpanEndTime, span.end_unix_nano);
+    for (const auto& [key, value] : span.attributes) {
+      WriteAttribute(writer, otlp::kSpanAttributes, key, value);
+    }
+    if (span.is_error) {
+      writer.Message(otlp::kSpanStatus, [&] {
+        writer.Varint(otlp::kStatusCode, otlp::kStatusCodeError);
+      });
+    }
+  });
+}
+
+int HexDigit(char c) noexcept {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Fills `out` from exactly `2 * size` hex digits
+bool ParseHex(std::string_view hex, std::uint8_t* out,
+              std::size_t size) noexcept {
+  if (hex.size() != 2 * size) return false;
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto high = HexDigit(hex[2 * i]);
+    const auto low = HexDigit(hex[2 * i + 1]);
+    if (high < 0 || low < 0) return false;
+    out[i] = static_cast<std::uint8_t>(high * 16 + low);
+  }
+  return true;
+}
+
+std::uint64_t Fnv1a(std::string_view data, std::uint64_t hash) noexcept {
+  for (const char c : data) {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+
+}  // namespace
+
+TraceIdBytes TraceIdToBytes(std::string_view trace_id) noexcept {
+  TraceIdBytes result{};
+  if (ParseHex(trace_id, result.data(), result.size())) return result;
+
+  const auto high = Fnv1a(trace_id, kFnvOffsetBasis);
+  const auto low = Fnv1a(trace_id, high);
+  std::memcpy(result.data(), &high, sizeof(high));
+  std::memcpy(result.data() + sizeof(high), &low, sizeof(low));
+  return result;
+}
+
+std::uint64_t SpanIdToInt(std::string_view span_id) noexcept {
+  if (span_id.empty()) return 0;
+
+  std::uint8_t bytes[sizeof(std::uint64_t)];
+  if (!ParseHex(span_id, bytes, sizeof(bytes))) {
+    return Fnv1a(span_id, kFnvOffsetBasis);
+  }
+
+  std::uint64_t result = 0;
+  for (const auto byte : bytes) result = (result << 8) | byte;
+  return result;
+}
+
+std::string EncodeVarint(std::uint64_t value) {
+  std::string result;
+  ProtobufWriter{result}.AppendVarint(value);
+  return result;
+}
+
+void EncodeOtlpTraces(std::string_view service_name, const SpanRecord* spans,
+                      std::size_t count, std::string& output) {
+  ProtobufWriter writer{output};
+  writer.Message(otlp::kRequestResourceSpans, [&] {
+    writer.Message(otlp::kResourceSpansResource, [&] {
+      WriteAttribute(writer, otlp::kResourceAttributes,
+                     otlp::kServiceNameAttribute, std::string{service_name});
+    });
+    writer.Message(otlp::kResourceSpansScopeSpans, [&] {
+      writer.Message(otlp::kScopeSpansScope,
+                     [&] { writer.Bytes(otlp::kScopeName, otlp::kScope); });
+      for (std::size_t i = 0; i < count; ++i) WriteSpan(writer, spans[i]);
+    });
+  });
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
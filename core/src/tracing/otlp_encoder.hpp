@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+using TraceIdBytes = std::array<std::uint8_t, 16>;
+
+/// Compact binary form of a finished span, kept until it is exported
+struct SpanRecord final {
+  using AttributeValue = std::variant<std::string, std::int64_t, bool>;
+
+  TraceIdBytes trace_id{};
+  std::uint64_t span_id{0};
+  std::uint64_t parent_span_id{0};
+  std::string name;
+  std::uint64_t start_unix_nano{0};
+  std::uint64_t end_unix_nano{0};
+  bool is_error{false};
+  std::vector<std::pair<std::string, AttributeValue>> attributes;
+};
+
+/// Converts the hex trace id into 16 bytes. Ids of other formats from
+/// the upstream services are hashed.
+TraceIdBytes TraceIdToBytes(std::string_view trace_id) noexcept;
+
+/// Converts the hex span id into 8 bytes. Ids of other formats from
+/// the upstream services are hashed, an empty id gives 0.
+std::uint64_t SpanIdToInt(std::string_view span_id) noexcept;
+
+/// Protobuf varint, used as a length prefix of the messages written to a file
+std::string EncodeVarint(std::uint64_t value);
+
+/// Serializes the spans into an OTLP `ExportTraceServiceRequest` protobuf
+/// message, appending it to `output`
+void EncodeOtlpTraces(std::string_view service_name, const SpanRecord* spans,
+                      std::size_t count, std::string& output);
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
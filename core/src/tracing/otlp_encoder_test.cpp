@@ -0,0 +1,134 @@
+#include <tracing/otlp_encoder.hpp>
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::uint64_t ReadVarint(std::string_view& data) {
+  std::uint64_t result = 0;
+  for (int shift = 0; !data.empty(); shift += 7) {
+    const auto byte = static_cast<std::uint8_t>(data.front());
+    data.remove_prefix(1);
+    result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) break;
+  }
+  return result;
+}
+
+// Field number -> values of the length-delimited and varint fields
+using Fields = std::multimap<int, std::string_view>;
+
+Fields ReadFields(std::string_view data, std::vector<std::uint64_t>* varints) {
+  Fields result;
+  while (!data.empty()) {
+    const auto tag = ReadVarint(data);
+    const auto field = static_cast<int>(tag >> 3);
+    switch (tag & 7) {
+      case 0:
+        if (varints) varints->push_back(ReadVarint(data));
+        break;
+      case 1:
+        result.emplace(field, data.substr(0, 8));
+        data.remove_prefix(8);
+        break;
+      case 2: {
+        const auto size = ReadVarint(data);
+        result.emplace(field, data.substr(0, size));
+        data.remove_prefix(size);
+        break;
+      }
+      default:
+        ADD_FAILURE() << "Unexpected wire type in tag " << tag;
+        return result;
+    }
+  }
+  return result;
+}
+
+std::string_view Get(const Fields& fields, int field) {
+  const auto it = fields.find(field);
+  return it == fields.end() ? std::string_view{} : it->second;
+}
+
+}  // namespace
+
+TEST(OtlpEncoder, Ids) {
+  const auto trace_id =
+      tracing::impl::TraceIdToBytes("0123456789abcdef0123456789ABCDEF");
+  EXPECT_EQ(trace_id[0], 0x01);
+  EXPECT_EQ(trace_id[15], 0xef);
+
+  EXPECT_EQ(tracing::impl::SpanIdToInt("00000000000000ff"), 0xffU);
+  EXPECT_EQ(tracing::impl::SpanIdToInt(""), 0U);
+
+  // Foreign ids are hashed
+  EXPECT_EQ(tracing::impl::TraceIdToBytes("not-a-hex-id"),
+            tracing::impl::TraceIdToBytes("not-a-hex-id"));
+  EXPECT_NE(tracing::impl::SpanIdToInt("span-1"),
+            tracing::impl::SpanIdToInt("span-2"));
+}
+
+TEST(OtlpEncoder, Span) {
+  tracing::impl::SpanRecord span;
+  span.trace_id = tracing::impl::TraceIdToBytes(
+      "000102030405060708090a0b0c0d0e0f");
+  span.span_id = 0x1122334455667788;
+  span.name = "handler";
+  span.start_unix_nano = 1000;
+  span.end_unix_nano = 3000;
+  span.is_error = true;
+  span.attributes.emplace_back("http.status_code", std::int64_t{500});
+  span.attributes.emplace_back("http.url", std::string{"/ping"});
+
+  std::string output;
+  tracing::impl::EncodeOtlpTraces("my-service", &span, 1, output);
+
+  const auto request = ReadFields(output, nullptr);
+  const auto resource_spans = ReadFields(Get(request, 1), nullptr);
+
+  const auto resource = ReadFields(Get(resource_spans, 1), nullptr);
+  const auto service_name = ReadFields(Get(resource, 1), nullptr);
+  EXPECT_EQ(Get(service_name, 1), "service.name");
+  EXPECT_EQ(Get(ReadFields(Get(service_name, 2), nullptr), 1), "my-service");
+
+  const auto scope_spans = ReadFields(Get(resource_spans, 2), nullptr);
+  EXPECT_EQ(scope_spans.count(2), 1);
+
+  std::vector<std::uint64_t> varints;
+  const auto encoded = ReadFields(Get(scope_spans, 2), &varints);
+  EXPECT_EQ(Get(encoded, 1).size(), 16);
+  EXPECT_EQ(Get(encoded, 1)[15], '\x0f');
+  EXPECT_EQ(Get(encoded, 2), "\x11\x22\x33\x44\x55\x66\x77\x88");
+  EXPECT_EQ(encoded.count(4), 0) << "no parent span id";
+  EXPECT_EQ(Get(encoded, 5), "handler");
+  EXPECT_EQ(Get(encoded, 7), std::string_view("\xe8\x03\0\0\0\0\0\0", 8));
+  EXPECT_EQ(encoded.count(9), 2);
+
+  const auto status_code = ReadFields(Get(encoded, 15), &varints);
+  EXPECT_TRUE(status_code.empty());
+  // span kind and status code
+  EXPECT_EQ(varints, (std::vector<std::uint64_t>{1, 2}));
+}
+
+TEST(OtlpEncoder, ManySpans) {
+  std::vector<tracing::impl::SpanRecord> spans(300);
+  for (std::size_t i = 0; i < spans.size(); ++i) {
+    spans[i].span_id = i + 1;
+    spans[i].name = "span-" + std::to_string(i);
+  }
+
+  std::string output;
+  tracing::impl::EncodeOtlpTraces("service", spans.data(), spans.size(),
+                                  output);
+
+  const auto request = ReadFields(output, nullptr);
+  const auto resource_spans = ReadFields(Get(request, 1), nullptr);
+  const auto scope_spans = ReadFields(Get(resource_spans, 2), nullptr);
+  EXPECT_EQ(scope_spans.count(2), spans.size());
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <tracing/span_impl.hpp>
 
+#include <atomic>
+#include <memory>
 #include <random>
 #include <type_traits>
 
@@ -7,6 +9,7 @@
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <tracing/span_exporter.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -14,6 +17,7 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 #include <utils/internal_tag.hpp>
+#include <utils/thread_local_mem_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -65,10 +69,21 @@ engine::TaskLocalVariable<boost::intrusive::list<
     Span::Impl, boost::intrusive::constant_time_size<false>>>
     task_local_spans;
 
-std::string GenerateSpanId() {
+impl::TraceId GenerateTraceId() {
+  return impl::TraceId{utils::generators::impl::GenerateUuidBytes()};
+}
+
+impl::SpanId GenerateSpanId() {
   std::uniform_int_distribution<std::uint64_t> dist;
   auto random_value = dist(utils::DefaultRandom());
-  return fmt::format(FMT_COMPILE("{:016x}"), random_value);
+
+  // Big-endian to keep the text the same as of the formatted number
+  impl::SpanId::Bytes bytes;
+  for (auto it = bytes.rbegin(); it != bytes.rend(); ++it) {
+    *it = static_cast<std::uint8_t>(random_value & 0xff);
+    random_value >>= 8;
+  }
+  return impl::SpanId{bytes};
 }
 
 logging::LogHelper& operator<<(logging::LogHelper& lh,
@@ -99,11 +114,11 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
+      trace_id_(parent ? parent->trace_id_ : GenerateTraceId()),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
-      reference_type_(reference_type) {
+      reference_type_(reference_type),
+      is_local_root_(parent == nullptr) {
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
@@ -115,6 +130,20 @@ Span::Impl::~Impl() {
     return;
   }
 
+  bool log_opentracing = false;
+  {
+    // The exporter does not suspend, logging may, so it is done after
+    // the exporter is released
+    const auto exporter = impl::GetSpanExporter();
+    if (!*exporter) {
+      log_opentracing = true;
+    } else if (!ExportSpan(**exporter)) {
+      // Sampled out spans are not formatted at all
+      return;
+    }
+  }
+  if (log_opentracing) LogOpenTracing();
+
   const auto steady_now = std::chrono::steady_clock::now();
   const auto duration = steady_now - start_steady_time_;
   const auto total_time_ms =
@@ -133,8 +162,6 @@ Span::Impl::~Impl() {
   result.Extend(kTimeUnitsAttrName, "ms");
   result.Extend(kStartTimestampAttrName, StartTsToString(start_system_time_));
 
-  LogOpenTracing();
-
   if (log_extra_local_) result.Extend(std::move(*log_extra_local_));
   time_storage_.MergeInto(result);
 
@@ -143,15 +170,40 @@ Span::Impl::~Impl() {
 }
 
 void Span::Impl::LogTo(logging::LogHelper& log_helper) const& {
-  log_helper << log_extra_inheritable_;
+  if (log_extra_inheritable_) log_helper << *log_extra_inheritable_;
   tracer_->LogSpanContextTo(*this, log_helper);
 }
 
 void Span::Impl::LogTo(logging::LogHelper& log_helper) && {
-  log_helper << std::move(log_extra_inheritable_);
+  if (log_extra_inheritable_) {
+    if (log_extra_inheritable_.use_count() == 1) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      log_helper << std::move(*log_extra_inheritable_);
+    } else {
+      log_helper << *log_extra_inheritable_;
+    }
+  }
   tracer_->LogSpanContextTo(std::move(*this), log_helper);
 }
 
+const logging::LogExtra& Span::Impl::GetInheritableTags() const {
+  static const logging::LogExtra kNoTags;
+  return log_extra_inheritable_ ? *log_extra_inheritable_ : kNoTags;
+}
+
+logging::LogExtra& Span::Impl::GetInheritableTagsForUpdate() {
+  if (!log_extra_inheritable_) {
+    log_extra_inheritable_ = std::make_shared<logging::LogExtra>();
+  } else if (log_extra_inheritable_.use_count() != 1) {
+    log_extra_inheritable_ =
+        std::make_shared<logging::LogExtra>(*log_extra_inheritable_);
+  } else {
+    // Synchronizes with the release of the tags by the spans of other threads
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *log_extra_inheritable_;
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -159,11 +211,11 @@ void Span::Impl::AttachToCoroStack() {
   task_local_spans->push_back(*this);
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::SpanId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
-    return parent->GetSpanId();
+    return parent->span_id_;
   }
 
   const auto* spans_ptr = task_local_spans.GetOptional();
@@ -176,9 +228,9 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   // orphaned. It's still possible for chaining to break in case parent span
   // becomes non-loggable after child span is created, but that we can't control
   for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-    if (current->GetParentId().empty() /* won't find better candidate */ ||
+    if (current->parent_id_.IsEmpty() /* won't find better candidate */ ||
         current->ShouldLog()) {
-      return current->GetSpanId();
+      return current->span_id_;
     }
     if (current == spans_ptr->begin()) break;
   };
@@ -197,13 +249,15 @@ bool Span::Impl::ShouldLog() const {
 namespace {
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  return utils::ThreadLocalMemPool<Span::Impl>::Pop(
+             std::forward<Args>(args)...)
+      .release();
 }
 }  // namespace
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    utils::ThreadLocalMemPool<Impl>::Push(std::unique_ptr<Impl>{impl});
   }
 }
 
@@ -231,7 +285,7 @@ Span::Span(std::string name, ReferenceType reference_type,
                           GetParentSpanImpl(), reference_type, log_level),
              Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}) {
   AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (pimpl_->parent_id_.IsEmpty()) {
     SetLink(utils::generators::GenerateUuid());
   }
   pimpl_->span_ = this;
@@ -272,8 +326,8 @@ Span* Span::CurrentSpanUnchecked() {
 Span Span::MakeSpan(std::string name, std::string_view trace_id,
                     std::string_view parent_span_id) {
   Span span(std::move(name));
-  if (!trace_id.empty()) span.pimpl_->SetTraceId(std::string{trace_id});
-  span.pimpl_->SetParentId(std::string{parent_span_id});
+  if (!trace_id.empty()) span.pimpl_->SetTraceId(trace_id);
+  span.pimpl_->SetParentId(parent_span_id);
   return span;
 }
 
@@ -282,8 +336,8 @@ Span Span::MakeSpan(std::string name, std::string_view trace_id,
   Span span(Tracer::GetTracer(), std::move(name), nullptr,
             ReferenceType::kChild);
   span.SetLink(std::move(link));
-  if (!trace_id.empty()) span.pimpl_->SetTraceId(std::string{trace_id});
-  span.pimpl_->SetParentId(std::string{parent_span_id});
+  if (!trace_id.empty()) span.pimpl_->SetTraceId(trace_id);
+  span.pimpl_->SetParentId(parent_span_id);
   return span;
 }
 
@@ -329,17 +383,18 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
 }
 
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
-  pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
+  pimpl_->GetInheritableTagsForUpdate().Extend(std::move(key),
+                                              std::move(value));
 }
 
 void Span::AddTags(const logging::LogExtra& log_extra, utils::InternalTag) {
-  pimpl_->log_extra_inheritable_.Extend(log_extra);
+  pimpl_->GetInheritableTagsForUpdate().Extend(log_extra);
 }
 
 impl::TimeStorage& Span::GetTimeStorage() { return pimpl_->GetTimeStorage(); }
 
 std::string Span::GetTag(std::string_view tag) const {
-  const auto& value = pimpl_->log_extra_inheritable_.GetValue(tag);
+  const auto& value = pimpl_->GetInheritableTags().GetValue(tag);
   const auto* s = std::get_if<std::string>(&value);
   if (s)
     return *s;
@@ -348,8 +403,8 @@ std::string Span::GetTag(std::string_view tag) const {
 }
 
 void Span::AddTagFrozen(std::string key, logging::LogExtra::Value value) {
-  pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value),
-                                        logging::LogExtra::ExtendType::kFrozen);
+  pimpl_->GetInheritableTagsForUpdate().Extend(
+      std::move(key), std::move(value), logging::LogExtra::ExtendType::kFrozen);
 }
 
 void Span::SetLink(std::string link) {
@@ -0,0 +1,376 @@
+#include <tracing/span_exporter.hpp>
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+constexpr std::string_view kOtlpTracesPath = "/v1/traces";
+constexpr std::chrono::seconds kSocketTimeout{5};
+
+auto& SpanExporterInternal() {
+  static rcu::Variable<std::shared_ptr<SpanExporter>> exporter;
+  return exporter;
+}
+
+std::uint64_t ProbabilityToThreshold(double probability) {
+  if (probability <= 0) return 0;
+  if (probability >= 1) return std::numeric_limits<std::uint64_t>::max();
+  // 2^64 * probability
+  return static_cast<std::uint64_t>(
+      probability * static_cast<double>(std::uint64_t{1} << 63) * 2);
+}
+
+std::pair<std::string, std::string> SplitHostPort(std::string_view endpoint) {
+  const auto colon = endpoint.rfind(':');
+  if (colon == std::string_view::npos || colon + 1 == endpoint.size()) {
+    throw std::runtime_error(
+        fmt::format("Invalid span exporter endpoint '{}', expected "
+                    "'host:port'",
+                    endpoint));
+  }
+
+  auto host = endpoint.substr(0, colon);
+  if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+    host = host.substr(1, host.size() - 2);
+  }
+  return {std::string{host}, std::string{endpoint.substr(colon + 1)}};
+}
+
+void SetSocketTimeouts(int fd) {
+  ::timeval timeout{};
+  timeout.tv_sec = kSocketTimeout.count();
+  ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+}
+
+int Connect(const std::string& host, const std::string& port) {
+  ::addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+
+  ::addrinfo* addresses = nullptr;
+  const auto error = ::getaddrinfo(host.c_str(), port.c_str(), &hints,
+                                   &addresses);
+  if (error) {
+    throw std::runtime_error(fmt::format("Failed to resolve '{}': {}", host,
+                                         ::gai_strerror(error)));
+  }
+  utils::FastScopeGuard free_addresses(
+      [addresses]() noexcept { ::freeaddrinfo(addresses); });
+
+  for (auto* address = addresses; address; address = address->ai_next) {
+    const int fd = ::socket(address->ai_family,
+                            address->ai_socktype | SOCK_CLOEXEC,
+                            address->ai_protocol);
+    if (fd < 0) continue;
+
+    SetSocketTimeouts(fd);
+    if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) return fd;
+    ::close(fd);
+  }
+  throw std::runtime_error(
+      fmt::format("Failed to connect to {}:{}: {}", host, port,
+                  std::strerror(errno)));
+}
+
+void SendAll(int fd, std::string_view data) {
+  while (!data.empty()) {
+    const auto sent = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+    if (sent < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "calling ::send");
+    }
+    data.remove_prefix(sent);
+  }
+}
+
+// Reads the response up to the end of the status line
+std::string ReadStatusLine(int fd) {
+  std::string response;
+  char buffer[256];
+  while (response.find("\r\n") == std::string::npos) {
+    const auto received = ::recv(fd, buffer, sizeof(buffer), 0);
+    if (received < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "calling ::recv");
+    }
+    if (received == 0) break;
+    response.append(buffer, received);
+  }
+  return response.substr(0, response.find("\r\n"));
+}
+
+}  // namespace
+
+SpanExporter::SpanExporter(std::string service_name, SpanExporterConfig config)
+    : service_name_(std::move(service_name)),
+      config_(std::move(config)),
+      sampling_threshold_(
+          ProbabilityToThreshold(config_.sampling_probability)) {
+  if (config_.endpoint.empty() == config_.file_path.empty()) {
+    throw std::runtime_error(
+        "Exactly one of the span exporter endpoint and file must be set");
+  }
+  UINVARIANT(config_.batch_size > 0, "Span exporter batch size must be > 0");
+
+  if (config_.endpoint.empty()) {
+    file_.emplace(fs::blocking::FileDescriptor::Open(
+        config_.file_path,
+        {fs::blocking::OpenFlag::kWrite,
+         fs::blocking::OpenFlag::kCreateIfNotExists,
+         fs::blocking::OpenFlag::kAppend}));
+  } else {
+    // Validate the endpoint format early
+    SplitHostPort(config_.endpoint);
+  }
+
+  queue_.reserve(config_.batch_size);
+  thread_ = std::thread([this] { Run(); });
+}
+
+SpanExporter::~SpanExporter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_one();
+  thread_.join();
+}
+
+bool SpanExporter::IsHeadSampled(const TraceIdBytes& trace_id) const noexcept {
+  if (sampling_threshold_ == std::numeric_limits<std::uint64_t>::max()) {
+    return true;
+  }
+
+  // Trace ids are random, their leading bytes give the same decision in all
+  // of the services with the same probability
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(value); ++i) {
+    value = (value << 8) | trace_id[i];
+  }
+  return value < sampling_threshold_;
+}
+
+bool SpanExporter::IsTailSamplingEnabled() const noexcept {
+  return config_.tail_keep_errors || config_.tail_latency_threshold;
+}
+
+void SpanExporter::Push(SpanRecord&& span, bool head_sampled,
+                        bool is_local_root) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (head_sampled) {
+    EnqueueLocked(std::move(span));
+    return;
+  }
+  UASSERT(IsTailSamplingEnabled());
+
+  auto it = pending_traces_.find(span.trace_id);
+  if (it == pending_traces_.end()) {
+    if (is_local_root) {
+      // The trace consists of a single span
+      if (ShouldKeep(span)) {
+        EnqueueLocked(std::move(span));
+      } else {
+        ++sampled_out_;
+      }
+      return;
+    }
+
+    if (pending_traces_.size() >= config_.tail_max_traces) {
+      ++dropped_;
+      return;
+    }
+    it = pending_traces_
+             .emplace(span.trace_id,
+                      PendingTrace{{}, std::chrono::steady_clock::now(), false})
+             .first;
+  }
+
+  auto& trace = it->second;
+  trace.keep = trace.keep || ShouldKeep(span);
+  trace.spans.push_back(std::move(span));
+  if (!is_local_root) return;
+
+  if (trace.keep) {
+    EnqueueLocked(trace.spans);
+  } else {
+    sampled_out_ += trace.spans.size();
+  }
+  pending_traces_.erase(it);
+}
+
+void SpanExporter::AccountSampledOut() noexcept { ++sampled_out_; }
+
+void SpanExporter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto target = ++flush_requested_;
+  cv_.notify_one();
+  flush_cv_.wait(lock, [&] { return flush_done_ >= target; });
+}
+
+SpanExporterStatistics SpanExporter::GetStatistics() const {
+  SpanExporterStatistics stats;
+  stats.exported = exported_.load();
+  stats.sampled_out = sampled_out_.load();
+  stats.dropped = dropped_.load();
+  stats.batches = batches_.load();
+  stats.errors = errors_.load();
+  return stats;
+}
+
+std::size_t SpanExporter::TraceIdHash::operator()(
+    const TraceIdBytes& trace_id) const noexcept {
+  std::size_t result = 0;
+  std::memcpy(&result, trace_id.data(), sizeof(result));
+  return result;
+}
+
+bool SpanExporter::ShouldKeep(const SpanRecord& span) const noexcept {
+  if (config_.tail_keep_errors && span.is_error) return true;
+  if (!config_.tail_latency_threshold) return false;
+
+  const std::chrono::nanoseconds duration{span.end_unix_nano -
+                                          span.start_unix_nano};
+  return duration >= *config_.tail_latency_threshold;
+}
+
+void SpanExporter::EnqueueLocked(std::vector<SpanRecord>& spans) {
+  for (auto& span : spans) EnqueueLocked(std::move(span));
+}
+
+void SpanExporter::EnqueueLocked(SpanRecord&& span) {
+  if (queue_.size() >= config_.queue_size) {
+    ++dropped_;
+    return;
+  }
+
+  queue_.push_back(std::move(span));
+  if (queue_.size() == config_.batch_size) cv_.notify_one();
+}
+
+void SpanExporter::DecideStaleTracesLocked(bool decide_all) {
+  const auto now = std::chrono::steady_clock::now();
+  for (auto it = pending_traces_.begin(); it != pending_traces_.end();) {
+    auto& trace = it->second;
+    if (!decide_all &&
+        now - trace.first_span_time < config_.tail_decision_timeout) {
+      ++it;
+      continue;
+    }
+
+    if (trace.keep) {
+      EnqueueLocked(trace.spans);
+    } else {
+      sampled_out_ += trace.spans.size();
+    }
+    it = pending_traces_.erase(it);
+  }
+}
+
+void SpanExporter::Run() {
+  std::vector<SpanRecord> batch;
+  batch.reserve(config_.batch_size);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait_for(lock, config_.flush_interval, [this] {
+      return stop_ || queue_.size() >= config_.batch_size ||
+             flush_requested_ != flush_done_;
+    });
+
+    const bool stop = stop_;
+    const auto flush_target = flush_requested_;
+    DecideStaleTracesLocked(/*decide_all=*/stop);
+    batch.swap(queue_);
+    lock.unlock();
+
+    for (std::size_t begin = 0; begin < batch.size();
+         begin += config_.batch_size) {
+      Export(batch.data() + begin,
+             std::min(config_.batch_size, batch.size() - begin));
+    }
+    batch.clear();
+
+    lock.lock();
+    flush_done_ = flush_target;
+    flush_cv_.notify_all();
+    if (stop) break;
+  }
+}
+
+void SpanExporter::Export(const SpanRecord* spans, std::size_t count) {
+  buffer_.clear();
+  EncodeOtlpTraces(service_name_, spans, count, buffer_);
+
+  try {
+    if (file_) {
+      Write(buffer_);
+    } else {
+      Post(buffer_);
+    }
+    exported_ += count;
+    ++batches_;
+  } catch (const std::exception& e) {
+    ++errors_;
+    LOG_LIMITED_ERROR() << "Failed to export " << count << " spans: " << e;
+  }
+}
+
+void SpanExporter::Write(std::string_view data) {
+  file_->Write(EncodeVarint(data.size()));
+  file_->Write(data);
+}
+
+void SpanExporter::Post(std::string_view data) {
+  const auto [host, port] = SplitHostPort(config_.endpoint);
+  const int fd = Connect(host, port);
+  utils::FastScopeGuard close_socket([fd]() noexcept { ::close(fd); });
+
+  SendAll(fd, fmt::format("POST {} HTTP/1.1\r\n"
+                          "Host: {}\r\n"
+                          "Content-Type: application/x-protobuf\r\n"
+                          "Content-Length: {}\r\n"
+                          "Connection: close\r\n\r\n",
+                          kOtlpTracesPath, config_.endpoint, data.size()));
+  SendAll(fd, data);
+
+  const auto status_line = ReadStatusLine(fd);
+  // "HTTP/1.1 200 OK"
+  const auto code_pos = status_line.find(' ');
+  if (code_pos == std::string::npos || code_pos + 1 >= status_line.size() ||
+      status_line[code_pos + 1] != '2') {
+    throw std::runtime_error(
+        fmt::format("Collector replied with '{}'", status_line));
+  }
+}
+
+rcu::ReadablePtr<std::shared_ptr<SpanExporter>> GetSpanExporter() {
+  return SpanExporterInternal().Read();
+}
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+  SpanExporterInternal().Assign(std::move(exporter));
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/rcu/rcu.hpp>
+
+#include <tracing/otlp_encoder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+struct SpanExporterConfig final {
+  /// `host:port` of an OTLP/HTTP collector to POST the batches to
+  std::string endpoint;
+  /// File to append the length-delimited batches to
+  std::string file_path;
+
+  /// Share of the traces that are always exported
+  double sampling_probability{1.0};
+
+  /// The traces that were not sampled are still exported if any of their
+  /// spans took longer than this
+  std::optional<std::chrono::milliseconds> tail_latency_threshold;
+  /// The traces that were not sampled are still exported if any of their
+  /// spans has the error tag
+  bool tail_keep_errors{false};
+  /// Time to wait for the local root span of a trace, after which the decision
+  /// is made on the spans received so far
+  std::chrono::milliseconds tail_decision_timeout{std::chrono::seconds{30}};
+  /// Max number of the traces awaiting the tail sampling decision
+  std::size_t tail_max_traces{10000};
+
+  std::size_t batch_size{512};
+  std::chrono::milliseconds flush_interval{std::chrono::seconds{1}};
+  /// Max number of spans awaiting export, new spans are dropped on overflow
+  std::size_t queue_size{65536};
+};
+
+struct SpanExporterStatistics final {
+  std::uint64_t exported{0};
+  std::uint64_t sampled_out{0};
+  std::uint64_t dropped{0};
+  std::uint64_t batches{0};
+  std::uint64_t errors{0};
+};
+
+/// @brief Keeps finished spans in SpanRecord form and exports them in batches
+/// in OTLP protobuf from a dedicated thread.
+///
+/// Head sampling is a deterministic function of the trace id, so all of
+/// the spans of a trace, including the ones from other services with the same
+/// probability, get the same decision. Spans of the traces that are not head
+/// sampled are held until the local root span finishes, and then are exported
+/// only if the trace is slow or errored.
+class SpanExporter final {
+ public:
+  SpanExporter(std::string service_name, SpanExporterConfig config);
+
+  /// Exports the queued spans
+  ~SpanExporter();
+
+  /// Whether the spans of the trace are exported regardless of their timings
+  bool IsHeadSampled(const TraceIdBytes& trace_id) const noexcept;
+
+  /// Whether the spans that are not head sampled are needed at all
+  bool IsTailSamplingEnabled() const noexcept;
+
+  /// @param is_local_root whether the span has no parent in this process,
+  /// it completes the tail sampling of the trace
+  void Push(SpanRecord&& span, bool head_sampled, bool is_local_root);
+
+  /// Accounts a span that is neither head sampled nor needed for the tail
+  /// sampling, such spans are neither converted into SpanRecord nor logged
+  void AccountSampledOut() noexcept;
+
+  /// Exports the queued spans, waits for completion
+  void Flush();
+
+  SpanExporterStatistics GetStatistics() const;
+
+ private:
+  struct PendingTrace {
+    std::vector<SpanRecord> spans;
+    std::chrono::steady_clock::time_point first_span_time;
+    bool keep{false};
+  };
+
+  struct TraceIdHash {
+    std::size_t operator()(const TraceIdBytes& trace_id) const noexcept;
+  };
+
+  bool ShouldKeep(const SpanRecord& span) const noexcept;
+  void EnqueueLocked(std::vector<SpanRecord>& spans);
+  void EnqueueLocked(SpanRecord&& span);
+  // Makes the tail sampling decision for the traces without a local root
+  void DecideStaleTracesLocked(bool decide_all);
+
+  void Run();
+  void Export(const SpanRecord* spans, std::size_t count);
+  void Write(std::string_view data);
+  void Post(std::string_view data);
+
+  const std::string service_name_;
+  const SpanExporterConfig config_;
+  const std::uint64_t sampling_threshold_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<SpanRecord> queue_;
+  std::unordered_map<TraceIdBytes, PendingTrace, TraceIdHash> pending_traces_;
+  std::uint64_t flush_requested_{0};
+  std::uint64_t flush_done_{0};
+  bool stop_{false};
+  std::condition_variable flush_cv_;
+
+  std::atomic<std::uint64_t> exported_{0};
+  std::atomic<std::uint64_t> sampled_out_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> batches_{0};
+  std::atomic<std::uint64_t> errors_{0};
+
+  std::optional<fs::blocking::FileDescriptor> file_;
+  std::string buffer_;
+  std::thread thread_;
+};
+
+/// Returns the span exporter or nullptr if the spans are logged to
+/// the opentracing logger. The exporter is kept alive by the returned pointer,
+/// which is cheaper than a copy of the `shared_ptr`.
+rcu::ReadablePtr<std::shared_ptr<SpanExporter>> GetSpanExporter();
+
+/// Atomically replaces the span exporter
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
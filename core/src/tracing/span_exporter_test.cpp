@@ -0,0 +1,190 @@
+#include <tracing/span_exporter.hpp>
+
+#include <logging/logging_test.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class SpanExporter : public LoggingTest {};
+
+// Installs a span exporter writing to a temporary file
+class ExporterScope final {
+ public:
+  explicit ExporterScope(tracing::impl::SpanExporterConfig config = {})
+      : file_(fs::blocking::TempFile::Create()) {
+    config.file_path = file_.GetPath();
+    exporter_ = std::make_shared<tracing::impl::SpanExporter>(
+        "test-service", std::move(config));
+    tracing::impl::SetSpanExporter(exporter_);
+  }
+
+  ~ExporterScope() { tracing::impl::SetSpanExporter({}); }
+
+  tracing::impl::SpanExporterStatistics Flush() {
+    exporter_->Flush();
+    return exporter_->GetStatistics();
+  }
+
+  // Number of the length-delimited messages in the file
+  std::size_t CountWrittenBatches() const {
+    const auto contents = fs::blocking::ReadFileContents(file_.GetPath());
+    std::string_view data = contents;
+
+    std::size_t result = 0;
+    while (!data.empty()) {
+      std::uint64_t size = 0;
+      for (int shift = 0; !data.empty(); shift += 7) {
+        const auto byte = static_cast<std::uint8_t>(data.front());
+        data.remove_prefix(1);
+        size |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+      }
+      EXPECT_LE(size, data.size());
+      data.remove_prefix(std::min<std::size_t>(size, data.size()));
+      ++result;
+    }
+    return result;
+  }
+
+ private:
+  fs::blocking::TempFile file_;
+  std::shared_ptr<tracing::impl::SpanExporter> exporter_;
+};
+
+tracing::Span MakeRootSpan(std::string name) {
+  return tracing::Tracer::GetTracer()->CreateSpanWithoutParent(
+      std::move(name));
+}
+
+}  // namespace
+
+UTEST_F(SpanExporter, ExportsFinishedSpans) {
+  ExporterScope exporter;
+
+  {
+    auto root = MakeRootSpan("root");
+    auto child = root.CreateChild("child");
+  }
+
+  const auto stats = exporter.Flush();
+  EXPECT_EQ(stats.exported, 2);
+  EXPECT_EQ(stats.batches, 1);
+  EXPECT_EQ(stats.errors, 0);
+  EXPECT_EQ(exporter.CountWrittenBatches(), 1);
+}
+
+UTEST_F(SpanExporter, BatchSize) {
+  tracing::impl::SpanExporterConfig config;
+  config.batch_size = 2;
+  ExporterScope exporter{std::move(config)};
+
+  for (int i = 0; i < 5; ++i) MakeRootSpan("root");
+
+  const auto stats = exporter.Flush();
+  EXPECT_EQ(stats.exported, 5);
+  // Depends on how fast the export thread wakes up
+  EXPECT_GE(stats.batches, 3);
+  EXPECT_EQ(exporter.CountWrittenBatches(), stats.batches);
+}
+
+UTEST_F(SpanExporter, HeadSampling) {
+  tracing::impl::SpanExporterConfig config;
+  config.sampling_probability = 0;
+  ExporterScope exporter{std::move(config)};
+
+  {
+    auto root = MakeRootSpan("root");
+    auto child = root.CreateChild("child");
+  }
+
+  const auto stats = exporter.Flush();
+  EXPECT_EQ(stats.exported, 0);
+  EXPECT_EQ(stats.sampled_out, 2);
+  EXPECT_EQ(exporter.CountWrittenBatches(), 0);
+}
+
+UTEST_F(SpanExporter, SampledOutSpansAreNotLogged) {
+  {
+    ExporterScope exporter;
+    MakeRootSpan("sampled");
+  }
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=sampled"),
+            std::string::npos);
+  ClearLog();
+
+  tracing::impl::SpanExporterConfig config;
+  config.sampling_probability = 0;
+  ExporterScope exporter{std::move(config)};
+  MakeRootSpan("sampled_out");
+
+  EXPECT_EQ(exporter.Flush().sampled_out, 1);
+  logging::LogFlush();
+  EXPECT_EQ(GetStreamString().find("stopwatch_name="), std::string::npos);
+}
+
+UTEST_F(SpanExporter, TailSamplingKeepsErrors) {
+  tracing::impl::SpanExporterConfig config;
+  config.sampling_probability = 0;
+  config.tail_keep_errors = true;
+  ExporterScope exporter{std::move(config)};
+
+  {
+    auto root = MakeRootSpan("errored");
+    auto child = root.CreateChild("child");
+    child.AddTag(tracing::kErrorFlag, true);
+  }
+  {
+    auto root = MakeRootSpan("ok");
+    auto child = root.CreateChild("child");
+  }
+
+  const auto stats = exporter.Flush();
+  EXPECT_EQ(stats.exported, 2);
+  EXPECT_EQ(stats.sampled_out, 2);
+}
+
+UTEST_F(SpanExporter, TailSamplingKeepsSlow) {
+  tracing::impl::SpanExporterConfig config;
+  config.sampling_probability = 0;
+  config.tail_latency_threshold = std::chrono::milliseconds{20};
+  ExporterScope exporter{std::move(config)};
+
+  {
+    auto root = MakeRootSpan("slow");
+    auto child = root.CreateChild("child");
+    engine::SleepFor(std::chrono::milliseconds{30});
+  }
+  MakeRootSpan("fast");
+
+  const auto stats = exporter.Flush();
+  EXPECT_EQ(stats.exported, 2);
+  EXPECT_EQ(stats.sampled_out, 1);
+}
+
+UTEST_F(SpanExporter, TailSamplingTimeout) {
+  tracing::impl::SpanExporterConfig config;
+  config.sampling_probability = 0;
+  config.tail_keep_errors = true;
+  config.tail_decision_timeout = std::chrono::milliseconds{0};
+  ExporterScope exporter{std::move(config)};
+
+  // The local root outlives the child and the decision timeout
+  auto root = MakeRootSpan("root");
+  {
+    auto child = root.CreateChild("child");
+    child.AddTag(tracing::kErrorFlag, true);
+  }
+
+  EXPECT_EQ(exporter.Flush().exported, 1);
+}
+
+USERVER_NAMESPACE_END
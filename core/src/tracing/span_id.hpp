@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// @brief Trace or span id
+///
+/// Generated ids and the lowercase hex ids from the upstream services are
+/// kept as bytes and are hex-formatted only when their text is requested.
+/// Ids of other formats are kept as is.
+///
+/// Const methods may be called concurrently, the text is formatted once.
+template <std::size_t Size>
+class BinaryId final {
+ public:
+  using Bytes = std::array<std::uint8_t, Size>;
+
+  /// Empty id
+  BinaryId() = default;
+
+  explicit BinaryId(const Bytes& bytes) noexcept
+      : bytes_(bytes),
+        state_(State::kBinary),
+        format_state_(FormatState::kNotFormatted) {}
+
+  explicit BinaryId(std::string_view text) {
+    if (text.empty()) return;
+    if (ParseHex(text)) {
+      state_ = State::kBinary;
+      format_state_.store(FormatState::kNotFormatted,
+                          std::memory_order_relaxed);
+    } else {
+      text_ = text;
+      state_ = State::kText;
+    }
+  }
+
+  // The formatted text of a binary id is not copied, it is cheaper to format
+  // it again in the rare case it is needed
+  BinaryId(const BinaryId& other)
+      : bytes_(other.bytes_),
+        state_(other.state_),
+        format_state_(other.state_ == State::kBinary
+                          ? FormatState::kNotFormatted
+                          : FormatState::kFormatted),
+        text_(other.state_ == State::kText ? other.text_ : std::string{}) {}
+
+  BinaryId(BinaryId&& other) noexcept
+      : bytes_(other.bytes_),
+        state_(other.state_),
+        format_state_(other.format_state_.load(std::memory_order_relaxed)),
+        text_(std::move(other.text_)) {}
+
+  BinaryId& operator=(const BinaryId& other) {
+    if (this != &other) *this = BinaryId{other};
+    return *this;
+  }
+
+  BinaryId& operator=(BinaryId&& other) noexcept {
+    bytes_ = other.bytes_;
+    state_ = other.state_;
+    format_state_.store(other.format_state_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    text_ = std::move(other.text_);
+    return *this;
+  }
+
+  bool IsEmpty() const noexcept { return state_ == State::kEmpty; }
+
+  /// Bytes of the id, nullptr if the id is empty or has a foreign format
+  const Bytes* GetBytes() const noexcept {
+    return state_ == State::kBinary ? &bytes_ : nullptr;
+  }
+
+  /// Text of the id, formatted on the first call
+  const std::string& ToString() const& {
+    if (format_state_.load(std::memory_order_acquire) !=
+        FormatState::kFormatted) {
+      FormatOnce();
+    }
+    return text_;
+  }
+
+  std::string ToString() && {
+    if (format_state_.load(std::memory_order_relaxed) !=
+        FormatState::kFormatted) {
+      return Format();
+    }
+    return std::move(text_);
+  }
+
+ private:
+  enum class State : std::uint8_t { kEmpty, kBinary, kText };
+
+  enum class FormatState : std::uint8_t {
+    kNotFormatted,
+    kFormatting,
+    kFormatted,
+  };
+
+  // The first caller formats the text, the concurrent ones wait for it
+  void FormatOnce() const {
+    auto expected = FormatState::kNotFormatted;
+    if (format_state_.compare_exchange_strong(expected,
+                                              FormatState::kFormatting,
+                                              std::memory_order_acquire)) {
+      try {
+        text_ = Format();
+      } catch (...) {
+        format_state_.store(FormatState::kNotFormatted,
+                            std::memory_order_release);
+        throw;
+      }
+      format_state_.store(FormatState::kFormatted, std::memory_order_release);
+      return;
+    }
+
+    while (format_state_.load(std::memory_order_acquire) !=
+           FormatState::kFormatted) {
+      if (format_state_.load(std::memory_order_relaxed) ==
+          FormatState::kNotFormatted) {
+        // formatting has failed in the other thread
+        FormatOnce();
+        return;
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  // Only the lowercase ids are parsed, so that the text is restored exactly
+  static int LowercaseHexDigit(char c) noexcept {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  bool ParseHex(std::string_view text) noexcept {
+    if (text.size() != 2 * Size) return false;
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto high = LowercaseHexDigit(text[2 * i]);
+      const auto low = LowercaseHexDigit(text[2 * i + 1]);
+      if (high < 0 || low < 0) return false;
+      bytes_[i] = static_cast<std::uint8_t>(high * 16 + low);
+    }
+    return true;
+  }
+
+  std::string Format() const {
+    return utils::encoding::ToHex(bytes_.data(), bytes_.size());
+  }
+
+  Bytes bytes_{};
+  State state_{State::kEmpty};
+  // text_ of a binary id is written once, under kFormatting
+  mutable std::atomic<FormatState> format_state_{FormatState::kFormatted};
+  mutable std::string text_;
+};
+
+/// 128-bit trace id
+using TraceId = BinaryId<16>;
+
+/// 64-bit span id
+using SpanId = BinaryId<8>;
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
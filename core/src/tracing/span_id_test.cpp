@@ -0,0 +1,43 @@
+#include <tracing/span_id.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(SpanId, ParseAndFormat) {
+  const tracing::impl::SpanId id{"0123456789abcdef"};
+  ASSERT_NE(id.GetBytes(), nullptr);
+  EXPECT_EQ((*id.GetBytes())[0], 0x01);
+  EXPECT_EQ(id.ToString(), "0123456789abcdef");
+
+  const tracing::impl::SpanId foreign{"0123456789ABCDEF"};
+  EXPECT_EQ(foreign.GetBytes(), nullptr);
+  EXPECT_EQ(foreign.ToString(), "0123456789ABCDEF");
+
+  EXPECT_TRUE(tracing::impl::SpanId{}.IsEmpty());
+  EXPECT_EQ(tracing::impl::SpanId{}.ToString(), "");
+}
+
+TEST(SpanId, ConcurrentToString) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kRounds = 1000;
+
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    const tracing::impl::TraceId id{tracing::impl::TraceId::Bytes{
+        0xde, 0xad, 0xbe, 0xef, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+        static_cast<std::uint8_t>(round)}};
+    const auto expected = tracing::impl::TraceId{id}.ToString();
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&] { EXPECT_EQ(id.ToString(), expected); });
+    }
+    for (auto& thread : threads) thread.join();
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -16,6 +17,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 
+#include <tracing/span_id.hpp>
 #include <tracing/time_storage.hpp>
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -32,6 +34,11 @@ class ValueBuilder;
 
 namespace tracing {
 
+namespace impl {
+class SpanExporter;
+struct SpanRecord;
+}  // namespace impl
+
 class Span::Impl
     : public boost::intrusive::list_base_hook<
           boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
@@ -54,16 +61,16 @@ class Span::Impl
 
   void LogTo(logging::LogHelper& log_helper) &&;
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
+  const std::string& GetTraceId() const& { return trace_id_.ToString(); }
+  const std::string& GetSpanId() const& { return span_id_.ToString(); }
+  const std::string& GetParentId() const& { return parent_id_.ToString(); }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  std::string GetTraceId() && { return std::move(trace_id_).ToString(); }
+  std::string GetSpanId() && { return std::move(span_id_).ToString(); }
+  std::string GetParentId() && { return std::move(parent_id_).ToString(); }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-  void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+  void SetTraceId(std::string_view id) { trace_id_ = impl::TraceId{id}; }
+  void SetParentId(std::string_view id) { parent_id_ = impl::SpanId{id}; }
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
@@ -72,19 +79,29 @@ class Span::Impl
 
  private:
   void LogOpenTracing() const;
+  // Returns false if the span is sampled out and should not be logged
+  bool ExportSpan(impl::SpanExporter& exporter) const;
   static void AddOpentracingTags(formats::json::ValueBuilder& output,
                                  const logging::LogExtra& input);
+  static void AddExportedAttributes(impl::SpanRecord& span,
+                                    const logging::LogExtra& input);
 
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  static impl::SpanId GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
 
+  const logging::LogExtra& GetInheritableTags() const;
+  // Detaches the tags from the parent and the children before a change
+  logging::LogExtra& GetInheritableTagsForUpdate();
+
   const std::string name_;
   const bool is_no_log_span_;
   logging::Level log_level_;
   std::optional<logging::Level> local_log_level_;
 
   std::shared_ptr<Tracer> tracer_;
-  logging::LogExtra log_extra_inheritable_;
+  // Shared with the parent and the children until one of them changes
+  // the tags, nullptr if there are no tags
+  std::shared_ptr<logging::LogExtra> log_extra_inheritable_;
 
   Span* span_{nullptr};
 
@@ -94,10 +111,13 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  impl::TraceId trace_id_;
+  impl::SpanId span_id_;
+  impl::SpanId parent_id_;
   const ReferenceType reference_type_;
+  // The span has no parent in this process, so it finishes the local part of
+  // the trace
+  const bool is_local_root_;
 
   friend class Span;
 };
@@ -7,6 +7,8 @@
 #include <userver/tracing/opentracing.hpp>
 #include <userver/tracing/tags.hpp>
 
+#include <tracing/span_exporter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
@@ -67,6 +69,35 @@ const std::string kStartTime = "start_time";
 const std::string kStartTimeMillis = "start_time_millis";
 const std::string kDuration = "duration";
 }  // namespace jaeger
+
+impl::SpanRecord::AttributeValue ToAttributeValue(
+    const logging::LogExtra::Value& value, const std::string& type) {
+  return std::visit(
+      [&type](const auto& val) -> impl::SpanRecord::AttributeValue {
+        using Value = std::decay_t<decltype(val)>;
+        if constexpr (std::is_same_v<Value, std::string>) {
+          if (type == "bool") return val == "true" || val == "1";
+          return val;
+        } else if (type == "bool") {
+          return val != 0;
+        } else if (type == "int64") {
+          return static_cast<std::int64_t>(val);
+        } else {
+          return std::to_string(val);
+        }
+      },
+      value);
+}
+
+std::uint64_t ToExportedSpanId(const impl::SpanId& id) {
+  const auto* bytes = id.GetBytes();
+  if (!bytes) return impl::SpanIdToInt(id.ToString());
+
+  std::uint64_t result = 0;
+  for (const auto byte : *bytes) result = (result << 8) | byte;
+  return result;
+}
+
 }  // namespace
 
 void Span::Impl::LogOpenTracing() const {
@@ -86,16 +117,16 @@ void Span::Impl::LogOpenTracing() const {
   if (tracer_) {
     jaeger_span.Extend(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  jaeger_span.Extend(jaeger::kTraceId, trace_id_);
-  jaeger_span.Extend(jaeger::kParentId, parent_id_);
-  jaeger_span.Extend(jaeger::kSpanId, span_id_);
+  jaeger_span.Extend(jaeger::kTraceId, GetTraceId());
+  jaeger_span.Extend(jaeger::kParentId, GetParentId());
+  jaeger_span.Extend(jaeger::kSpanId, GetSpanId());
   jaeger_span.Extend(jaeger::kStartTime, start_time);
   jaeger_span.Extend(jaeger::kStartTimeMillis, start_time / 1000);
   jaeger_span.Extend(jaeger::kDuration, duration_microseconds);
   jaeger_span.Extend(jaeger::kOperationName, name_);
 
   formats::json::ValueBuilder tags{formats::common::Type::kArray};
-  AddOpentracingTags(tags, log_extra_inheritable_);
+  AddOpentracingTags(tags, GetInheritableTags());
   if (log_extra_local_) {
     AddOpentracingTags(tags, *log_extra_local_);
   }
@@ -104,6 +135,37 @@ void Span::Impl::LogOpenTracing() const {
   DO_LOG_TO_NO_SPAN(logger, log_level_) << std::move(jaeger_span);
 }
 
+bool Span::Impl::ExportSpan(impl::SpanExporter& exporter) const {
+  const auto* trace_id_bytes = trace_id_.GetBytes();
+  const auto trace_id = trace_id_bytes ? *trace_id_bytes
+                                       : impl::TraceIdToBytes(GetTraceId());
+  const bool head_sampled = exporter.IsHeadSampled(trace_id);
+  if (!head_sampled && !exporter.IsTailSamplingEnabled()) {
+    exporter.AccountSampledOut();
+    return false;
+  }
+
+  const auto duration = std::chrono::steady_clock::now() - start_steady_time_;
+  const auto start_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      start_system_time_.time_since_epoch());
+
+  impl::SpanRecord span;
+  span.trace_id = trace_id;
+  span.span_id = ToExportedSpanId(span_id_);
+  span.parent_span_id = ToExportedSpanId(parent_id_);
+  span.name = name_;
+  span.start_unix_nano = start_time.count();
+  span.end_unix_nano =
+      (start_time +
+       std::chrono::duration_cast<std::chrono::nanoseconds>(duration))
+          .count();
+  AddExportedAttributes(span, GetInheritableTags());
+  if (log_extra_local_) AddExportedAttributes(span, *log_extra_local_);
+
+  exporter.Push(std::move(span), head_sampled, is_local_root_);
+  return true;
+}
+
 void Span::Impl::AddOpentracingTags(formats::json::ValueBuilder& output,
                                     const logging::LogExtra& input) {
   const auto& opentracing_tags = jaeger::GetOpentracingTags();
@@ -117,6 +179,23 @@ void Span::Impl::AddOpentracingTags(formats::json::ValueBuilder& output,
   }
 }
 
+void Span::Impl::AddExportedAttributes(impl::SpanRecord& span,
+                                       const logging::LogExtra& input) {
+  const auto& opentracing_tags = jaeger::GetOpentracingTags();
+  for (const auto& [key, value] : *input.extra_) {
+    const auto tag_it = opentracing_tags.find(key);
+    if (tag_it == opentracing_tags.end()) continue;
+
+    const auto& tag = tag_it->second;
+    auto attribute = ToAttributeValue(value.GetValue(), tag.type);
+    if (key == kErrorFlag) {
+      const auto* is_error = std::get_if<bool>(&attribute);
+      span.is_error = is_error && *is_error;
+    }
+    span.attributes.emplace_back(tag.opentracing_name, std::move(attribute));
+  }
+}
+
 }  // namespace tracing
 
 USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/encoding/hex.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -110,6 +111,37 @@ UTEST_F(Span, InheritTag) {
   EXPECT_NE(std::string::npos, GetStreamString().find("k=v"));
 }
 
+UTEST_F(Span, InheritedTagsAreCopiedOnWrite) {
+  {
+    tracing::Span parent("parent_span");
+    parent.AddTag("k", "v");
+
+    auto child = parent.CreateChild("child_span");
+    parent.AddTag("parent_k", "parent_v");
+    child.AddTag("child_k", "child_v");
+  }
+  logging::LogFlush();
+
+  const auto log = GetStreamString();
+  const auto get_record = [&log](std::string_view name) {
+    const auto pos = log.find(name);
+    EXPECT_NE(pos, std::string::npos) << name;
+    const auto begin = log.rfind('\n', pos);
+    const auto end = log.find('\n', pos);
+    return log.substr(begin == std::string::npos ? 0 : begin, end - begin);
+  };
+
+  const auto parent_record = get_record("stopwatch_name=parent_span");
+  EXPECT_NE(parent_record.find("k=v"), std::string::npos);
+  EXPECT_NE(parent_record.find("parent_k=parent_v"), std::string::npos);
+  EXPECT_EQ(parent_record.find("child_k"), std::string::npos);
+
+  const auto child_record = get_record("stopwatch_name=child_span");
+  EXPECT_NE(child_record.find("k=v"), std::string::npos);
+  EXPECT_NE(child_record.find("child_k=child_v"), std::string::npos);
+  EXPECT_EQ(child_record.find("parent_k"), std::string::npos);
+}
+
 UTEST_F(Span, NonInheritTag) {
   tracing::Span span("span_name");
 
@@ -651,4 +683,38 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
   }
 }
 
+UTEST_F(Span, MakeSpanWithHexIds) {
+  const std::string trace_id = "0123456789abcdef0123456789abcdef";
+  const std::string parent_id = "fedcba9876543210";
+  const std::string uppercase_trace_id = "0123456789ABCDEF0123456789ABCDEF";
+
+  {
+    tracing::Span span = tracing::Span::MakeSpan("span", trace_id, parent_id);
+    EXPECT_EQ(span.GetTraceId(), trace_id);
+    EXPECT_EQ(span.GetParentId(), parent_id);
+
+    auto child = span.CreateChild("child");
+    EXPECT_EQ(child.GetTraceId(), trace_id);
+    EXPECT_EQ(child.GetParentId(), span.GetSpanId());
+  }
+  {
+    tracing::Span span =
+        tracing::Span::MakeSpan("span", uppercase_trace_id, parent_id);
+    EXPECT_EQ(span.GetTraceId(), uppercase_trace_id);
+  }
+}
+
+UTEST_F(Span, GeneratedIds) {
+  tracing::Span span("span");
+  EXPECT_EQ(span.GetTraceId().size(), 32);
+  EXPECT_EQ(span.GetSpanId().size(), 16);
+  EXPECT_TRUE(span.GetParentId().empty());
+  EXPECT_TRUE(utils::encoding::IsHexData(span.GetTraceId()));
+  EXPECT_TRUE(utils::encoding::IsHexData(span.GetSpanId()));
+
+  auto child = span.CreateChild("child");
+  EXPECT_EQ(child.GetTraceId(), span.GetTraceId());
+  EXPECT_EQ(child.GetParentId(), span.GetSpanId());
+}
+
 USERVER_NAMESPACE_END
@@ -1,23 +1,74 @@
 #include <benchmark/benchmark.h>
 
+#include <cstdlib>
+#include <new>
+
 #include <userver/engine/run_standalone.hpp>
 #include <userver/tracing/noop.hpp>
 #include <userver/tracing/opentracing.hpp>
 
+// This file is built into a separate userver-core_tracing_benchmark executable,
+// so the replaced operator new does not affect the other benchmarks
+
+namespace {
+// Counts the allocations of the current thread, the benchmarks run in a
+// single-threaded engine
+thread_local std::size_t allocations_count = 0;
+}  // namespace
+
+void* operator new(std::size_t size) {
+  ++allocations_count;
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
+void SetAllocationsCounter(benchmark::State& state,
+                           std::size_t allocations_before,
+                           std::size_t spans_per_iteration) {
+  state.counters["allocations_per_span"] = benchmark::Counter(
+      static_cast<double>(allocations_count - allocations_before) /
+          spans_per_iteration,
+      benchmark::Counter::kAvgIterations);
+}
+
 void tracing_noop_ctr(benchmark::State& state) {
   engine::RunStandalone([&] {
     auto tracer = tracing::MakeNoopTracer("test_service");
 
+    const auto allocations_before = allocations_count;
     for (auto _ : state)
       benchmark::DoNotOptimize(tracer->CreateSpanWithoutParent("name"));
+    SetAllocationsCounter(state, allocations_before, 1);
   });
 }
 BENCHMARK(tracing_noop_ctr);
 
+void tracing_child_spans(benchmark::State& state) {
+  constexpr std::size_t kChildSpans = 20;
+
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeNoopTracer("test_service");
+    auto root = tracer->CreateSpanWithoutParent("root");
+
+    const auto allocations_before = allocations_count;
+    for (auto _ : state) {
+      for (std::size_t i = 0; i < kChildSpans; ++i) {
+        benchmark::DoNotOptimize(root.CreateChild("child"));
+      }
+    }
+    SetAllocationsCounter(state, allocations_before, kChildSpans);
+  });
+}
+BENCHMARK(tracing_child_spans);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -31,9 +82,11 @@ void tracing_opentracing_ctr(benchmark::State& state) {
   engine::RunStandalone([&] {
     auto tracer = tracing::MakeNoopTracer("test_service");
     tracing::SetOpentracingLogger(logger);
+    const auto allocations_before = allocations_count;
     for (auto _ : state) {
       benchmark::DoNotOptimize(GetSpanWithOpentracingHttpTags(tracer));
     }
+    SetAllocationsCounter(state, allocations_before, 1);
     tracing::SetOpentracingLogger({});
   });
 }
@@ -0,0 +1,25 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <algorithm>
+#include <thread>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+std::size_t GetThreadShardIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+std::size_t GetShardCount() noexcept {
+  static const std::size_t count =
+      std::max(1u, std::thread::hardware_concurrency());
+  return count;
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
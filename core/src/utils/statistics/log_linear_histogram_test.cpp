@@ -0,0 +1,116 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Histogram = utils::statistics::LogLinearHistogram<3, 10>;
+
+}  // namespace
+
+TEST(LogLinearHistogram, Zero) {
+  Histogram h;
+
+  EXPECT_EQ(0U, h.Count());
+  EXPECT_EQ(0U, h.GetPercentile(0));
+  EXPECT_EQ(0U, h.GetPercentile(50));
+  EXPECT_EQ(0U, h.GetPercentile(100));
+}
+
+TEST(LogLinearHistogram, Buckets) {
+  for (std::size_t value = 0; value < 8; ++value) {
+    EXPECT_EQ(value, Histogram::ValueToBucket(value));
+    EXPECT_EQ(value, Histogram::BucketToValue(value));
+  }
+
+  EXPECT_EQ(8U, Histogram::ValueToBucket(8));
+  EXPECT_EQ(15U, Histogram::ValueToBucket(15));
+  EXPECT_EQ(16U, Histogram::ValueToBucket(16));
+  EXPECT_EQ(16U, Histogram::ValueToBucket(17));
+  EXPECT_EQ(17U, Histogram::ValueToBucket(18));
+  EXPECT_EQ(18U, Histogram::BucketToValue(17));
+
+  EXPECT_EQ(Histogram::kBuckets - 1, Histogram::ValueToBucket(1023));
+  EXPECT_EQ(Histogram::kBuckets - 1, Histogram::ValueToBucket(1'000'000));
+  EXPECT_EQ(960U, Histogram::BucketToValue(Histogram::kBuckets - 1));
+
+  // Lower bound of the bucket is within the declared precision
+  for (std::size_t value = 1; value < 1024; ++value) {
+    const auto lower =
+        Histogram::BucketToValue(Histogram::ValueToBucket(value));
+    EXPECT_LE(lower, value);
+    EXPECT_LE(value - lower, value / 8) << value;
+  }
+}
+
+TEST(LogLinearHistogram, Hundred) {
+  Histogram h;
+
+  for (int i = 0; i < 100; i++) h.Account(i);
+
+  EXPECT_EQ(100U, h.Count());
+  EXPECT_EQ(0U, h.GetPercentile(0));
+  EXPECT_EQ(48U, h.GetPercentile(50));
+  EXPECT_EQ(88U, h.GetPercentile(90));
+  EXPECT_EQ(96U, h.GetPercentile(100));
+  EXPECT_EQ(96U, h.GetPercentile(200));
+}
+
+TEST(LogLinearHistogram, AddAndCopy) {
+  Histogram a;
+  Histogram b;
+  a.Account(1);
+  b.Account(5);
+  b.Account(5);
+
+  a.Add(b);
+  EXPECT_EQ(3U, a.Count());
+  EXPECT_EQ(5U, a.GetPercentile(50));
+
+  Histogram copy = a;
+  a.Reset();
+  EXPECT_EQ(0U, a.Count());
+  EXPECT_EQ(3U, copy.Count());
+  EXPECT_EQ(1U, copy.GetPercentile(0));
+
+  Histogram moved = std::move(copy);
+  EXPECT_EQ(3U, moved.Count());
+}
+
+TEST(LogLinearHistogram, ManyThreads) {
+  constexpr std::size_t kThreads = 8;
+  constexpr std::size_t kIterations = 10000;
+  Histogram h;
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&h, i] {
+      for (std::size_t j = 0; j < kIterations; ++j) h.Account(i);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(kThreads * kIterations, h.Count());
+  EXPECT_EQ(0U, h.GetPercentile(0));
+  EXPECT_EQ(4U, h.GetPercentile(50));
+  EXPECT_EQ(7U, h.GetPercentile(100));
+}
+
+TEST(LogLinearHistogram, RecentPeriod) {
+  utils::statistics::RecentPeriod<Histogram, Histogram> period;
+  period.GetCurrentCounter().Account(42);
+
+  const auto stats = period.GetStatsForPeriod(
+      std::chrono::steady_clock::duration::min(), true);
+  EXPECT_EQ(1U, stats.Count());
+  EXPECT_EQ(40U, stats.GetPercentile(100));
+}
+
+USERVER_NAMESPACE_END
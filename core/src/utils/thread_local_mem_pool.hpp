@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// Keeps the memory of up to kMaxSize destroyed objects of type T per thread
+/// to construct new objects in it without a heap allocation
+template <typename T>
+class ThreadLocalMemPool {
+ public:
+  static constexpr size_t kMaxSize = 1000;
+
+  template <typename... Args>
+  static std::unique_ptr<T> Pop(Args&&... args) {
+    auto& pool = GetPool();
+    if (pool.empty()) {
+      return std::make_unique<T>(std::forward<Args>(args)...);
+    }
+
+    auto& raw = pool.back();
+    // if ctor throws, memory remains in pool
+    new (raw.get()) T(std::forward<Args>(args)...);
+    // arm dtor, transfer ownership (noexcept)
+    std::unique_ptr<T> obj(reinterpret_cast<T*>(raw.release()));
+    // prune pool
+    pool.pop_back();
+    return obj;
+  }
+
+  // NOTE: Push might be called from a different thread than the one we got
+  // the object from (where the Pop() has been called). Because of this
+  // the object state must be completely torn down.
+  static void Push(std::unique_ptr<T> obj) {
+    // disarm dtor, transfer ownership (noexcept)
+    std::unique_ptr<StorageType> raw(
+        reinterpret_cast<StorageType*>(obj.release()));
+    // call dtor (might throw). It may also suspend the coroutine, which may
+    // be resumed on another thread, so the pool is looked up after it.
+    reinterpret_cast<T*>(raw.get())->~T();
+
+    auto& pool = GetPool();
+    if (pool.size() >= kMaxSize) return;
+
+    // store into pool (may throw on container allocation)
+    pool.push_back(std::move(raw));
+  }
+
+ private:
+  using StorageType = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+  static auto& GetPool() {
+    thread_local std::vector<std::unique_ptr<StorageType>> pool_;
+    return pool_;
+  }
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
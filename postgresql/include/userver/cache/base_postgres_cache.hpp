@@ -6,6 +6,8 @@
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
 #include <chrono>
+#include <functional>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
@@ -22,9 +24,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -62,6 +66,12 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL, 0 to fetch all rows in one request | 1000
+/// listen-channel | channel to LISTEN on, each notification starts an incremental update | -
+///
+/// With `listen-channel` set the cache is updated shortly after the data
+/// changes, provided the changes are followed by a NOTIFY on the channel,
+/// e.g. from a trigger. Periodic updates still run, so `update-interval` may
+/// be increased to reduce the load on the database.
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -354,6 +364,13 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+/// Calls `on_notify` for the notifications on the channel until the task is
+/// cancelled, subscribes again after errors. Notifications that arrive before
+/// a call are coalesced into it, errors of `on_notify` are logged.
+void ListenNotifications(storages::postgres::Cluster& cluster,
+                         const std::string& channel,
+                         const std::function<void()>& on_notify);
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -412,6 +429,9 @@ class PostgreCache final
   static std::chrono::milliseconds ParseCorrection(
       const ComponentConfig& config);
 
+  void StartListening(const std::string& channel);
+  void StopListening() noexcept;
+
   std::vector<storages::postgres::ClusterPtr> clusters_;
 
   const std::chrono::system_clock::duration correction_;
@@ -420,6 +440,7 @@ class PostgreCache final
   const std::size_t chunk_size_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
+  std::vector<engine::TaskWithResult<void>> listen_tasks_;
 };
 
 template <typename PostgreCachePolicy>
@@ -470,13 +491,53 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
              << GetDeltaQuery().Statement() << "`";
 
   this->StartPeriodicUpdates();
+
+  const auto listen_channel = config["listen-channel"].As<std::string>("");
+  if (!listen_channel.empty()) {
+    StartListening(listen_channel);
+  }
 }
 
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
+  StopListening();
   this->StopPeriodicUpdates();
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::StartListening(
+    const std::string& channel) {
+  const auto update_type = this->GetAllowedUpdateTypes() ==
+                                   cache::AllowedUpdateTypes::kOnlyFull
+                               ? cache::UpdateType::kFull
+                               : cache::UpdateType::kIncremental;
+  LOG_INFO() << "Cache " << kName << " is updated on notifications on channel '"
+             << channel << "'";
+
+  listen_tasks_.reserve(clusters_.size());
+  for (auto& cluster : clusters_) {
+    listen_tasks_.push_back(utils::CriticalAsync(
+        this->GetCacheTaskProcessor(), "pg-cache-listen/" + this->Name(),
+        [this, cluster, channel, update_type] {
+          pg_cache::detail::ListenNotifications(
+              *cluster, channel, [this, update_type] {
+                cache::CacheUpdateTrait::Update(update_type);
+              });
+        }));
+  }
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::StopListening() noexcept {
+  for (auto& task : listen_tasks_) {
+    task.RequestCancel();
+  }
+  for (auto& task : listen_tasks_) {
+    task.SyncCancel();
+  }
+  listen_tasks_.clear();
+}
+
 template <typename PostgreCachePolicy>
 storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetAllQuery() {
   storages::postgres::Query query = PolicyCheckerType::GetQuery();
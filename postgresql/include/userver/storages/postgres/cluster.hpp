@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::postgres::Cluster
 
 #include <memory>
+#include <string_view>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -14,6 +15,7 @@
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/database.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/statistics.hpp>
@@ -191,6 +193,16 @@ class Cluster {
                     const Query& query, const ParameterStore& store);
   /// @}
 
+  /// @brief Listen for asynchronous notifications on the channel.
+  ///
+  /// The returned scope holds a connection to the master host until it is
+  /// destroyed. LISTEN and UNLISTEN use the timeouts from `cmd_ctl`, waiting
+  /// for notifications is limited by the deadline passed to
+  /// NotifyScope::WaitNotify only.
+  /// @throws ClusterUnavailable if the master host is not available
+  NotifyScope Listen(std::string_view channel,
+                     OptionalCommandControl cmd_ctl = {});
+
   /// Replaces globally updated command control with a static user-provided one
   void SetDefaultCommandControl(CommandControl);
 
@@ -41,6 +41,11 @@ enum class ClusterHostType {
 
   /// Chooses a host with the lowest RTT
   kNearest = 0x10,
+
+  /// Chooses a host with the lowest load score: the moving average of
+  /// statement execution time multiplied by the number of busy and waited for
+  /// connections. See ClusterSettings::least_loaded_two_choices.
+  kLeastLoaded = 0x20,
   /// @}
 };
 
@@ -51,7 +56,8 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSlave};
 
 constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
-    ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+    ClusterHostType::kRoundRobin, ClusterHostType::kNearest,
+    ClusterHostType::kLeastLoaded};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
@@ -129,6 +129,7 @@ namespace components {
 /// max_queue_size          | maximum number of clients waiting for a connection        | 200
 /// pipeline_enabled        | turn on pipeline mode                                     | false
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// least_loaded_two_choices | compare two random hosts instead of all of them for ClusterHostType::kLeastLoaded | false
 
 // clang-format on
 
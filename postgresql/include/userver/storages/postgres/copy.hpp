@@ -0,0 +1,185 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Binary COPY FROM STDIN / COPY TO STDOUT streams
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Stream of rows for a `COPY ... FROM STDIN (FORMAT binary)`
+/// statement.
+///
+/// Rows are serialized with the same formatters as query parameters and are
+/// sent to the server in chunks of about kFlushThreshold bytes. Finish() must
+/// be called to complete the statement, otherwise the COPY is aborted in
+/// destructor and the transaction becomes unusable.
+///
+/// The object must not outlive the transaction it was created in, no other
+/// statements may be run in the transaction until the COPY is finished.
+///
+/// @code
+/// auto copy = trx.MakeCopyIn("COPY foo(id, name) FROM STDIN (FORMAT binary)");
+/// for (const auto& [id, name] : rows) copy.WriteRow(id, name);
+/// const auto rows_copied = copy.Finish();
+/// @endcode
+class CopyIn {
+ public:
+  /// Size of the accumulated data that triggers sending it to the server
+  static constexpr std::size_t kFlushThreshold = 64 * 1024;
+
+  CopyIn(detail::Connection* conn, const Query& query,
+         OptionalCommandControl cmd_ctl = {});
+
+  CopyIn(CopyIn&&) noexcept;
+  CopyIn& operator=(CopyIn&&) = delete;
+
+  CopyIn(const CopyIn&) = delete;
+  CopyIn& operator=(const CopyIn&) = delete;
+
+  ~CopyIn();
+
+  /// Write a row, columns must go in the order of the COPY column list
+  template <typename... Columns>
+  void WriteRow(const Columns&... columns);
+
+  /// Write a row from a tuple or a user row type
+  template <typename Row>
+  void WriteRow(RowTag, const Row& row);
+
+  /// Write a container of tuples or of user row types
+  template <typename Container>
+  void WriteRows(const Container& rows);
+
+  /// Send the rest of the data and complete the statement
+  /// @returns number of rows copied as reported by the server
+  std::size_t Finish();
+
+  std::size_t RowsWritten() const { return rows_written_; }
+
+ private:
+  const UserTypes& BeginRow(std::size_t columns_count);
+  void EndRow();
+  void Flush();
+
+  detail::Connection* conn_;
+  std::string buffer_;
+  std::size_t rows_written_{0};
+  bool finished_{false};
+};
+
+/// @brief Stream of rows of a `COPY ... TO STDOUT (FORMAT binary)` statement.
+///
+/// Rows are received one by one and parsed with the same parsers as result
+/// sets. If the stream is destroyed before all the rows are read, the
+/// statement is cancelled and the transaction becomes unusable.
+///
+/// The object must not outlive the transaction it was created in, no other
+/// statements may be run in the transaction until all the rows are read.
+///
+/// @code
+/// auto copy = trx.MakeCopyOut("COPY foo(id, name) TO STDOUT (FORMAT binary)");
+/// int id{};
+/// std::string name;
+/// while (copy.ReadRow(id, name)) {
+///   ...
+/// }
+/// @endcode
+class CopyOut {
+ public:
+  CopyOut(detail::Connection* conn, const Query& query,
+          OptionalCommandControl cmd_ctl = {});
+
+  CopyOut(CopyOut&&) noexcept;
+  CopyOut& operator=(CopyOut&&) = delete;
+
+  CopyOut(const CopyOut&) = delete;
+  CopyOut& operator=(const CopyOut&) = delete;
+
+  ~CopyOut();
+
+  /// Read the next row into the columns
+  /// @returns false if there are no more rows
+  /// @throws FieldTupleMismatch if the row has another number of columns
+  template <typename... Columns>
+  bool ReadRow(Columns&... columns);
+
+  /// Read the next row into a tuple or a user row type
+  template <typename Row>
+  bool ReadRow(RowTag, Row& row);
+
+  bool Done() const { return done_; }
+  std::size_t RowsRead() const { return rows_read_; }
+
+  explicit operator bool() const { return !Done(); }
+
+ private:
+  bool BeginRow(io::FieldBuffer& row, std::size_t columns_count);
+  void EndRow(const io::FieldBuffer& row);
+  bool FetchData();
+  void ReadHeader();
+  const io::TypeBufferCategory& GetTypeBufferCategories() const;
+
+  detail::Connection* conn_;
+  std::string data_;
+  std::size_t offset_{0};
+  std::size_t rows_read_{0};
+  bool header_read_{false};
+  bool done_{false};
+};
+
+template <typename... Columns>
+void CopyIn::WriteRow(const Columns&... columns) {
+  static_assert(sizeof...(Columns) > 0, "A row must have columns");
+  const auto& types = BeginRow(sizeof...(Columns));
+  (io::WriteRawBinary(types, buffer_, columns), ...);
+  EndRow();
+}
+
+template <typename Row>
+void CopyIn::WriteRow(RowTag, const Row& row) {
+  std::apply([this](const auto&... columns) { WriteRow(columns...); },
+             io::RowType<Row>::GetTuple(row));
+}
+
+template <typename Container>
+void CopyIn::WriteRows(const Container& rows) {
+  for (const auto& row : rows) {
+    WriteRow(kRowTag, row);
+  }
+}
+
+template <typename... Columns>
+bool CopyOut::ReadRow(Columns&... columns) {
+  static_assert(sizeof...(Columns) > 0, "A row must have columns");
+  io::FieldBuffer row;
+  if (!BeginRow(row, sizeof...(Columns))) return false;
+  const auto& categories = GetTypeBufferCategories();
+  (row.ReadRaw(columns, categories, io::traits::kTypeBufferCategory<Columns>),
+   ...);
+  EndRow(row);
+  return true;
+}
+
+template <typename Row>
+bool CopyOut::ReadRow(RowTag, Row& row) {
+  return std::apply(
+      [this](auto&... columns) { return ReadRow(columns...); },
+      io::RowType<Row>::GetTuple(row));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
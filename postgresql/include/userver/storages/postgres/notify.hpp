@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/storages/postgres/notify.hpp
+/// @brief Asynchronous notifications (LISTEN/NOTIFY) support
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Asynchronous notification sent with NOTIFY or pg_notify()
+struct Notification {
+  /// Channel name
+  std::string channel;
+  /// Payload, if any
+  std::optional<std::string> payload;
+  /// Process id of the notifying server backend
+  int backend_pid{0};
+};
+
+/// @brief RAII subscription to a channel of asynchronous notifications.
+///
+/// Holds a connection to the master host for its whole lifetime, the
+/// connection is returned to the pool after UNLISTEN in the destructor.
+/// Notifications that arrive between the calls to WaitNotify() are buffered
+/// and returned by the next calls in the order of arrival.
+///
+/// Obtained with Cluster::Listen.
+///
+/// @code
+/// auto scope = cluster->Listen("orders_changed");
+/// while (!engine::current_task::ShouldCancel()) {
+///   auto notification = scope.WaitNotify(engine::Deadline{});
+///   ...
+/// }
+/// @endcode
+class NotifyScope {
+ public:
+  NotifyScope(detail::ConnectionPtr conn, std::string_view channel,
+              OptionalCommandControl cmd_ctl);
+  ~NotifyScope();
+
+  NotifyScope(NotifyScope&&) noexcept;
+  NotifyScope& operator=(NotifyScope&&) noexcept;
+
+  NotifyScope(const NotifyScope&) = delete;
+  NotifyScope& operator=(const NotifyScope&) = delete;
+
+  /// @brief Wait for a notification on the channel
+  /// @throws ConnectionTimeoutError if the deadline is reached
+  /// @throws ConnectionInterrupted if the task is cancelled
+  Notification WaitNotify(engine::Deadline deadline);
+
+ private:
+  void Unlisten();
+
+  detail::ConnectionPtr conn_;
+  std::string channel_;
+  OptionalCommandControl cmd_ctl_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -277,6 +277,10 @@ struct ClusterSettings {
 
   /// database name
   std::string db_name;
+
+  /// ClusterHostType::kLeastLoaded compares two random hosts instead of all
+  /// of them (power of two choices)
+  bool least_loaded_two_choices = false;
 };
 
 }  // namespace storages::postgres
@@ -0,0 +1,118 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_queue.hpp
+/// @brief @copybrief storages::postgres::QueryQueue
+
+#include <exception>
+#include <vector>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+
+struct QueuedQuery {
+  QueuedQuery(const Query& query, DynamicQueryParameters&& params)
+      : query{query}, params{std::move(params)} {}
+
+  // Parameter buffers are referenced by pointers, a copy would dangle
+  QueuedQuery(QueuedQuery&&) = default;
+  QueuedQuery& operator=(QueuedQuery&&) = default;
+
+  Query query;
+  DynamicQueryParameters params;
+};
+
+}  // namespace detail
+
+/// @brief A batch of independent statements sent to the server in one
+/// round trip.
+///
+/// Statements are queued with Push() and sent with Collect() in a single
+/// libpq pipeline, each one is followed by a sync point. A failure of a
+/// statement is reported in its own Result and does not prevent other
+/// statements from executing, unless they run in a transaction block: an
+/// error aborts the transaction and the rest of the statements fail too.
+///
+/// The object must not outlive the transaction it was created in.
+///
+/// @code
+/// auto queue = trx.MakeQueryQueue();
+/// queue.Push("SELECT name FROM users WHERE id = $1", user_id);
+/// queue.Push("SELECT count(*) FROM orders WHERE user_id = $1", user_id);
+/// auto results = queue.Collect();
+/// auto name = results[0].Get().AsSingleRow<std::string>();
+/// @endcode
+class QueryQueue {
+ public:
+  /// @brief Outcome of a single queued statement
+  class Result {
+   public:
+    explicit Result(ResultSet result) : result_{std::move(result)} {}
+    explicit Result(std::exception_ptr error) : error_{std::move(error)} {}
+
+    bool HasError() const { return !!error_; }
+    std::exception_ptr GetError() const { return error_; }
+
+    /// @returns the result set of the statement
+    /// @throws the error of the statement if it has failed
+    const ResultSet& Get() const {
+      if (error_) std::rethrow_exception(error_);
+      return result_;
+    }
+
+   private:
+    ResultSet result_{nullptr};
+    std::exception_ptr error_;
+  };
+
+  QueryQueue(detail::Connection* conn, OptionalCommandControl cmd_ctl = {});
+
+  QueryQueue(QueryQueue&&) noexcept;
+  QueryQueue& operator=(QueryQueue&&) noexcept;
+
+  QueryQueue(const QueryQueue&) = delete;
+  QueryQueue& operator=(const QueryQueue&) = delete;
+
+  ~QueryQueue();
+
+  /// Queue a statement with arbitrary parameters
+  template <typename... Args>
+  void Push(const Query& query, const Args&... args);
+
+  std::size_t Size() const { return queries_.size(); }
+  bool IsEmpty() const { return queries_.empty(); }
+
+  /// @brief Send the queued statements and wait for all of the results.
+  ///
+  /// The queue is empty afterwards and may be reused.
+  /// @returns results in the order the statements were queued
+  /// @throws network errors and timeouts, statement errors are returned in
+  /// the results
+  std::vector<Result> Collect();
+
+ private:
+  const UserTypes& GetConnectionUserTypes() const;
+
+  detail::Connection* conn_;
+  OptionalCommandControl cmd_ctl_;
+  std::vector<detail::QueuedQuery> queries_;
+};
+
+template <typename... Args>
+void QueryQueue::Push(const Query& query, const Args&... args) {
+  detail::DynamicQueryParameters params;
+  params.Write(GetConnectionUserTypes(), args...);
+  queries_.emplace_back(query, std::move(params));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
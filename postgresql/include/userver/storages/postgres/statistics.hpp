@@ -203,6 +203,11 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
   }
 
   std::unordered_map<std::string, Percentile> statement_timings;
+
+  /// Load score of the instance for ClusterHostType::kLeastLoaded
+  double load_score = 0;
+  /// Moving average of statement execution time in microseconds
+  double statement_latency_us = 0;
 };
 
 /// @brief Instance statistics with description
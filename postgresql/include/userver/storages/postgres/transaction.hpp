@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -14,6 +15,7 @@
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -257,6 +259,31 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// @brief Create a queue of statements to be sent to the server in a
+  /// single round trip, @see QueryQueue
+  QueryQueue MakeQueryQueue(OptionalCommandControl statement_cmd_ctl = {});
+
+  /// @brief Execute the statements of the queue in a single round trip.
+  ///
+  /// Same as QueryQueue::Collect().
+  std::vector<QueryQueue::Result> ExecuteBatch(QueryQueue& queue);
+
+  /// @brief Start a `COPY ... FROM STDIN (FORMAT binary)` statement and
+  /// return a stream to write the rows to.
+  ///
+  /// The statement must request the binary format, parameters are not
+  /// supported by COPY. Not available in pipeline mode.
+  CopyIn MakeCopyIn(const Query& query,
+                    OptionalCommandControl statement_cmd_ctl = {});
+
+  /// @brief Start a `COPY ... TO STDOUT (FORMAT binary)` statement and
+  /// return a stream to read the rows from.
+  ///
+  /// The statement must request the binary format, parameters are not
+  /// supported by COPY. Not available in pipeline mode.
+  CopyOut MakeCopyOut(const Query& query,
+                      OptionalCommandControl statement_cmd_ctl = {});
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
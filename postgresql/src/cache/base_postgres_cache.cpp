@@ -1,5 +1,10 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -32,9 +37,58 @@ properties:
         type: string
         description: PostgreSQL component name
         defaultDescription: ""
+    listen-channel:
+        type: string
+        description: channel to LISTEN on, each notification starts an incremental update
+        defaultDescription: ""
 )";
 }
 
 }  // namespace components::impl
 
+namespace components::pg_cache::detail {
+
+namespace {
+constexpr std::chrono::seconds kListenRetryInterval{1};
+
+// Drops the notifications that are already buffered or readable without
+// waiting, a single update covers all of them
+void SkipPendingNotifications(storages::postgres::NotifyScope& scope) {
+  try {
+    while (true) scope.WaitNotify(engine::Deadline::Passed());
+  } catch (const storages::postgres::ConnectionTimeoutError&) {
+    // no more notifications
+  }
+}
+}  // namespace
+
+void ListenNotifications(storages::postgres::Cluster& cluster,
+                         const std::string& channel,
+                         const std::function<void()>& on_notify) {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto scope = cluster.Listen(channel);
+      while (true) {
+        scope.WaitNotify(engine::Deadline{});
+        SkipPendingNotifications(scope);
+        try {
+          on_notify();
+        } catch (const std::exception& e) {
+          if (engine::current_task::ShouldCancel()) throw;
+          // the subscription is fine, the next notification retries
+          LOG_WARNING() << "Update on a notification on channel '" << channel
+                        << "' failed: " << e;
+        }
+      }
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_WARNING() << "Listening on channel '" << channel
+                    << "' failed: " << e;
+    }
+    engine::InterruptibleSleepFor(kListenRetryInterval);
+  }
+}
+
+}  // namespace components::pg_cache::detail
+
 USERVER_NAMESPACE_END
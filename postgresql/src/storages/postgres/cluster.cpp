@@ -82,6 +82,11 @@ void Cluster::SetStatementMetricsSettings(
   pimpl_->SetStatementMetricsSettings(settings);
 }
 
+NotifyScope Cluster::Listen(std::string_view channel,
+                            OptionalCommandControl cmd_ctl) {
+  return pimpl_->Listen(channel, cmd_ctl);
+}
+
 detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
                                       OptionalCommandControl cmd_ctl) {
   return pimpl_->Start(flags, cmd_ctl);
@@ -30,6 +30,8 @@ const char* ToStringRaw(ClusterHostType ht) {
       return "round-robin";
     case ClusterHostType::kNearest:
       return "nearest";
+    case ClusterHostType::kLeastLoaded:
+      return "least-loaded";
   }
   const auto msg = fmt::format("invalid host type {} in ToStringRaw",
                                USERVER_NAMESPACE::utils::UnderlyingValue(ht));
@@ -46,7 +48,8 @@ std::string ToString(ClusterHostTypeFlags flags) {
 
   for (const auto role : {ClusterHostType::kMaster, ClusterHostType::kSyncSlave,
                           ClusterHostType::kSlave, ClusterHostType::kRoundRobin,
-                          ClusterHostType::kNearest}) {
+                          ClusterHostType::kNearest,
+                          ClusterHostType::kLeastLoaded}) {
     if (flags & role) {
       if (!result.empty()) result += '|';
       result += ToStringRaw(role);
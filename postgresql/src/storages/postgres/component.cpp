@@ -97,6 +97,10 @@ formats::json::ValueBuilder InstanceStatisticsToJson(
   instance["roundtrip-time"] = stats.topology.roundtrip_time;
   instance["replication-lag"] = stats.topology.replication_lag;
 
+  auto load = instance["load"];
+  load["score"] = stats.load_score;
+  load["statement-latency-us"] = stats.statement_latency_us;
+
   if (!stats.statement_timings.empty()) {
     auto timings = instance["statement_timings"];
     utils::statistics::SolomonChildrenAreLabelValues(timings,
@@ -210,6 +214,8 @@ Postgres::Postgres(const ComponentConfig& config,
                                    ? storages::postgres::InitMode::kSync
                                    : storages::postgres::InitMode::kAsync;
   cluster_settings.db_name = db_name_;
+  cluster_settings.least_loaded_two_choices =
+      config["least_loaded_two_choices"].As<bool>(false);
 
   storages::postgres::TopologySettings& topology_settings =
       cluster_settings.topology_settings;
@@ -421,6 +427,10 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    least_loaded_two_choices:
+        type: boolean
+        description: compare two random hosts instead of all of them for least loaded host selection
+        defaultDescription: false
 )");
 }
 
@@ -0,0 +1,192 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kSignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr Smallint kTrailer = -1;
+
+constexpr const char* kCopyInAbortedMessage =
+    "COPY FROM STDIN was aborted by the client";
+
+io::FieldBuffer MakeFieldBuffer(const std::string& data, std::size_t offset) {
+  return io::FieldBuffer{
+      false, io::BufferCategory::kPlainBuffer, data.size() - offset,
+      reinterpret_cast<const std::uint8_t*>(data.data() + offset)};
+}
+
+}  // namespace
+
+CopyIn::CopyIn(detail::Connection* conn, const Query& query,
+               OptionalCommandControl cmd_ctl)
+    : conn_{conn} {
+  UASSERT(conn_);
+  if (!cmd_ctl) {
+    cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyInStart(query, std::move(cmd_ctl));
+
+  const auto& types = conn_->GetUserTypes();
+  buffer_.reserve(kFlushThreshold);
+  buffer_.append(kSignature);
+  // flags field
+  io::WriteBuffer(types, buffer_, Integer{0});
+  // header extension area length
+  io::WriteBuffer(types, buffer_, Integer{0});
+}
+
+CopyIn::CopyIn(CopyIn&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      buffer_{std::move(other.buffer_)},
+      rows_written_{other.rows_written_},
+      finished_{other.finished_} {}
+
+CopyIn::~CopyIn() {
+  if (!conn_ || finished_) return;
+  try {
+    conn_->CopyInAbort(kCopyInAbortedMessage);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to abort COPY FROM STDIN: " << e;
+  }
+}
+
+std::size_t CopyIn::Finish() {
+  if (!conn_ || finished_) {
+    throw LogicError{"COPY FROM STDIN is already finished"};
+  }
+  io::WriteBuffer(conn_->GetUserTypes(), buffer_, kTrailer);
+  Flush();
+  finished_ = true;
+  return conn_->CopyInEnd();
+}
+
+const UserTypes& CopyIn::BeginRow(std::size_t columns_count) {
+  if (!conn_ || finished_) {
+    throw LogicError{"COPY FROM STDIN is already finished"};
+  }
+  const auto& types = conn_->GetUserTypes();
+  io::WriteBuffer(types, buffer_, static_cast<Smallint>(columns_count));
+  return types;
+}
+
+void CopyIn::EndRow() {
+  ++rows_written_;
+  if (buffer_.size() >= kFlushThreshold) Flush();
+}
+
+void CopyIn::Flush() {
+  if (buffer_.empty()) return;
+  conn_->CopyInPutData(buffer_);
+  buffer_.clear();
+}
+
+CopyOut::CopyOut(detail::Connection* conn, const Query& query,
+                 OptionalCommandControl cmd_ctl)
+    : conn_{conn} {
+  UASSERT(conn_);
+  if (!cmd_ctl) {
+    cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  conn_->CopyOutStart(query, std::move(cmd_ctl));
+}
+
+CopyOut::CopyOut(CopyOut&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      data_{std::move(other.data_)},
+      offset_{other.offset_},
+      rows_read_{other.rows_read_},
+      header_read_{other.header_read_},
+      done_{other.done_} {}
+
+CopyOut::~CopyOut() {
+  if (!conn_ || done_) return;
+  try {
+    conn_->CopyOutAbort();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to abort COPY TO STDOUT: " << e;
+  }
+}
+
+bool CopyOut::BeginRow(io::FieldBuffer& row, std::size_t columns_count) {
+  if (done_) return false;
+  if (!conn_) {
+    throw LogicError{"COPY TO STDOUT stream is not valid"};
+  }
+  if (offset_ == data_.size() && !FetchData()) {
+    throw InvalidBinaryBuffer{"COPY data ended without a trailer"};
+  }
+  if (!header_read_) {
+    ReadHeader();
+    if (offset_ == data_.size() && !FetchData()) {
+      throw InvalidBinaryBuffer{"COPY data ended without a trailer"};
+    }
+  }
+
+  row = MakeFieldBuffer(data_, offset_);
+  Smallint fields_count{0};
+  row.Read(fields_count, io::BufferCategory::kPlainBuffer);
+  if (fields_count == kTrailer) {
+    // The result of the statement is fetched after the data ends
+    while (FetchData()) {
+    }
+    done_ = true;
+    return false;
+  }
+  if (fields_count < 0 ||
+      static_cast<std::size_t>(fields_count) != columns_count) {
+    throw FieldTupleMismatch{static_cast<std::size_t>(fields_count),
+                             columns_count};
+  }
+  return true;
+}
+
+void CopyOut::EndRow(const io::FieldBuffer& row) {
+  offset_ = data_.size() - row.length;
+  ++rows_read_;
+}
+
+bool CopyOut::FetchData() {
+  offset_ = 0;
+  if (conn_->CopyOutGetData(data_)) return true;
+  data_.clear();
+  return false;
+}
+
+void CopyOut::ReadHeader() {
+  auto header = MakeFieldBuffer(data_, offset_);
+  if (header.length < kSignature.size() + 2 * sizeof(Integer) ||
+      header.ToString().compare(0, kSignature.size(), kSignature) != 0) {
+    throw InvalidBinaryBuffer{
+        "COPY data does not start with a binary format signature"};
+  }
+  header = header.GetSubBuffer(kSignature.size());
+  Integer flags{0};
+  Integer extension_length{0};
+  header.Read(flags, io::BufferCategory::kPlainBuffer);
+  header.Read(extension_length, io::BufferCategory::kPlainBuffer);
+  if (extension_length < 0 ||
+      static_cast<std::size_t>(extension_length) > header.length) {
+    throw InvalidBinaryBuffer{"Invalid COPY header extension length"};
+  }
+  offset_ = data_.size() - header.length + extension_length;
+  header_read_ = true;
+}
+
+const io::TypeBufferCategory& CopyOut::GetTypeBufferCategories() const {
+  return conn_->GetUserTypes().GetTypeBufferCategories();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/engine/async.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
@@ -27,35 +28,17 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
-  UASSERT(!indices.empty());
-  if (indices.empty()) {
-    throw ClusterError("Cannot select host from an empty list");
-  }
-
-  const auto strategy_flags = flags & kClusterHostStrategyMask;
-  LOG_TRACE() << "Applying " << strategy_flags << " strategy";
-
-  size_t idx_pos = 0;
-  if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
-    if (indices.size() != 1) {
-      idx_pos =
-          rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
-    }
-  } else if (strategy_flags != ClusterHostType::kNearest) {
-    throw LogicError(
-        fmt::format("Invalid strategy requested: {}, ensure only one is used",
-                    ToString(strategy_flags)));
-  }
-  return indices[idx_pos];
+void AddLoadStatistics(InstanceStatisticsNonatomic& stats,
+                       const ConnectionPool& pool) {
+  stats.load_score = pool.GetLoadScore();
+  stats.statement_latency_us = pool.GetStatementLatencyUs();
 }
 
 }  // namespace
@@ -68,7 +51,8 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
                          const error_injection::Settings& ei_settings)
     : default_cmd_ctls_(default_cmd_ctls),
       bg_task_processor_(bg_task_processor),
-      rr_host_idx_(0) {
+      rr_host_idx_(0),
+      least_loaded_two_choices_(cluster_settings.least_loaded_two_choices) {
   if (dsns.empty()) {
     throw ClusterError("Cannot create a cluster from an empty DSN list");
   } else if (dsns.size() == 1) {
@@ -104,6 +88,61 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
 
 ClusterImpl::~ClusterImpl() = default;
 
+size_t ClusterImpl::SelectDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags) {
+  UASSERT(!indices.empty());
+  if (indices.empty()) {
+    throw ClusterError("Cannot select host from an empty list");
+  }
+
+  const auto strategy_flags = flags & kClusterHostStrategyMask;
+  LOG_TRACE() << "Applying " << strategy_flags << " strategy";
+
+  size_t idx_pos = 0;
+  if (!strategy_flags || strategy_flags == ClusterHostType::kRoundRobin) {
+    if (indices.size() != 1) {
+      idx_pos =
+          rr_host_idx_.fetch_add(1, std::memory_order_relaxed) % indices.size();
+    }
+  } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    idx_pos = SelectLeastLoaded(indices);
+  } else if (strategy_flags != ClusterHostType::kNearest) {
+    throw LogicError(
+        fmt::format("Invalid strategy requested: {}, ensure only one is used",
+                    ToString(strategy_flags)));
+  }
+  return indices[idx_pos];
+}
+
+size_t ClusterImpl::SelectLeastLoaded(
+    const topology::TopologyBase::DsnIndices& indices) const {
+  const auto score = [this, &indices](size_t idx_pos) {
+    UASSERT(indices[idx_pos] < host_pools_.size());
+    return host_pools_[indices[idx_pos]]->GetLoadScore();
+  };
+
+  if (least_loaded_two_choices_ && indices.size() > 2) {
+    // Power of two choices: nearly as good as the full scan while not
+    // stampeding all the requests to a single momentarily idle host
+    const auto first = USERVER_NAMESPACE::utils::RandRange(indices.size());
+    auto second = USERVER_NAMESPACE::utils::RandRange(indices.size() - 1);
+    if (second >= first) ++second;
+    return score(first) <= score(second) ? first : second;
+  }
+
+  size_t best_pos = 0;
+  auto best_score = score(0);
+  for (size_t i = 1; i < indices.size(); ++i) {
+    const auto current = score(i);
+    if (current < best_score) {
+      best_pos = i;
+      best_score = current;
+    }
+  }
+  return best_pos;
+}
+
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
   auto cluster_stats = std::make_unique<ClusterStatistics>();
 
@@ -128,6 +167,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->master.stats.Add(host_pools_[dsn_index]
                                         ->GetStatementTimingsStorage()
                                         .GetTimingsPercentiles());
+    AddLoadStatistics(cluster_stats->master.stats, *host_pools_[dsn_index]);
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -145,6 +185,8 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
                                             ->GetStatementTimingsStorage()
                                             .GetTimingsPercentiles());
+    AddLoadStatistics(cluster_stats->sync_slave.stats,
+                      *host_pools_[dsn_index]);
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -166,6 +208,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
       slave_desc.stats.Add(host_pools_[dsn_index]
                                ->GetStatementTimingsStorage()
                                .GetTimingsPercentiles());
+      AddLoadStatistics(slave_desc.stats, *host_pools_[dsn_index]);
       is_host_pool_seen[dsn_index] = 1;
     }
   }
@@ -180,6 +223,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     desc.stats.Add(host_pools_[i]->GetStatistics(), dsn_stats[i]);
     desc.stats.Add(
         host_pools_[i]->GetStatementTimingsStorage().GetTimingsPercentiles());
+    AddLoadStatistics(desc.stats, *host_pools_[i]);
 
     cluster_stats->unknown.push_back(std::move(desc));
   }
@@ -206,7 +250,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -228,7 +272,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -263,6 +307,12 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
   return FindPool(flags)->Start(cmd_ctl);
 }
 
+NotifyScope ClusterImpl::Listen(std::string_view channel,
+                                OptionalCommandControl cmd_ctl) {
+  // LISTEN is not allowed on hot standby hosts
+  return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
+}
+
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
                                            DefaultCommandControlSource source) {
   default_cmd_ctls_.UpdateDefaultCmdCtl(cmd_ctl, source);
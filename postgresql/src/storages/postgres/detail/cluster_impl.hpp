@@ -40,6 +40,8 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  NotifyScope Listen(std::string_view channel, OptionalCommandControl);
+
   void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
   CommandControl GetDefaultCommandControl() const;
 
@@ -63,12 +65,17 @@ class ClusterImpl {
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
+                        ClusterHostTypeFlags flags);
+  size_t SelectLeastLoaded(
+      const topology::TopologyBase::DsnIndices& indices) const;
 
   DefaultCommandControls default_cmd_ctls_;
   std::unique_ptr<topology::TopologyBase> topology_;
   engine::TaskProcessor& bg_task_processor_;
   std::vector<ConnectionPoolPtr> host_pools_;
   std::atomic<uint32_t> rr_host_idx_;
+  const bool least_loaded_two_choices_;
 };
 
 }  // namespace storages::postgres::detail
@@ -112,6 +112,12 @@ ResultSet Connection::Execute(CommandControl statement_cmd_ctl,
                  OptionalCommandControl{statement_cmd_ctl});
 }
 
+std::vector<QueryQueue::Result> Connection::ExecuteBatch(
+    const std::vector<QueuedQuery>& queries,
+    OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteBatch(queries, std::move(statement_cmd_ctl));
+}
+
 Connection::StatementId Connection::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const detail::QueryParameters& params,
@@ -128,6 +134,46 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+void Connection::CopyInStart(const Query& query,
+                             OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyInStart(query, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyInPutData(std::string_view data) {
+  pimpl_->CopyInPutData(data);
+}
+
+std::size_t Connection::CopyInEnd() { return pimpl_->CopyInEnd(); }
+
+void Connection::CopyInAbort(const char* error_message) {
+  pimpl_->CopyInAbort(error_message);
+}
+
+void Connection::CopyOutStart(const Query& query,
+                              OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyOutStart(query, std::move(statement_cmd_ctl));
+}
+
+bool Connection::CopyOutGetData(std::string& data) {
+  return pimpl_->CopyOutGetData(data);
+}
+
+void Connection::CopyOutAbort() { pimpl_->CopyOutAbort(); }
+
+void Connection::Listen(std::string_view channel,
+                        OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->Listen(channel, std::move(statement_cmd_ctl));
+}
+
+void Connection::Unlisten(std::string_view channel,
+                          OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->Unlisten(channel, std::move(statement_cmd_ctl));
+}
+
+Notification Connection::WaitNotify(engine::Deadline deadline) {
+  return pimpl_->WaitNotify(deadline);
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
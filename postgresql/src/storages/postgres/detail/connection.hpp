@@ -3,6 +3,8 @@
 #include <atomic>
 #include <chrono>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -15,8 +17,10 @@
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -218,6 +222,10 @@ class Connection {
   ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query,
                     const ParameterStore& store);
 
+  /// Execute the statements in a single round trip, @see QueryQueue
+  std::vector<QueryQueue::Result> ExecuteBatch(
+      const std::vector<QueuedQuery>& queries, OptionalCommandControl);
+
   StatementId PortalBind(const std::string& statement,
                          const std::string& portal_name,
                          const detail::QueryParameters& params,
@@ -225,6 +233,31 @@ class Connection {
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
 
+  /// @name COPY interface, @see storages::postgres::CopyIn and
+  /// storages::postgres::CopyOut
+  //@{
+  void CopyInStart(const Query& query, OptionalCommandControl);
+  void CopyInPutData(std::string_view data);
+  /// @returns number of rows copied
+  std::size_t CopyInEnd();
+  void CopyInAbort(const char* error_message);
+
+  void CopyOutStart(const Query& query, OptionalCommandControl);
+  /// @returns false if there is no more data
+  bool CopyOutGetData(std::string& data);
+  void CopyOutAbort();
+  //@}
+
+  /// @name Asynchronous notifications interface, @see
+  /// storages::postgres::NotifyScope
+  //@{
+  void Listen(std::string_view channel, OptionalCommandControl);
+  /// Discards all of the received notifications that were not waited for
+  void Unlisten(std::string_view channel, OptionalCommandControl);
+  /// @throws ConnectionTimeoutError if the deadline is reached
+  Notification WaitNotify(engine::Deadline deadline);
+  //@}
+
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
   /// If there is a transaction in progress - roll it back.
@@ -53,6 +53,19 @@ class CountExecute {
     completed_ = true;
   }
 
+  void AccountResults(const std::vector<QueryQueue::Result>& results) {
+    // The first statement is accounted by the constructor
+    stats_.execute_total += results.size() - 1;
+    for (const auto& result : results) {
+      if (result.HasError()) {
+        ++stats_.error_execute_total;
+      } else if (result.Get().FieldCount()) {
+        ++stats_.reply_total;
+      }
+    }
+    completed_ = true;
+  }
+
  private:
   Connection::Statistics& stats_;
   bool completed_{false};
@@ -344,6 +357,46 @@ ResultSet ConnectionImpl::ExecuteCommand(
   return ExecuteCommand(query, params, deadline);
 }
 
+std::vector<QueryQueue::Result> ConnectionImpl::ExecuteBatch(
+    const std::vector<QueuedQuery>& queries,
+    OptionalCommandControl statement_cmd_ctl) {
+  if (queries.empty()) return {};
+
+  CheckBusy();
+  const TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                              ? statement_cmd_ctl->execute
+                                              : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  tracing::Span span{scopes::kQueryQueue};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag("queries_count", queries.size());
+  auto scope = span.CreateScopeTime();
+  CountExecute count_execute(stats_);
+  try {
+    auto results = conn_wrapper_.ExecuteBatch(queries, deadline, scope);
+    for (auto& result : results) {
+      if (result.HasError()) continue;
+      // The copy shares the data with the result
+      auto res = result.Get();
+      if (!res.IsEmpty()) FillBufferCategories(res);
+    }
+    count_execute.AccountResults(results);
+    return results;
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Query queue of " << queries.size()
+                          << " statements network timeout error: " << e;
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+}
+
 void ConnectionImpl::Begin(const TransactionOptions& options,
                            SteadyClock::time_point trx_start_time,
                            OptionalCommandControl trx_cmd_ctl) {
@@ -477,6 +530,78 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+void ConnectionImpl::CopyInStart(const Query& query,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  StartCopy(PGRES_COPY_IN, query, std::move(statement_cmd_ctl));
+}
+
+void ConnectionImpl::CopyInPutData(std::string_view data) {
+  conn_wrapper_.PutCopyData(data, copy_deadline_);
+}
+
+std::size_t ConnectionImpl::CopyInEnd() {
+  conn_wrapper_.PutCopyEnd(nullptr, copy_deadline_);
+  return FinishCopy().RowsAffected();
+}
+
+void ConnectionImpl::CopyInAbort(const char* error_message) {
+  UASSERT(error_message);
+  conn_wrapper_.PutCopyEnd(error_message, copy_deadline_);
+  // The server replies with an error, the transaction is aborted
+  conn_wrapper_.DiscardInput(copy_deadline_);
+}
+
+void ConnectionImpl::CopyOutStart(const Query& query,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  StartCopy(PGRES_COPY_OUT, query, std::move(statement_cmd_ctl));
+}
+
+bool ConnectionImpl::CopyOutGetData(std::string& data) {
+  if (conn_wrapper_.GetCopyData(data, copy_deadline_)) return true;
+  FinishCopy();
+  return false;
+}
+
+void ConnectionImpl::CopyOutAbort() {
+  // There is no way to stop COPY OUT from the client side other than to
+  // cancel the statement and to skip the data that is already sent
+  Cancel();
+  std::string data;
+  while (conn_wrapper_.GetCopyData(data, copy_deadline_)) {
+  }
+  conn_wrapper_.DiscardInput(copy_deadline_);
+}
+
+void ConnectionImpl::Listen(std::string_view channel,
+                            OptionalCommandControl statement_cmd_ctl) {
+  const TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                              ? statement_cmd_ctl->execute
+                                              : CurrentExecuteTimeout();
+  ExecuteCommandNoPrepare("LISTEN " + conn_wrapper_.EscapeIdentifier(channel),
+                          testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout));
+}
+
+void ConnectionImpl::Unlisten(std::string_view channel,
+                              OptionalCommandControl statement_cmd_ctl) {
+  const TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                              ? statement_cmd_ctl->execute
+                                              : CurrentExecuteTimeout();
+  ExecuteCommandNoPrepare(
+      "UNLISTEN " + conn_wrapper_.EscapeIdentifier(channel),
+      testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout));
+  // The next user of the connection must not get stale notifications
+  conn_wrapper_.DiscardNotifications();
+}
+
+Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
+  // Notifications are delivered between transactions only
+  if (!IsIdle()) {
+    throw LogicError{
+        "Waiting for notifications is allowed on an idle connection only"};
+  }
+  return conn_wrapper_.WaitNotify(deadline);
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -765,6 +890,44 @@ ResultSet ConnectionImpl::ExecuteCommandNoPrepare(const Query& query,
                     scope, nullptr);
 }
 
+void ConnectionImpl::StartCopy(ExecStatusType direction, const Query& query,
+                               OptionalCommandControl statement_cmd_ctl) {
+  if (IsPipelineActive()) {
+    throw LogicError{"COPY is not supported in pipeline mode"};
+  }
+  CheckBusy();
+  const TimeoutDuration execute_timeout = !!statement_cmd_ctl
+                                              ? statement_cmd_ctl->execute
+                                              : CurrentExecuteTimeout();
+  copy_deadline_ = testsuite_pg_ctl_.MakeExecuteDeadline(execute_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(copy_deadline_);
+
+  auto span = MakeQuerySpan(query);
+  auto scope = span.CreateScopeTime();
+  copy_statement_ = query.Statement();
+  try {
+    conn_wrapper_.SendQuery(copy_statement_, scope);
+    conn_wrapper_.WaitCopyStart(direction, copy_deadline_, scope);
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+}
+
+ResultSet ConnectionImpl::FinishCopy() {
+  tracing::Span span{scopes::kCopyEnd};
+  conn_wrapper_.FillSpanTags(span);
+  span.AddTag(tracing::kDatabaseStatement, copy_statement_);
+  auto scope = span.CreateScopeTime();
+  const TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          copy_deadline_.TimeLeft());
+  CountExecute count_execute(stats_);
+  return WaitResult(copy_statement_, copy_deadline_, network_timeout,
+                    count_execute, span, scope, nullptr);
+}
+
 void ConnectionImpl::SendCommandNoPrepare(const Query& query,
                                           engine::Deadline deadline) {
   static const QueryParameters kNoParams;
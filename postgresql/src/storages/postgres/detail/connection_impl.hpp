@@ -63,6 +63,10 @@ class ConnectionImpl {
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
 
+  std::vector<QueryQueue::Result> ExecuteBatch(
+      const std::vector<QueuedQuery>& queries,
+      OptionalCommandControl statement_cmd_ctl);
+
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
              OptionalCommandControl trx_cmd_ctl = {});
@@ -81,6 +85,23 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  void CopyInStart(const Query& query,
+                   OptionalCommandControl statement_cmd_ctl);
+  void CopyInPutData(std::string_view data);
+  std::size_t CopyInEnd();
+  void CopyInAbort(const char* error_message);
+
+  void CopyOutStart(const Query& query,
+                    OptionalCommandControl statement_cmd_ctl);
+  bool CopyOutGetData(std::string& data);
+  void CopyOutAbort();
+
+  void Listen(std::string_view channel,
+              OptionalCommandControl statement_cmd_ctl);
+  void Unlisten(std::string_view channel,
+                OptionalCommandControl statement_cmd_ctl);
+  Notification WaitNotify(engine::Deadline deadline);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -142,6 +163,10 @@ class ConnectionImpl {
   ResultSet ExecuteCommandNoPrepare(const Query& query,
                                     engine::Deadline deadline);
 
+  void StartCopy(ExecStatusType direction, const Query& query,
+                 OptionalCommandControl statement_cmd_ctl);
+  ResultSet FinishCopy();
+
   ResultSet ExecuteCommandNoPrepare(const Query& query,
                                     const QueryParameters& params,
                                     engine::Deadline deadline);
@@ -181,6 +206,9 @@ class ConnectionImpl {
   testsuite::PostgresControl testsuite_pg_ctl_;
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
+  /// Deadline of the COPY in progress
+  engine::Deadline copy_deadline_;
+  std::string copy_statement_;
   const error_injection::Settings ei_settings_;
 };
 
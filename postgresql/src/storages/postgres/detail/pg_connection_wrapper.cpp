@@ -414,6 +414,10 @@ void PGConnectionWrapper::Flush(Deadline deadline) {
     is_syncing_pipeline_ = true;
   }
 #endif
+  FlushOutput(deadline);
+}
+
+void PGConnectionWrapper::FlushOutput(Deadline deadline) {
   while (const int flush_res = PQflush(conn_)) {
     if (flush_res < 0) {
       throw CommandError(PQerrorMessage(conn_));
@@ -486,6 +490,273 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+std::vector<QueryQueue::Result> PGConnectionWrapper::ExecuteBatch(
+    const std::vector<QueuedQuery>& queries, Deadline deadline,
+    tracing::ScopeTime& scope) {
+  std::vector<ResultHandle> handles;
+#if LIBPQ_HAS_PIPELINING
+  const bool was_in_pipeline = IsPipelineActive();
+  if (!was_in_pipeline) EnterPipelineMode();
+  try {
+    scope.Reset(scopes::kLibpqSendQueryParams);
+    // Separates the results of the commands sent earlier without waiting,
+    // e.g. BEGIN, from the results of the batch
+    CheckError<CommandError>("PQpipelineSync", PQpipelineSync(conn_));
+    for (const auto& [query, params] : queries) {
+      const QueryParameters query_params{params};
+      CheckError<CommandError>(
+          "PQsendQueryParams `" + query.Statement() + "`",
+          PQsendQueryParams(conn_, query.Statement().c_str(),
+                            query_params.Size(),
+                            query_params.ParamTypesBuffer(),
+                            query_params.ParamBuffers(),
+                            query_params.ParamLengthsBuffer(),
+                            query_params.ParamFormatsBuffer(),
+                            io::kPgBinaryDataFormat));
+      CheckError<CommandError>("PQpipelineSync", PQpipelineSync(conn_));
+    }
+    UpdateLastUse();
+
+    scope.Reset(scopes::kLibpqWaitResult);
+    is_syncing_pipeline_ = true;
+    FlushOutput(deadline);
+    handles = CollectPipelineResults(queries.size(), deadline);
+    is_syncing_pipeline_ = false;
+
+    if (!was_in_pipeline && !PQexitPipelineMode(conn_)) {
+      throw ConnectionError{std::string{"Failed to exit pipeline mode: "} +
+                            PQerrorMessage(conn_)};
+    }
+  } catch (const std::exception&) {
+    if (!was_in_pipeline) {
+      // The connection is left in pipeline mode with the results pending
+      MarkAsBroken();
+    }
+    throw;
+  }
+#else
+  handles.reserve(queries.size());
+  for (const auto& [query, params] : queries) {
+    SendQuery(query.Statement(), QueryParameters{params}, scope);
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+    auto handle = MakeResultHandle(nullptr);
+    ConsumeInput(deadline);
+    while (auto* pg_res = PQXgetResult(conn_)) {
+      handle = MakeResultHandle(pg_res);
+      ConsumeInput(deadline);
+    }
+    handles.push_back(std::move(handle));
+  }
+#endif
+
+  std::vector<QueryQueue::Result> results;
+  results.reserve(handles.size());
+  for (auto& handle : handles) {
+#if LIBPQ_HAS_PIPELINING
+    if (handle && PQresultStatus(handle.get()) == PGRES_PIPELINE_ABORTED) {
+      results.emplace_back(std::make_exception_ptr(
+          RuntimeError{"Statement was skipped due to an error in pipeline"}));
+      continue;
+    }
+#endif
+    try {
+      results.emplace_back(MakeResult(std::move(handle)));
+    } catch (const std::exception&) {
+      results.emplace_back(std::current_exception());
+    }
+  }
+  return results;
+}
+
+std::vector<PGConnectionWrapper::ResultHandle>
+PGConnectionWrapper::CollectPipelineResults(std::size_t queries_count,
+                                            Deadline deadline) {
+  std::vector<ResultHandle> handles;
+  handles.reserve(queries_count);
+  for (std::size_t i = 0; i < queries_count; ++i) {
+    handles.push_back(MakeResultHandle(nullptr));
+  }
+#if LIBPQ_HAS_PIPELINING
+  std::exception_ptr preceding_error;
+  // Sync point 0 finishes the commands sent before the batch, sync point i
+  // finishes the i-th query of the batch
+  std::size_t sync_points = 0;
+  while (sync_points <= queries_count) {
+    ConsumeInput(deadline);
+    auto* pg_res = PQXgetResult(conn_);
+    if (!pg_res) {
+      // End of results of a command
+      if (PQstatus(conn_) == CONNECTION_BAD) {
+        throw ConnectionError{"Connection failed while reading pipeline"};
+      }
+      continue;
+    }
+    auto handle = MakeResultHandle(pg_res);
+    switch (PQresultStatus(handle.get())) {
+      case PGRES_PIPELINE_SYNC:
+        ++sync_points;
+        continue;
+      case PGRES_PIPELINE_ABORTED:
+        // A command skipped due to an earlier error, reported by ExecuteBatch
+        if (sync_points == 0) continue;
+        break;
+      default:
+        break;
+    }
+    if (sync_points == 0) {
+      try {
+        MakeResult(std::move(handle));
+      } catch (const std::exception&) {
+        if (!preceding_error) preceding_error = std::current_exception();
+      }
+    } else {
+      handles[sync_points - 1] = std::move(handle);
+    }
+  }
+  if (preceding_error) std::rethrow_exception(preceding_error);
+#else
+  static_cast<void>(deadline);
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+  return handles;
+}
+
+void PGConnectionWrapper::WaitCopyStart(ExecStatusType expected,
+                                        Deadline deadline,
+                                        tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  ConsumeInput(deadline);
+  auto handle = MakeResultHandle(PQXgetResult(conn_));
+  const auto status = handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+  if (status == expected) return;
+
+  switch (status) {
+    case PGRES_COPY_IN:
+    case PGRES_COPY_OUT:
+    case PGRES_COPY_BOTH:
+      // There is no way to leave COPY BOTH mode, other modes are not worth
+      // recovering
+      PGCW_LOG_LIMITED_ERROR() << "Unexpected COPY direction";
+      CloseWithError(LogicError{"Unexpected COPY direction"});
+    default:
+      break;
+  }
+
+  // Not a COPY statement, get the rest of the results and report the error
+  // if any
+  ConsumeInput(deadline);
+  while (auto* pg_res = PQXgetResult(conn_)) {
+    MakeResultHandle(pg_res);
+    ConsumeInput(deadline);
+  }
+  MakeResult(std::move(handle));
+  throw LogicError{
+      "Statement is neither COPY FROM STDIN nor COPY TO STDOUT of the "
+      "expected direction"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  while (true) {
+    const int res = PQputCopyData(conn_, data.data(), data.size());
+    if (res > 0) break;
+    if (res < 0) {
+      throw CommandError(std::string{"PQputCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    // Output buffer is full, wait for it to be sent
+    Flush(deadline);
+  }
+  Flush(deadline);
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message,
+                                     Deadline deadline) {
+  while (true) {
+    const int res = PQputCopyEnd(conn_, error_message);
+    if (res > 0) break;
+    if (res < 0) {
+      throw CommandError(std::string{"PQputCopyEnd execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    Flush(deadline);
+  }
+  Flush(deadline);
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline) {
+  while (true) {
+    char* buffer = nullptr;
+    const int res = PQgetCopyData(conn_, &buffer, /*async=*/1);
+    if (res > 0) {
+      data.assign(buffer, res);
+      PQfreemem(buffer);
+      return true;
+    }
+    if (res == -1) return false;
+    if (res < -1) {
+      throw CommandError(std::string{"PQgetCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+
+    // No complete row available yet
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while receiving COPY data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while receiving COPY data from PostgreSQL connection";
+      throw ConnectionTimeoutError("Timed out while receiving COPY data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+}
+
+Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
+  while (true) {
+    if (auto* pg_notify = PQnotifies(conn_)) {
+      Notification notification{pg_notify->relname, std::nullopt,
+                                pg_notify->be_pid};
+      if (pg_notify->extra && *pg_notify->extra) {
+        notification.payload.emplace(pg_notify->extra);
+      }
+      PQfreemem(pg_notify);
+      return notification;
+    }
+
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted(
+            "Task cancelled while waiting for a notification");
+      }
+      // Not an error on the connection level, the connection is usable
+      throw ConnectionTimeoutError("Timed out while waiting for a notification");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+}
+
+void PGConnectionWrapper::DiscardNotifications() {
+  while (auto* pg_notify = PQnotifies(conn_)) {
+    PQfreemem(pg_notify);
+  }
+}
+
+std::string PGConnectionWrapper::EscapeIdentifier(std::string_view identifier) {
+  std::unique_ptr<char, decltype(&PQfreemem)> escaped{
+      PQescapeIdentifier(conn_, identifier.data(), identifier.size()),
+      &PQfreemem};
+  if (!escaped) {
+    throw LogicError{std::string{"Failed to escape identifier: "} +
+                     PQerrorMessage(conn_)};
+  }
+  return escaped.get();
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
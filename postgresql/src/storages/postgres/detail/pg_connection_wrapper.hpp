@@ -15,6 +15,8 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/result_wrapper.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/notify.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -103,6 +105,49 @@ class PGConnectionWrapper {
   /// Will return result or throw an exception
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
 
+  /// @brief Send the statements in a single pipeline and wait for all of the
+  /// results.
+  ///
+  /// Each statement is followed by a sync point, so that an error in one of
+  /// them doesn't skip the rest. Enters pipeline mode for the duration of the
+  /// call if the connection is not in it. Falls back to executing the
+  /// statements one by one if libpq doesn't support pipelining.
+  /// @returns a result or a statement error for each of the statements
+  std::vector<QueryQueue::Result> ExecuteBatch(
+      const std::vector<QueuedQuery>& queries, Deadline deadline,
+      tracing::ScopeTime&);
+
+  /// @brief Wait for the server to enter COPY IN or COPY OUT mode
+  /// @throws LogicError if the statement is not a COPY of the expected
+  /// direction, server errors as is
+  void WaitCopyStart(ExecStatusType expected, Deadline deadline,
+                     tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData, flushes the data to the socket
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, flushes the data to the socket.
+  /// The result of the COPY is to be fetched by WaitResult.
+  /// @param error_message if not null, the server fails the COPY with the
+  /// message
+  void PutCopyEnd(const char* error_message, Deadline deadline);
+
+  /// @brief Wrapper for PQgetCopyData
+  /// @returns false when all the data was received, the result of the COPY is
+  /// to be fetched by WaitResult
+  bool GetCopyData(std::string& data, Deadline deadline);
+
+  /// @brief Wrapper for PQnotifies, waits for the socket to become readable
+  /// until a notification arrives
+  /// @throws ConnectionTimeoutError if the deadline is reached
+  Notification WaitNotify(Deadline deadline);
+
+  /// Free the notifications buffered by libpq
+  void DiscardNotifications();
+
+  /// @brief Wrapper for PQescapeIdentifier
+  std::string EscapeIdentifier(std::string_view identifier);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline);
   /// Consume all input discarding all result sets
@@ -141,6 +186,13 @@ class PGConnectionWrapper {
 
   void Flush(Deadline deadline);
 
+  /// Send the output buffer without adding a pipeline sync point
+  void FlushOutput(Deadline deadline);
+
+  /// Read the results of the queries sent in a pipeline by ExecuteBatch
+  std::vector<ResultHandle> CollectPipelineResults(std::size_t queries_count,
+                                                   Deadline deadline);
+
   ResultSet MakeResult(ResultHandle&& handle);
 
   template <typename ExceptionType>
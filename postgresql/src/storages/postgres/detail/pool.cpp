@@ -36,6 +36,12 @@ constexpr auto kIdleDropLimit = 1;
 // Practically unlimited number on concurrect establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
+// Weight of a new sample in the statement latency moving average
+constexpr double kStatementLatencyWeight = 0.1;
+
+// The latency estimate of a pool that was not used for longer starts to decay
+constexpr std::chrono::seconds kStatementLatencyDecayPeriod{10};
+
 class Stopwatch {
  public:
   using Accumulator =
@@ -160,6 +166,7 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
 
 void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   auto now = SteadyClock::now();
+  AccountStatementLatency(conn_stats);
 
   stats_.connection.prepared_statements.GetCurrentCounter().Account(
       conn_stats.prepared_statements_current);
@@ -273,6 +280,44 @@ void ConnectionPool::Release(Connection* connection) {
   }
 }
 
+void ConnectionPool::AccountStatementLatency(
+    const Connection::Statistics& conn_stats) {
+  if (!conn_stats.execute_total) return;
+
+  const double sample =
+      std::chrono::duration<double, std::micro>(conn_stats.sum_query_duration)
+          .count() /
+      conn_stats.execute_total;
+  double current = statement_latency_us_.load(std::memory_order_relaxed);
+  double updated = 0;
+  do {
+    updated = current > 0
+                  ? current + kStatementLatencyWeight * (sample - current)
+                  : sample;
+  } while (!statement_latency_us_.compare_exchange_weak(
+      current, updated, std::memory_order_relaxed));
+  statement_latency_update_time_.store(
+      SteadyClock::now().time_since_epoch().count(),
+      std::memory_order_relaxed);
+}
+
+double ConnectionPool::GetStatementLatencyUs() const {
+  const auto latency = statement_latency_us_.load(std::memory_order_relaxed);
+  const SteadyClock::time_point update_time{SteadyClock::duration{
+      statement_latency_update_time_.load(std::memory_order_relaxed)}};
+  const auto idle = SteadyClock::now() - update_time;
+  if (idle <= kStatementLatencyDecayPeriod) return latency;
+  return latency *
+         (std::chrono::duration<double>{kStatementLatencyDecayPeriod} / idle);
+}
+
+double ConnectionPool::GetLoadScore() const {
+  const auto in_flight = stats_.connection.used.Load() +
+                         wait_count_.load(std::memory_order_relaxed);
+  // Ones keep the score meaningful for idle pools and unknown latency
+  return (in_flight + 1) * (GetStatementLatencyUs() + 1);
+}
+
 const InstanceStatistics& ConnectionPool::GetStatistics() const {
   auto settings = settings_.Read();
   stats_.connection.active = size_->load(std::memory_order_relaxed);
@@ -301,6 +346,15 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   return NonTransaction{std::move(conn), start_time};
 }
 
+NotifyScope ConnectionPool::Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl) {
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+  auto conn = Acquire(deadline);
+  UASSERT(conn);
+  return NotifyScope{std::move(conn), channel, cmd_ctl};
+}
+
 TimeoutDuration ConnectionPool::GetExecuteTimeout(
     OptionalCommandControl cmd_ctl) const {
   if (cmd_ctl) return cmd_ctl->execute;
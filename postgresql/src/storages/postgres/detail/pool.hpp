@@ -21,6 +21,7 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
@@ -67,6 +68,9 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  [[nodiscard]] NotifyScope Listen(std::string_view channel,
+                                   OptionalCommandControl cmd_ctl = {});
+
   CommandControl GetDefaultCommandControl() const;
 
   void SetSettings(const PoolSettings& settings);
@@ -79,6 +83,18 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
     return sts_;
   }
 
+  /// @brief Load score for ClusterHostType::kLeastLoaded, the lower the
+  /// better.
+  ///
+  /// Moving average of statement execution time multiplied by the number of
+  /// busy connections and waiting requests.
+  double GetLoadScore() const;
+
+  /// Moving average of statement execution time in microseconds, decays while
+  /// the pool is not used so that a host recovered from a slowdown gets
+  /// probed again.
+  double GetStatementLatencyUs() const;
+
  private:
   using SizeGuard = USERVER_NAMESPACE::utils::SizeGuard<std::atomic<size_t>>;
   using SharedCounter = std::shared_ptr<std::atomic<size_t>>;
@@ -103,6 +119,7 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void DropOutdatedConnection(Connection* connection);
 
   void AccountConnectionStats(Connection::Statistics stats);
+  void AccountStatementLatency(const Connection::Statistics& stats);
 
   Connection* AcquireImmediate();
   void MaintainConnections();
@@ -132,6 +149,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  std::atomic<double> statement_latency_us_{0};
+  std::atomic<SteadyClock::rep> statement_latency_update_time_{0};
 };
 
 }  // namespace storages::postgres::detail
@@ -20,6 +20,10 @@ const std::string kPrepare = "pg_prepare";
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Execute a batch of queries, top driver level
+const std::string kQueryQueue = "pg_query_queue";
+/// Finish COPY, driver level
+const std::string kCopyEnd = "pg_copy_end";
 
 // libpq stages
 /// libpq async connect stage
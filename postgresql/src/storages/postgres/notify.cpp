@@ -0,0 +1,57 @@
+#include <userver/storages/postgres/notify.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+NotifyScope::NotifyScope(detail::ConnectionPtr conn, std::string_view channel,
+                         OptionalCommandControl cmd_ctl)
+    : conn_{std::move(conn)}, channel_{channel}, cmd_ctl_{std::move(cmd_ctl)} {
+  UASSERT(conn_);
+  conn_->Listen(channel_, cmd_ctl_);
+}
+
+NotifyScope::NotifyScope(NotifyScope&&) noexcept = default;
+
+NotifyScope& NotifyScope::operator=(NotifyScope&& other) noexcept {
+  if (this != &other) {
+    Unlisten();
+    conn_ = std::move(other.conn_);
+    channel_ = std::move(other.channel_);
+    cmd_ctl_ = std::move(other.cmd_ctl_);
+  }
+  return *this;
+}
+
+NotifyScope::~NotifyScope() { Unlisten(); }
+
+Notification NotifyScope::WaitNotify(engine::Deadline deadline) {
+  if (!conn_) {
+    throw LogicError{"Notify scope is not valid"};
+  }
+  return conn_->WaitNotify(deadline);
+}
+
+void NotifyScope::Unlisten() {
+  if (!conn_) return;
+  try {
+    conn_->Unlisten(channel_, cmd_ctl_);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to UNLISTEN channel '" << channel_
+                          << "': " << e;
+    // The connection must not return to the pool still listening
+    conn_->MarkAsBroken();
+  }
+  conn_ = detail::ConnectionPtr{nullptr};
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#include <userver/storages/postgres/query_queue.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+QueryQueue::QueryQueue(detail::Connection* conn, OptionalCommandControl cmd_ctl)
+    : conn_{conn}, cmd_ctl_{std::move(cmd_ctl)} {
+  UASSERT(conn_);
+}
+
+QueryQueue::QueryQueue(QueryQueue&&) noexcept = default;
+QueryQueue& QueryQueue::operator=(QueryQueue&&) noexcept = default;
+QueryQueue::~QueryQueue() = default;
+
+std::vector<QueryQueue::Result> QueryQueue::Collect() {
+  if (!conn_) {
+    throw LogicError{"Query queue is not valid"};
+  }
+  auto queries = std::move(queries_);
+  queries_.clear();
+  return conn_->ExecuteBatch(queries, cmd_ctl_);
+}
+
+const UserTypes& QueryQueue::GetConnectionUserTypes() const {
+  if (!conn_) {
+    throw LogicError{"Query queue is not valid"};
+  }
+  return conn_->GetUserTypes();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
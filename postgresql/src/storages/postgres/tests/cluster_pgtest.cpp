@@ -133,6 +133,10 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
       cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RW));
+  CheckRwTransaction(
+      cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RW));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -146,6 +150,12 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
            pg::ClusterHostType::kRoundRobin, pg::ClusterHostType::kNearest},
           pg::Transaction::RW),
       pg::LogicError);
+  UEXPECT_THROW(
+      cluster.Begin(
+          {pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+           pg::ClusterHostType::kNearest, pg::ClusterHostType::kLeastLoaded},
+          pg::Transaction::RW),
+      pg::LogicError);
 }
 
 UTEST_F(PostgreCluster, ClusterSlaveRO) {
@@ -160,6 +170,9 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
   CheckRoTransaction(cluster.Begin(
       {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest},
       pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
 
   UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
                                pg::ClusterHostType::kRoundRobin,
@@ -332,4 +345,25 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStore) {
   }
 }
 
+UTEST_F(PostgreCluster, ListenNotify) {
+  auto cluster = CreateCluster(GetDsnFromEnv(), GetTaskProcessor(), 2);
+
+  {
+    auto scope = cluster.Listen("test_channel");
+    cluster.Execute(pg::ClusterHostType::kMaster,
+                    "select pg_notify('test_channel', $1)",
+                    std::string{"payload"});
+    auto notification = scope.WaitNotify(MakeDeadline());
+    EXPECT_EQ("test_channel", notification.channel);
+    EXPECT_EQ("payload", notification.payload);
+  }
+
+  // The connection is back to the pool and does not listen anymore
+  cluster.Execute(pg::ClusterHostType::kMaster, "notify test_channel");
+  auto scope = cluster.Listen("other_channel");
+  UEXPECT_THROW(scope.WaitNotify(engine::Deadline::FromDuration(
+                    std::chrono::milliseconds{100})),
+                pg::ConnectionTimeoutError);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+const std::string kCreateTable =
+    "create temporary table copytest(id integer, name text, v bigint)";
+const std::string kCopyIn =
+    "copy copytest(id, name, v) from stdin (format binary)";
+const std::string kCopyOut =
+    "copy (select id, name, v from copytest order by id) to stdout "
+    "(format binary)";
+
+struct CopyRow {
+  int id;
+  std::string name;
+  std::optional<pg::Bigint> v;
+};
+
+constexpr int kRowsCount = 10000;
+
+UTEST_P(PostgreConnection, CopyInOut) {
+  CheckConnection(conn);
+
+  pg::Transaction trx{std::move(conn), pg::TransactionOptions{}};
+  trx.Execute(kCreateTable);
+
+  {
+    auto copy = trx.MakeCopyIn(kCopyIn);
+    for (int i = 0; i < kRowsCount; ++i) {
+      std::optional<pg::Bigint> v;
+      if (i % 2) v = i * 10;
+      copy.WriteRow(i, "name " + std::to_string(i), v);
+    }
+    EXPECT_EQ(std::size_t{kRowsCount}, copy.RowsWritten());
+    EXPECT_EQ(std::size_t{kRowsCount}, copy.Finish());
+    EXPECT_ANY_THROW(copy.Finish());
+  }
+
+  auto cnt = trx.Execute("select count(*) from copytest where v is null");
+  EXPECT_EQ(kRowsCount / 2, cnt.Front().As<pg::Bigint>());
+
+  auto copy = trx.MakeCopyOut(kCopyOut);
+  CopyRow row;
+  int expected_id = 0;
+  while (copy.ReadRow(pg::kRowTag, row)) {
+    EXPECT_EQ(expected_id, row.id);
+    EXPECT_EQ("name " + std::to_string(expected_id), row.name);
+    EXPECT_EQ(expected_id % 2 == 1, row.v.has_value());
+    ++expected_id;
+  }
+  EXPECT_TRUE(copy.Done());
+  EXPECT_EQ(std::size_t{kRowsCount}, copy.RowsRead());
+  EXPECT_FALSE(copy.ReadRow(pg::kRowTag, row));
+
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyOutFieldsMismatch) {
+  CheckConnection(conn);
+
+  pg::Transaction trx{std::move(conn), pg::TransactionOptions{}};
+  trx.Execute(kCreateTable);
+  trx.Execute("insert into copytest values (1, 'one', 1)");
+
+  auto copy = trx.MakeCopyOut(kCopyOut);
+  int id{};
+  std::string name;
+  UEXPECT_THROW(copy.ReadRow(id, name), pg::FieldTupleMismatch);
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+  CheckConnection(conn);
+
+  UEXPECT_NO_THROW(conn->Begin({}, pg::detail::SteadyClock::now()));
+  conn->Execute(kCreateTable);
+  {
+    pg::CopyIn copy{conn.get(), kCopyIn};
+    copy.WriteRow(1, std::string{"one"}, pg::Bigint{1});
+  }
+  EXPECT_EQ(pg::ConnectionState::kTranError, conn->GetState());
+  UEXPECT_NO_THROW(conn->Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyNotCopyStatement) {
+  CheckConnection(conn);
+
+  UEXPECT_NO_THROW(conn->Begin({}, pg::detail::SteadyClock::now()));
+  UEXPECT_THROW(pg::CopyIn(conn.get(), "select 1"), pg::LogicError);
+  UEXPECT_NO_THROW(conn->Commit());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
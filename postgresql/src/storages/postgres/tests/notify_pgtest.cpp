@@ -0,0 +1,59 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/notify.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+UTEST_P(PostgreConnection, ListenNotify) {
+  CheckConnection(conn);
+
+  UEXPECT_NO_THROW(conn->Listen("test channel", {}));
+  conn->Execute("select pg_notify('test channel', 'payload')");
+  conn->Execute("notify \"test channel\"");
+
+  auto notification = conn->WaitNotify(MakeDeadline());
+  EXPECT_EQ("test channel", notification.channel);
+  EXPECT_EQ("payload", notification.payload);
+  EXPECT_NE(0, notification.backend_pid);
+
+  notification = conn->WaitNotify(MakeDeadline());
+  EXPECT_EQ("test channel", notification.channel);
+  EXPECT_FALSE(notification.payload);
+
+  UEXPECT_THROW(conn->WaitNotify(engine::Deadline::Passed()),
+                pg::ConnectionTimeoutError);
+  EXPECT_EQ(pg::ConnectionState::kIdle, conn->GetState());
+}
+
+UTEST_P(PostgreConnection, UnlistenDiscardsNotifications) {
+  CheckConnection(conn);
+
+  UEXPECT_NO_THROW(conn->Listen("test_channel", {}));
+  conn->Execute("notify test_channel");
+  UEXPECT_NO_THROW(conn->Unlisten("test_channel", {}));
+  conn->Execute("notify test_channel");
+
+  UEXPECT_THROW(conn->WaitNotify(engine::Deadline::Passed()),
+                pg::ConnectionTimeoutError);
+}
+
+UTEST_P(PostgreConnection, NotifyInTransaction) {
+  CheckConnection(conn);
+
+  UEXPECT_NO_THROW(conn->Listen("test_channel", {}));
+  UEXPECT_NO_THROW(conn->Begin({}, pg::detail::SteadyClock::now()));
+  conn->Execute("notify test_channel");
+  UEXPECT_THROW(conn->WaitNotify(MakeDeadline()), pg::LogicError);
+  UEXPECT_NO_THROW(conn->Commit());
+
+  EXPECT_EQ("test_channel", conn->WaitNotify(MakeDeadline()).channel);
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <userver/storages/postgres/query_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+UTEST_P(PostgreConnection, QueryQueue) {
+  CheckConnection(conn);
+
+  pg::Transaction trx{std::move(conn), pg::TransactionOptions{}};
+  auto queue = trx.MakeQueryQueue();
+  EXPECT_TRUE(queue.IsEmpty());
+  for (int i = 0; i < 10; ++i) {
+    queue.Push("select $1 + 1", i);
+  }
+  queue.Push("select $1::text", std::string{"text"});
+  EXPECT_EQ(11, queue.Size());
+
+  auto results = trx.ExecuteBatch(queue);
+  EXPECT_TRUE(queue.IsEmpty());
+  ASSERT_EQ(11, results.size());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_FALSE(results[i].HasError());
+    EXPECT_EQ(i + 1, results[i].Get().AsSingleRow<int>());
+  }
+  EXPECT_EQ("text", results[10].Get().AsSingleRow<std::string>());
+
+  EXPECT_TRUE(queue.Collect().empty());
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, QueryQueueErrors) {
+  CheckConnection(conn);
+
+  pg::QueryQueue queue{conn.get()};
+  queue.Push("select 1");
+  queue.Push("select 1 / $1", 0);
+  queue.Push("select 3");
+
+  auto results = queue.Collect();
+  ASSERT_EQ(3, results.size());
+  EXPECT_EQ(1, results[0].Get().AsSingleRow<int>());
+  EXPECT_TRUE(results[1].HasError());
+  UEXPECT_THROW(results[1].Get(), pg::DataException);
+  // Out of transaction block an error doesn't affect the next statements
+  EXPECT_EQ(3, results[2].Get().AsSingleRow<int>());
+
+  EXPECT_EQ(pg::ConnectionState::kIdle, conn->GetState());
+  EXPECT_EQ(1, conn->Execute("select 1").AsSingleRow<int>());
+}
+
+UTEST_P(PostgreConnection, QueryQueueErrorInTransaction) {
+  CheckConnection(conn);
+
+  pg::Transaction trx{std::move(conn), pg::TransactionOptions{}};
+  auto queue = trx.MakeQueryQueue();
+  queue.Push("select 1 / $1", 0);
+  queue.Push("select 2");
+
+  auto results = queue.Collect();
+  ASSERT_EQ(2, results.size());
+  UEXPECT_THROW(results[0].Get(), pg::DataException);
+  UEXPECT_THROW(results[1].Get(), pg::InvalidTransactionState);
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -126,6 +126,45 @@ void Transaction::Rollback() {
   }
 }
 
+QueryQueue Transaction::MakeQueryQueue(
+    OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Make query queue called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return QueryQueue{conn_.get(), std::move(statement_cmd_ctl)};
+}
+
+std::vector<QueryQueue::Result> Transaction::ExecuteBatch(QueryQueue& queue) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Execute batch called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return queue.Collect();
+}
+
+CopyIn Transaction::MakeCopyIn(const Query& query,
+                               OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Make copy in called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return CopyIn{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyOut Transaction::MakeCopyOut(const Query& query,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Make copy out called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  return CopyOut{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
 const UserTypes& Transaction::GetConnectionUserTypes() const {
   if (!conn_) {
     LOG_LIMITED_ERROR() << "Get user types called after transaction finished"
@@ -51,6 +51,7 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache_size | max count of keys in the local cache of GET and HGET replies, kept coherent with CLIENT TRACKING; 0 disables the cache | 0
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -73,6 +74,21 @@ namespace components {
 ///            redis_thread_pool_size: 8
 ///            sentinel_thread_pool_size: 1
 /// ```
+///
+/// ## Client-side cache
+///
+/// With a non-zero `client_side_cache_size` the connections of the group
+/// switch to RESP3 to receive the invalidation messages. Replies are
+/// converted to their RESP2 form:
+/// - maps and sets come as flat arrays, doubles and big numbers as strings;
+/// - booleans come as nil for false and as integer 1 for true, so Lua scripts
+///   returning `false` still give nil;
+/// - [member, score] pairs of WITHSCORES replies are flattened by the
+///   parsers of the typed client methods.
+///
+/// The remaining difference is visible in the generic replies only: pairs
+/// returned by other commands (e.g. `ZRANDMEMBER ... WITHSCORES` in a raw
+/// command or in a script result) stay nested.
 
 // clang-format on
 class Redis : public LoggableComponentBase {
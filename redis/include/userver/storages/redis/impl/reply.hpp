@@ -126,6 +126,7 @@ class ReplyData final {
   static ReplyData CreateError(std::string&& error_msg);
   static ReplyData CreateStatus(std::string&& status_msg);
   static ReplyData CreateNil();
+  static ReplyData CreateInteger(int64_t value);
 
   explicit operator bool() const { return type_ != Type::kNoReply; }
 
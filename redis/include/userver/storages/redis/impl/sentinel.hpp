@@ -34,6 +34,7 @@ const int kDefaultRedisThreadPoolSize = 8;
 const auto kSentinelGetHostsCheckInterval = std::chrono::seconds(3);
 
 // Forward declarations
+class ClientSideCache;
 class SentinelImpl;
 class Shard;
 
@@ -50,7 +51,8 @@ class Sentinel {
            std::unique_ptr<KeyShard>&& key_shard = nullptr,
            CommandControl command_control = kDefaultCommandControl,
            const testsuite::RedisControl& testsuite_redis_control = {},
-           ConnectionMode mode = ConnectionMode::kCommands);
+           ConnectionMode mode = ConnectionMode::kCommands,
+           std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
   virtual ~Sentinel();
 
   void Start();
@@ -76,14 +78,16 @@ class Sentinel {
       const secdist::RedisSettings& settings, std::string shard_group_name,
       const std::string& client_name, KeyShardFactory key_shard_factory,
       const CommandControl& command_control = kDefaultCommandControl,
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
   static std::shared_ptr<redis::Sentinel> CreateSentinel(
       const std::shared_ptr<ThreadPools>& thread_pools,
       const secdist::RedisSettings& settings, std::string shard_group_name,
       const std::string& client_name, ReadyChangeCallback ready_callback,
       KeyShardFactory key_shard_factory,
       const CommandControl& command_control = kDefaultCommandControl,
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
 
   void Restart();
 
@@ -114,6 +118,9 @@ class Sentinel {
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
 
+  // Returns nullptr if the client side cache is disabled
+  const std::shared_ptr<ClientSideCache>& GetClientSideCache() const;
+
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(size_t shard)> signal_instances_changed;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -203,6 +210,7 @@ class Sentinel {
   utils::SwappingSmart<CommandControl> config_default_command_control_;
   std::atomic_int publish_shard_{0};
   testsuite::RedisControl testsuite_redis_control_;
+  std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace redis
@@ -1,5 +1,6 @@
 #include "client_impl.hpp"
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <userver/storages/redis/impl/sentinel.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -206,6 +207,10 @@ RequestGeoradius ClientImpl::Georadius(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (redis_client_->GetClientSideCache()) {
+    return MakeCachedRequest<RequestGet>(CmdArgs{"get", key}, std::move(key),
+                                         "get", shard, command_control);
+  }
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -248,6 +253,12 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (redis_client_->GetClientSideCache()) {
+    auto subkey = "hget:" + field;
+    return MakeCachedRequest<RequestHget>(
+        CmdArgs{"hget", key, std::move(field)}, std::move(key),
+        std::move(subkey), shard, command_control);
+  }
   return CreateRequest<RequestHget>(
       MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
                   false, GetCommandControl(command_control)));
@@ -1002,6 +1013,26 @@ USERVER_NAMESPACE::redis::Request ClientImpl::MakeRequest(
                                     command_control, replies_to_skip);
 }
 
+template <typename Request>
+Request ClientImpl::MakeCachedRequest(CmdArgs&& args, std::string key,
+                                      std::string subkey, size_t shard,
+                                      const CommandControl& command_control) {
+  const auto& cache = redis_client_->GetClientSideCache();
+  UASSERT(cache);
+  if (auto data = cache->Get(key, subkey)) {
+    return CreateDummyRequest<Request>(
+        std::make_shared<Reply>(args.args.front().front(), std::move(*data)));
+  }
+
+  // Taken before sending the request, so that the invalidations received
+  // while the request is in flight discard its reply
+  const auto fill_token = cache->GetFillToken();
+  return CreateCachingRequest<Request>(
+      MakeRequest(std::move(args), shard, false,
+                  GetCommandControl(command_control)),
+      cache, fill_token, std::move(key), std::move(subkey));
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
   return redis_client_->GetCommandControl(cc);
 }
@@ -429,6 +429,12 @@ class ClientImpl final : public Client,
     return requests;
   }
 
+  // Serves the read request from the client side cache if possible
+  template <typename Request>
+  Request MakeCachedRequest(CmdArgs&& args, std::string key,
+                            std::string subkey, size_t shard,
+                            const CommandControl& command_control);
+
   CommandControl GetCommandControl(const CommandControl& cc) const;
 
   size_t GetPublishShard(PubShard policy);
@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <vector>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 #include <userver/components/component.hpp>
@@ -153,6 +154,19 @@ formats::json::ValueBuilder RedisStatisticsToJson(
   result["errors"]["redis_not_ready"] = stats.internal.redis_not_ready.load();
   utils::statistics::SolomonChildrenAreLabelValues(result["errors"],
                                                    "redis_error");
+
+  if (const auto& cache = redis->GetClientSideCache()) {
+    const auto cache_stats = cache->GetStatistics();
+    auto cache_json = result["client-side-cache"];
+    cache_json["keys"] = cache_stats.keys;
+    cache_json["hits"] = cache_stats.hits;
+    cache_json["misses"] = cache_stats.misses;
+    const auto requests = cache_stats.hits + cache_stats.misses;
+    cache_json["hit-ratio-percent"] =
+        requests ? cache_stats.hits * 100.0 / requests : 0.0;
+    cache_json["invalidations"] = cache_stats.invalidations;
+    cache_json["flushes"] = cache_stats.flushes;
+  }
   return result;
 }
 
@@ -232,6 +246,7 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  size_t client_side_cache_size{0};
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -242,6 +257,8 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.client_side_cache_size =
+      value["client_side_cache_size"].As<size_t>(0);
   return config;
 }
 
@@ -349,10 +366,16 @@ void Redis::Connect(const ComponentConfig& config,
     command_control.allow_reads_from_master =
         redis_group.allow_reads_from_master;
 
+    std::shared_ptr<redis::ClientSideCache> client_side_cache;
+    if (redis_group.client_side_cache_size) {
+      client_side_cache = std::make_shared<redis::ClientSideCache>(
+          redis_group.client_side_cache_size);
+    }
+
     auto sentinel = redis::Sentinel::CreateSentinel(
         thread_pools_, settings, redis_group.config_name, redis_group.db,
         redis::KeyShardFactory{redis_group.sharding_strategy}, command_control,
-        testsuite_redis_control);
+        testsuite_redis_control, std::move(client_side_cache));
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
       const auto& client =
@@ -507,6 +530,14 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache_size:
+                    type: integer
+                    description: |
+                        max count of keys in the local cache of GET and HGET
+                        replies, kept coherent with CLIENT TRACKING; 0 disables
+                        the cache
+                    defaultDescription: 0
+                    minimum: 0
     subscribe_groups:
         type: array
         description: array of redis clusters to work with in subscribe mode
@@ -0,0 +1,84 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+ClientSideCache::ClientSideCache(size_t max_keys) : replies_(max_keys) {
+  UASSERT(max_keys > 0);
+}
+
+std::optional<ReplyData> ClientSideCache::Get(const std::string& key,
+                                              const std::string& subkey) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto* replies = replies_.Get(key);
+  if (replies) {
+    auto it = replies->find(subkey);
+    if (it != replies->end()) {
+      ++stats_.hits;
+      return it->second;
+    }
+  }
+  ++stats_.misses;
+  return std::nullopt;
+}
+
+ClientSideCache::FillToken ClientSideCache::GetFillToken() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return invalidations_seq_;
+}
+
+void ClientSideCache::Put(const std::string& key, const std::string& subkey,
+                          ReplyData data, ServerId server_id,
+                          FillToken token) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // The reply may predate an invalidation that has already been processed
+  if (token != invalidations_seq_) return;
+  if (!tracking_servers_.count(server_id)) return;
+
+  auto* replies = replies_.Emplace(key);
+  replies->insert_or_assign(subkey, std::move(data));
+}
+
+void ClientSideCache::Invalidate(const std::vector<std::string>& keys) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++invalidations_seq_;
+  for (const auto& key : keys) replies_.Erase(key);
+  stats_.invalidations += keys.size();
+}
+
+void ClientSideCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ClearLocked();
+}
+
+void ClientSideCache::AddTrackingServer(ServerId server_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  tracking_servers_.insert(server_id);
+}
+
+void ClientSideCache::RemoveTrackingServer(ServerId server_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (tracking_servers_.erase(server_id)) ClearLocked();
+}
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto stats = stats_;
+  stats.keys = replies_.GetSize();
+  return stats;
+}
+
+void ClientSideCache::ClearLocked() {
+  ++invalidations_seq_;
+  replies_.Clear();
+  ++stats_.flushes;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/storages/redis/impl/base.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+struct ClientSideCacheStatistics {
+  size_t keys{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t invalidations{0};
+  size_t flushes{0};
+};
+
+// Size-bounded local cache of read command replies.
+//
+// Replies are stored only if they came from a connection with enabled
+// CLIENT TRACKING, so Redis notifies about every change of the cached keys.
+// The whole cache is flushed when such a connection is lost, as
+// the invalidation messages could have been lost with it.
+class ClientSideCache final {
+ public:
+  // Sequence number of invalidations, replies of the requests started
+  // before an invalidation are not stored
+  using FillToken = uint64_t;
+
+  explicit ClientSideCache(size_t max_keys);
+
+  // `subkey` tells apart the replies of different commands for the same key,
+  // e.g. the fields of HGET
+  std::optional<ReplyData> Get(const std::string& key,
+                               const std::string& subkey);
+
+  FillToken GetFillToken() const;
+
+  void Put(const std::string& key, const std::string& subkey, ReplyData data,
+           ServerId server_id, FillToken token);
+
+  void Invalidate(const std::vector<std::string>& keys);
+
+  void Clear();
+
+  // Called by the connections once the tracking is enabled and
+  // once the connection is lost
+  void AddTrackingServer(ServerId server_id);
+  void RemoveTrackingServer(ServerId server_id);
+
+  ClientSideCacheStatistics GetStatistics() const;
+
+ private:
+  using Replies = std::unordered_map<std::string, ReplyData>;
+
+  void ClearLocked();
+
+  mutable std::mutex mutex_;
+  cache::LruMap<std::string, Replies> replies_;
+  std::unordered_set<ServerId, ServerIdHasher> tracking_servers_;
+  FillToken invalidations_seq_{0};
+  ClientSideCacheStatistics stats_;
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,215 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <future>
+#include <thread>
+
+#include <userver/storages/redis/impl/thread_pools.hpp>
+#include <userver/storages/redis/parse_reply.hpp>
+
+#include "mock_server_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kSmallPeriod{500};
+constexpr std::chrono::milliseconds kWaitPeriod{10};
+constexpr auto kWaitRetries = 100;
+
+const std::string kLocalhost = "127.0.0.1";
+
+template <typename Predicate>
+void PeriodicWait(Predicate predicate) {
+  for (int i = 0; i < kWaitRetries; i++) {
+    if (predicate()) break;
+    std::this_thread::sleep_for(kWaitPeriod);
+  }
+  EXPECT_TRUE(predicate());
+}
+
+bool IsCached(redis::ClientSideCache& cache, const std::string& key) {
+  return cache.Get(key, "get").has_value();
+}
+
+}  // namespace
+
+TEST(ClientSideCache, PutRequiresTracking) {
+  redis::ClientSideCache cache(10);
+  const auto server_id = redis::ServerId::Generate();
+
+  cache.Put("key", "get", redis::ReplyData("value"), server_id,
+            cache.GetFillToken());
+  EXPECT_FALSE(IsCached(cache, "key"));
+
+  cache.AddTrackingServer(server_id);
+  cache.Put("key", "get", redis::ReplyData("value"), server_id,
+            cache.GetFillToken());
+  const auto data = cache.Get("key", "get");
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data->GetString(), "value");
+  EXPECT_FALSE(cache.Get("key", "hget:field"));
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(stats.keys, 1);
+  EXPECT_EQ(stats.hits, 1);
+  EXPECT_EQ(stats.misses, 2);
+}
+
+TEST(ClientSideCache, Invalidate) {
+  redis::ClientSideCache cache(10);
+  const auto server_id = redis::ServerId::Generate();
+  cache.AddTrackingServer(server_id);
+
+  for (const std::string key : {"a", "b", "c"}) {
+    cache.Put(key, "get", redis::ReplyData(key), server_id,
+              cache.GetFillToken());
+  }
+  cache.Invalidate({"a", "c"});
+
+  EXPECT_FALSE(IsCached(cache, "a"));
+  EXPECT_TRUE(IsCached(cache, "b"));
+  EXPECT_FALSE(IsCached(cache, "c"));
+  EXPECT_EQ(cache.GetStatistics().invalidations, 2);
+}
+
+TEST(ClientSideCache, InvalidationDuringRequest) {
+  redis::ClientSideCache cache(10);
+  const auto server_id = redis::ServerId::Generate();
+  cache.AddTrackingServer(server_id);
+
+  const auto token = cache.GetFillToken();
+  cache.Invalidate({"key"});
+  cache.Put("key", "get", redis::ReplyData("stale"), server_id, token);
+  EXPECT_FALSE(IsCached(cache, "key"));
+}
+
+TEST(ClientSideCache, FlushOnTrackingLoss) {
+  redis::ClientSideCache cache(10);
+  const auto server_id = redis::ServerId::Generate();
+  cache.AddTrackingServer(server_id);
+  cache.Put("key", "get", redis::ReplyData("value"), server_id,
+            cache.GetFillToken());
+
+  cache.RemoveTrackingServer(server_id);
+  EXPECT_FALSE(IsCached(cache, "key"));
+  EXPECT_EQ(cache.GetStatistics().flushes, 1);
+
+  cache.Put("key", "get", redis::ReplyData("value"), server_id,
+            cache.GetFillToken());
+  EXPECT_FALSE(IsCached(cache, "key"));
+}
+
+TEST(ClientSideCache, SizeLimit) {
+  redis::ClientSideCache cache(2);
+  const auto server_id = redis::ServerId::Generate();
+  cache.AddTrackingServer(server_id);
+
+  for (const std::string key : {"a", "b", "c"}) {
+    cache.Put(key, "get", redis::ReplyData(key), server_id,
+              cache.GetFillToken());
+  }
+
+  EXPECT_EQ(cache.GetStatistics().keys, 2);
+  EXPECT_FALSE(IsCached(cache, "a"));
+  EXPECT_TRUE(IsCached(cache, "b"));
+  EXPECT_TRUE(IsCached(cache, "c"));
+}
+
+TEST(ClientSideCache, TrackingInvalidations) {
+#if HIREDIS_MAJOR > 1 || (HIREDIS_MAJOR == 1 && HIREDIS_MINOR >= 1)
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto hello_handler = server.RegisterHandlerWithConstReply(
+      "HELLO", {"3"},
+      redis::ReplyData::Array{{"server"}, {"redis"}, {"proto"}, {"3"}});
+  auto tracking_handler =
+      server.RegisterStatusReplyHandler("CLIENT", {"TRACKING", "ON"}, "OK");
+
+  auto cache = std::make_shared<redis::ClientSideCache>(10);
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              false, cache);
+  redis->Connect(kLocalhost, server.GetPort(), redis::Password(""));
+
+  EXPECT_TRUE(hello_handler->WaitForFirstReply(kSmallPeriod));
+  EXPECT_TRUE(tracking_handler->WaitForFirstReply(kSmallPeriod));
+  PeriodicWait(
+      [&] { return redis->GetState() == redis::RedisState::kConnected; });
+
+  const auto server_id = redis->GetServerId();
+  for (const std::string key : {"a", "b"}) {
+    cache->Put(key, "get", redis::ReplyData(key), server_id,
+               cache->GetFillToken());
+    EXPECT_TRUE(IsCached(*cache, key));
+  }
+
+  server.SendPush({{"invalidate"}, redis::ReplyData::Array{{"a"}}});
+  PeriodicWait([&] { return !IsCached(*cache, "a"); });
+  EXPECT_TRUE(IsCached(*cache, "b"));
+
+  server.SendPush({{"invalidate"}, redis::ReplyData::CreateNil()});
+  PeriodicWait([&] { return !IsCached(*cache, "b"); });
+
+  // The cache is flushed once the connection is lost
+  cache->Put("c", "get", redis::ReplyData("c"), server_id,
+             cache->GetFillToken());
+  EXPECT_TRUE(IsCached(*cache, "c"));
+  redis.reset();
+  EXPECT_FALSE(IsCached(*cache, "c"));
+#else
+  GTEST_SKIP() << "hiredis does not support RESP3 push messages";
+#endif
+}
+
+TEST(ClientSideCache, WithScoresWithTracking) {
+#if HIREDIS_MAJOR > 1 || (HIREDIS_MAJOR == 1 && HIREDIS_MINOR >= 1)
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto hello_handler = server.RegisterHandlerWithConstReply(
+      "HELLO", {"3"},
+      redis::ReplyData::Array{{"server"}, {"redis"}, {"proto"}, {"3"}});
+  auto tracking_handler =
+      server.RegisterStatusReplyHandler("CLIENT", {"TRACKING", "ON"}, "OK");
+  // RESP3 servers reply with [member, score] pairs
+  auto zrange_handler = server.RegisterHandlerWithConstReply(
+      "ZRANGE", {"key", "0", "-1", "WITHSCORES"},
+      redis::ReplyData::Array{
+          redis::ReplyData::Array{{"a"}, {"1"}},
+          redis::ReplyData::Array{{"b"}, {"2.5"}},
+      });
+
+  auto cache = std::make_shared<redis::ClientSideCache>(10);
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              false, cache);
+  redis->Connect(kLocalhost, server.GetPort(), redis::Password(""));
+
+  EXPECT_TRUE(tracking_handler->WaitForFirstReply(kSmallPeriod));
+  PeriodicWait(
+      [&] { return redis->GetState() == redis::RedisState::kConnected; });
+
+  std::promise<redis::ReplyPtr> reply_promise;
+  auto reply_future = reply_promise.get_future();
+  redis->AsyncCommand(redis::PrepareCommand(
+      {"ZRANGE", "key", "0", "-1", "WITHSCORES"},
+      [&reply_promise](const redis::CommandPtr&, redis::ReplyPtr reply) {
+        reply_promise.set_value(std::move(reply));
+      }));
+  ASSERT_EQ(reply_future.wait_for(kSmallPeriod), std::future_status::ready);
+
+  auto reply = reply_future.get();
+  ASSERT_TRUE(reply->IsOk());
+  const auto result = storages::redis::ParseReplyDataArray(
+      std::move(reply->data), "zrange",
+      storages::redis::To<std::vector<storages::redis::MemberScore>>{});
+  ASSERT_EQ(result.size(), 2u);
+  EXPECT_EQ(result[0].member, "a");
+  EXPECT_EQ(result[0].score, 1);
+  EXPECT_EQ(result[1].member, "b");
+  EXPECT_EQ(result[1].score, 2.5);
+#else
+  GTEST_SKIP() << "hiredis does not support RESP3 push messages";
+#endif
+}
+
+USERVER_NAMESPACE_END
@@ -57,6 +57,12 @@ void MockRedisServerBase::SendReplyData(const redis::ReplyData& reply_data) {
   SendReply(ReplyDataToRedisProto(reply_data));
 }
 
+void MockRedisServerBase::SendPush(const redis::ReplyData::Array& push_data) {
+  std::string push = '>' + std::to_string(push_data.size()) + kCrlf;
+  for (const auto& elem : push_data) push += ReplyDataToRedisProto(elem);
+  io_service_.post([this, push = std::move(push)] { SendReply(push); });
+}
+
 int MockRedisServerBase::GetPort() const {
   return acceptor_.local_endpoint().port();
 }
@@ -30,6 +30,8 @@ class MockRedisServerBase {
   void SendReplyOk(const std::string& reply);
   void SendReplyError(const std::string& reply);
   void SendReplyData(const redis::ReplyData& reply_data);
+  // Sends a RESP3 push message from the server thread
+  void SendPush(const redis::ReplyData::Array& push_data);
   int GetPort() const;
 
  protected:
@@ -7,6 +7,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <hiredis/adapters/libev.h>
@@ -18,11 +19,18 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
+#include <storages/redis/impl/reply_builder.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/redis_stats.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
+// RESP3 push messages have a separate callback since hiredis 1.1
+#if HIREDIS_MAJOR > 1 || (HIREDIS_MAJOR == 1 && HIREDIS_MINOR >= 1)
+#define USERVER_REDIS_HIREDIS_HAS_PUSH_CALLBACK
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
@@ -95,7 +103,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   RedisImpl(const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
             const engine::ev::ThreadControl& thread_control, Redis& redis_obj,
-            bool send_readonly = false);
+            bool send_readonly,
+            std::shared_ptr<ClientSideCache> client_side_cache);
   ~RedisImpl();
 
   void Connect(const std::string& host, int port, const Password& password);
@@ -130,6 +139,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                                  int revents) noexcept;
   static void OnRedisReply(redisAsyncContext* c, void* r,
                            void* privdata) noexcept;
+  static void OnPush(redisAsyncContext* c, void* r) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
@@ -147,7 +157,11 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void OnNewCommandImpl();
   void CommandLoopImpl();
-  void OnRedisReplyImpl(redisReply* redis_reply, void* privdata);
+  void OnRedisReplyImpl(void* hiredis_reply, void* privdata);
+  void OnPushImpl(ReplyData data);
+  ReplyPtr MakeReply(const std::string& cmd, void* hiredis_reply) const;
+  bool NeedsHiredisReplies(const CommandPtr& command) const;
+  bool UseHiredisReplies();
   void AccountPingLatency(std::chrono::milliseconds latency);
   void AccountRtt();
   void OnTimerPingImpl();
@@ -162,6 +176,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void Authenticate();
   void SendReadOnly();
+  void SendClientTracking();
   void FreeCommands();
 
   void RunEvLoop();
@@ -209,6 +224,9 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
   std::unordered_map<const ev_timer*, size_t> reply_privdata_rev_;
   bool subscriber_ = false;
+  redisReplyObjectFunctions* hiredis_reply_functions_ = nullptr;
+  // the commands loop waits for the reader to finish a reply
+  bool is_waiting_for_idle_reader_ = false;
   bool is_ping_in_flight_ = false;
   size_t missed_ping_streak_{0};
   size_t missed_ping_streak_threshold_{kMissedPingStreakThresholdDefault};
@@ -222,6 +240,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
   logging::LogExtra log_extra_;
   const bool send_readonly_ = false;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
+  bool is_tracking_ = false;
   bool watch_command_timer_started_ = false;
   Statistics statistics_;
   ServerId server_id_;
@@ -256,11 +276,13 @@ const std::string& Redis::StateToString(State state) {
 }
 
 Redis::Redis(const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
-             bool send_readonly)
+             bool send_readonly,
+             std::shared_ptr<ClientSideCache> client_side_cache)
     : thread_control_(thread_pool->NextThread()) {
   thread_control_.RunInEvLoopBlocking([&]() {
     impl_ = std::make_shared<RedisImpl>(thread_pool, thread_control_, *this,
-                                        send_readonly);
+                                        send_readonly,
+                                        std::move(client_side_cache));
   });
 }
 
@@ -307,11 +329,12 @@ void Redis::SetCommandsBufferingSettings(
 Redis::RedisImpl::RedisImpl(
     const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
     const engine::ev::ThreadControl& thread_control, Redis& redis_obj,
-    bool send_readonly)
+    bool send_readonly, std::shared_ptr<ClientSideCache> client_side_cache)
     : redis_obj_(&redis_obj),
       ev_thread_control_(thread_control),
       thread_pool_(thread_pool),
       send_readonly_(send_readonly),
+      client_side_cache_(std::move(client_side_cache)),
       server_id_(ServerId::Generate()) {
   SetCommandsBufferingSettings(CommandsBufferingSettings{});
   LOG_DEBUG() << "RedisImpl() server_id=" << GetServerId().GetId();
@@ -374,6 +397,10 @@ void Redis::RedisImpl::Connect(const std::string& host, int port,
   UASSERT(context_ != nullptr);
 
   context_->data = this;
+  // Replies are parsed straight into ReplyData until the connection becomes
+  // a subscriber, see UseHiredisReplies()
+  hiredis_reply_functions_ = context_->c.reader->fn;
+  context_->c.reader->fn = GetReplyDataBuilder();
 
   if (context_->err) {
     LOG_ERROR() << "error after redisAsyncConnect (host=" << host
@@ -691,6 +718,12 @@ void Redis::RedisImpl::SetState(State state) {
   state_ = state;
   statistics_.AccountStateChanged(state);
 
+  if (is_tracking_ && state != State::kConnected) {
+    // Invalidation messages may be lost with the connection
+    is_tracking_ = false;
+    client_side_cache_->RemoveTrackingServer(server_id_);
+  }
+
   auto self = shared_from_this();  // prevents deleting this in Disconnect()
   if (state == State::kConnected) {
     ev_thread_control_.RunInEvLoopBlocking([this] {
@@ -780,8 +813,18 @@ void Redis::RedisImpl::CommandLoopImpl() {
     std::swap(commands_, commands);
   }
   LOG_TRACE() << "commands size=" << commands.size();
-  for (auto& command : commands) {
-    ProcessCommand(command);
+  for (auto it = commands.begin(); it != commands.end(); ++it) {
+    if (NeedsHiredisReplies(*it) && !UseHiredisReplies()) {
+      // The reader is in the middle of a reply built by the ReplyData
+      // builder. The rest of the commands are sent after the reply is read,
+      // see OnRedisReplyImpl()
+      is_waiting_for_idle_reader_ = true;
+      std::lock_guard<std::mutex> lock(command_mutex_);
+      commands_size_ += static_cast<size_t>(commands.end() - it);
+      commands_.insert(commands_.begin(), it, commands.end());
+      return;
+    }
+    ProcessCommand(*it);
   }
 }
 
@@ -852,7 +895,7 @@ void Redis::RedisImpl::Authenticate() {
     if (send_readonly_)
       SendReadOnly();
     else
-      SetState(State::kConnected);
+      SendClientTracking();
   } else {
     ProcessCommand(PrepareCommand(
         CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -861,7 +904,7 @@ void Redis::RedisImpl::Authenticate() {
             if (send_readonly_)
               SendReadOnly();
             else
-              SetState(State::kConnected);
+              SendClientTracking();
           } else {
             if (*reply) {
               if (reply->IsUnknownCommandError()) {
@@ -893,7 +936,7 @@ void Redis::RedisImpl::SendReadOnly() {
   ProcessCommand(PrepareCommand(
       CmdArgs{"READONLY"}, [this](const CommandPtr&, ReplyPtr reply) {
         if (*reply && reply->data.IsStatus()) {
-          SetState(State::kConnected);
+          SendClientTracking();
         } else {
           if (*reply) {
             LOG_LIMITED_ERROR()
@@ -909,19 +952,139 @@ void Redis::RedisImpl::SendReadOnly() {
       }));
 }
 
+void Redis::RedisImpl::SendClientTracking() {
+  if (!client_side_cache_) {
+    SetState(State::kConnected);
+    return;
+  }
+
+#ifdef USERVER_REDIS_HIREDIS_HAS_PUSH_CALLBACK
+  // Invalidation messages are sent to the same connection with RESP3.
+  // Replies of RESP3 types are built as their RESP2 counterparts, booleans
+  // included, see reply_builder.cpp, and the [member, score] pairs of
+  // WITHSCORES replies are flattened by the parsers, see parse_reply.cpp.
+  // The remaining differences are documented in components::Redis
+  redisAsyncSetPushCallback(context_, OnPush);
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"HELLO", 3}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (!*reply || !reply->data.IsArray()) {
+          LOG_LIMITED_WARNING()
+              << log_extra_
+              << "RESP3 is not supported by the server, client side cache is "
+                 "not used for its replies. HELLO reply: "
+              << (*reply ? reply->data.ToDebugString()
+                         : reply->StatusString());
+          SetState(State::kConnected);
+          return;
+        }
+
+        ProcessCommand(PrepareCommand(
+            CmdArgs{"CLIENT", "TRACKING", "ON"},
+            [this](const CommandPtr&, ReplyPtr reply) {
+              if (*reply && reply->data.IsStatus()) {
+                is_tracking_ = true;
+                client_side_cache_->AddTrackingServer(server_id_);
+              } else {
+                LOG_LIMITED_WARNING()
+                    << log_extra_
+                    << "CLIENT TRACKING failed, client side cache is not used "
+                       "for the server replies: "
+                    << (*reply ? reply->data.ToDebugString()
+                               : reply->StatusString());
+              }
+              SetState(State::kConnected);
+            }));
+      }));
+#else
+  LOG_LIMITED_WARNING() << log_extra_
+                        << "hiredis does not support RESP3 push messages, "
+                           "client side cache is not used";
+  SetState(State::kConnected);
+#endif
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
                                     void* privdata) noexcept {
   auto* impl = static_cast<Redis::RedisImpl*>(c->data);
   UASSERT(impl != nullptr);
   try {
-    impl->OnRedisReplyImpl(static_cast<redisReply*>(r), privdata);
+    impl->OnRedisReplyImpl(r, privdata);
   } catch (const std::exception& ex) {
     LOG_ERROR() << "OnRedisReplyImpl() failed: " << ex;
   }
 }
 
-void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply,
-                                        void* privdata) {
+void Redis::RedisImpl::OnPush(redisAsyncContext* c, void* r) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  try {
+    impl->OnPushImpl(ExtractReplyData(r));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "OnPushImpl() failed: " << ex;
+  }
+}
+
+void Redis::RedisImpl::OnPushImpl(ReplyData data) {
+  if (!client_side_cache_ || !data.IsArray()) return;
+
+  // ["invalidate", [key...]], or ["invalidate", nil] if the server has
+  // flushed its tracking table
+  auto& push = data.GetArray();
+  if (push.size() != 2 || !push[0].IsString() ||
+      !AreStringsEqualIgnoreCase(push[0].GetString(), "invalidate")) {
+    return;
+  }
+
+  if (!push[1].IsArray()) {
+    client_side_cache_->Clear();
+    return;
+  }
+
+  std::vector<std::string> keys;
+  keys.reserve(push[1].GetArray().size());
+  for (auto& key : push[1].GetArray()) {
+    if (key.IsString()) keys.push_back(std::move(key.GetString()));
+  }
+  client_side_cache_->Invalidate(keys);
+}
+
+ReplyPtr Redis::RedisImpl::MakeReply(const std::string& cmd,
+                                     void* hiredis_reply) const {
+  if (!hiredis_reply) {
+    return std::make_shared<Reply>(cmd, nullptr, REDIS_ERR_NOT_READY);
+  }
+  if (subscriber_) {
+    return std::make_shared<Reply>(
+        cmd, static_cast<redisReply*>(hiredis_reply), REDIS_OK);
+  }
+  return std::make_shared<Reply>(cmd, ExtractReplyData(hiredis_reply));
+}
+
+bool Redis::RedisImpl::NeedsHiredisReplies(const CommandPtr& command) const {
+  if (subscriber_ || !context_) return false;
+  const auto& args = command->args.args;
+  return std::any_of(args.begin(), args.end(), [](const auto& cmd_args) {
+    return !cmd_args.empty() && IsSubscribesCommand(cmd_args);
+  });
+}
+
+bool Redis::RedisImpl::UseHiredisReplies() {
+  // hiredis looks into the elements of subscription replies, so they have to
+  // be built by hiredis itself. The functions may be switched only between
+  // the replies: a partially read reply is freed by the functions it was
+  // built with. Replies are read and freed outside of the commands loop.
+  if (context_->c.reader->fn == hiredis_reply_functions_) return true;
+  if (context_->c.reader->ridx != -1) return false;
+  context_->c.reader->fn = hiredis_reply_functions_;
+  return true;
+}
+
+void Redis::RedisImpl::OnRedisReplyImpl(void* hiredis_reply, void* privdata) {
+  // the reply is complete, the commands loop runs after it is freed
+  if (std::exchange(is_waiting_for_idle_reader_, false)) {
+    ev_thread_control_.Send(watch_command_);
+  }
+
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
   if (data != reply_privdata_.end()) {
     std::unique_ptr<SingleCommand> command_ptr;
@@ -929,9 +1092,7 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply,
 
     ev_thread_control_.Stop(data->second->timer);
     pcommand = data->second.get();
-    auto reply =
-        std::make_shared<Reply>(pcommand->cmd, redis_reply,
-                                redis_reply ? REDIS_OK : REDIS_ERR_NOT_READY);
+    auto reply = MakeReply(pcommand->cmd, hiredis_reply);
 
     // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
     // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -942,7 +1103,7 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply,
     // until the response to UNSUBSCRIBE request is received.
     // shard_subscriber::Fsm checks it.
     // TODO: add check in RedisImpl.
-    if (!subscriber_ || !redis_reply || IsUnsubscribeReply(reply)) {
+    if (!subscriber_ || !hiredis_reply || IsUnsubscribeReply(reply)) {
       command_ptr = std::move(data->second);
       if (!subscriber_) --sent_count_;
 
@@ -993,6 +1154,12 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
     }
 
     const bool is_special = IsSubscribesCommand(args);
+    if (is_special && !subscriber_ && !UseHiredisReplies()) {
+      LOG_LIMITED_ERROR() << log_extra_ << "can not subscribe while a reply "
+                          << "is being read: " << args[0];
+      InvokeCommandError(command, args[0], REDIS_ERR_OTHER);
+      continue;
+    }
     if (is_special) subscriber_ = true;
     if (subscriber_ && !is_special) {
       LOG_ERROR() << log_extra_ << "impossible for subscriber: " << args[0];
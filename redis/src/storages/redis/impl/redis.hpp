@@ -19,6 +19,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
 class Statistics;
 
 class Redis {
@@ -27,7 +28,8 @@ class Redis {
   static const std::string& StateToString(State state);
 
   Redis(const std::shared_ptr<engine::ev::ThreadPool>& thread_pool,
-        bool send_readonly = false);
+        bool send_readonly = false,
+        std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
   ~Redis();
 
   Redis(Redis&& o) = delete;
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/reply_builder.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// HGETALL-like reply of `elements` bulk strings
+std::string MakeArrayReply(std::size_t elements) {
+  std::string result = "*" + std::to_string(elements) + "\r\n";
+  for (std::size_t i = 0; i < elements; ++i) {
+    const auto value = "value-of-the-field-" + std::to_string(i);
+    result += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+  }
+  return result;
+}
+
+template <typename Extract>
+void ParseReply(benchmark::State& state, redisReader* reader,
+                Extract&& extract) {
+  const auto reply = MakeArrayReply(state.range(0));
+
+  for (auto _ : state) {
+    redisReaderFeed(reader, reply.data(), reply.size());
+    void* hiredis_reply = nullptr;
+    [[maybe_unused]] const auto status =
+        redisReaderGetReply(reader, &hiredis_reply);
+    UASSERT(status == REDIS_OK && hiredis_reply);
+
+    redis::ReplyData data = extract(hiredis_reply);
+    benchmark::DoNotOptimize(data);
+    reader->fn->freeObject(hiredis_reply);
+  }
+
+  state.SetBytesProcessed(state.iterations() * reply.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  redisReaderFree(reader);
+}
+
+void redis_reply_parse_hiredis(benchmark::State& state) {
+  ParseReply(state, redisReaderCreate(), [](void* reply) {
+    return redis::ReplyData(static_cast<redisReply*>(reply));
+  });
+}
+
+void redis_reply_parse_builder(benchmark::State& state) {
+  ParseReply(state,
+             redisReaderCreateWithFunctions(redis::GetReplyDataBuilder()),
+             [](void* reply) { return redis::ExtractReplyData(reply); });
+}
+
+}  // namespace
+
+BENCHMARK(redis_reply_parse_hiredis)->RangeMultiplier(8)->Range(16, 16384);
+BENCHMARK(redis_reply_parse_builder)->RangeMultiplier(8)->Range(16, 16384);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,131 @@
+#include <storages/redis/impl/reply_builder.hpp>
+
+#include <memory>
+#include <string>
+
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+#if HIREDIS_MAJOR >= 1
+using ArraySize = size_t;
+#else
+using ArraySize = int;
+#endif
+
+struct BuiltReply final {
+  // Must be the first member, hiredis casts the root of a reply to redisReply*
+  redisReply header{};
+  ReplyData data{ReplyData::CreateNil()};
+};
+
+// Only the root of a reply is allocated, nested replies are stored right in
+// the array of their parent and are referenced by the ReplyData pointers
+ReplyData& GetData(const redisReadTask* task) {
+  if (task->parent) return *static_cast<ReplyData*>(task->obj);
+  return static_cast<BuiltReply*>(task->obj)->data;
+}
+
+template <typename Factory>
+void* Store(const redisReadTask* task, Factory&& factory) noexcept {
+  try {
+    if (task->parent) {
+      auto& slot = GetData(task->parent).GetArray()[task->idx];
+      slot = factory();
+      return &slot;
+    }
+
+    auto reply = std::make_unique<BuiltReply>();
+    reply->header.type = task->type;
+    reply->data = factory();
+    if (reply->data.IsError()) {
+      // Hiredis logs unexpected error replies
+      auto& error = reply->data.GetError();
+      reply->header.str = error.data();
+      reply->header.len = error.size();
+    }
+    return reply.release();
+  } catch (const std::exception&) {
+    // hiredis reports an out of memory error for nullptr
+    return nullptr;
+  }
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) {
+  switch (task->type) {
+    case REDIS_REPLY_STATUS:
+      return Store(task, [&] {
+        return ReplyData::CreateStatus(std::string(str, len));
+      });
+    case REDIS_REPLY_ERROR:
+      return Store(task, [&] {
+        return ReplyData::CreateError(std::string(str, len));
+      });
+#if HIREDIS_MAJOR >= 1
+    case REDIS_REPLY_VERB:
+      // Skip the format prefix, e.g. "txt:"
+      if (len >= 4) {
+        str += 4;
+        len -= 4;
+      }
+      [[fallthrough]];
+#endif
+    default:
+      return Store(task, [&] { return ReplyData(std::string(str, len)); });
+  }
+}
+
+void* CreateArray(const redisReadTask* task, ArraySize elements) {
+  return Store(task, [&] {
+    return ReplyData(ReplyData::Array(elements, ReplyData::CreateNil()));
+  });
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) {
+  return Store(task, [&] { return ReplyData::CreateInteger(value); });
+}
+
+void* CreateNil(const redisReadTask* task) {
+  return Store(task, [] { return ReplyData::CreateNil(); });
+}
+
+#if HIREDIS_MAJOR >= 1
+void* CreateDouble(const redisReadTask* task, double, char* str, size_t len) {
+  return Store(task, [&] { return ReplyData(std::string(str, len)); });
+}
+
+// RESP2 has no booleans: Lua false is sent as nil and true as integer 1
+void* CreateBool(const redisReadTask* task, int value) {
+  if (!value) return CreateNil(task);
+  return Store(task, [] { return ReplyData::CreateInteger(1); });
+}
+#endif
+
+void FreeObject(void* reply) { delete static_cast<BuiltReply*>(reply); }
+
+#if HIREDIS_MAJOR >= 1
+redisReplyObjectFunctions kReplyDataBuilder{
+    CreateString, CreateArray, CreateInteger, CreateDouble,
+    CreateNil,    CreateBool,  FreeObject,
+};
+#else
+redisReplyObjectFunctions kReplyDataBuilder{
+    CreateString, CreateArray, CreateInteger, CreateNil, FreeObject,
+};
+#endif
+
+}  // namespace
+
+redisReplyObjectFunctions* GetReplyDataBuilder() { return &kReplyDataBuilder; }
+
+ReplyData ExtractReplyData(void* reply) {
+  return std::move(static_cast<BuiltReply*>(reply)->data);
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+struct redisReplyObjectFunctions;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// hiredis reader callbacks that build ReplyData right from the connection
+/// input buffer, without an intermediate redisReply tree to copy from.
+///
+/// The root of a built reply is still a valid redisReply without elements,
+/// as hiredis async code peeks at the type of replies. Subscriptions are not
+/// supported: hiredis inspects the elements of subscription replies.
+redisReplyObjectFunctions* GetReplyDataBuilder();
+
+/// Moves the data out of a reply built by GetReplyDataBuilder() callbacks.
+/// The reply itself must be freed by the reader.
+ReplyData ExtractReplyData(void* reply);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
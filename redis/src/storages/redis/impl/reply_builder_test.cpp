@@ -0,0 +1,87 @@
+#include <storages/redis/impl/reply_builder.hpp>
+
+#include <string_view>
+
+#include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+using namespace USERVER_NAMESPACE::redis;
+
+namespace {
+
+class Reader final {
+ public:
+  explicit Reader(redisReader* reader) : reader_(reader) {}
+
+  ~Reader() { redisReaderFree(reader_); }
+
+  ReplyData Parse(std::string_view data, bool use_builder) {
+    EXPECT_EQ(redisReaderFeed(reader_, data.data(), data.size()), REDIS_OK);
+    void* reply = nullptr;
+    EXPECT_EQ(redisReaderGetReply(reader_, &reply), REDIS_OK);
+    EXPECT_NE(reply, nullptr);
+
+    auto result = use_builder
+                      ? ExtractReplyData(reply)
+                      : ReplyData(static_cast<const redisReply*>(reply));
+    reader_->fn->freeObject(reply);
+    return result;
+  }
+
+ private:
+  redisReader* reader_;
+};
+
+ReplyData ParseWithHiredis(std::string_view data) {
+  Reader reader{redisReaderCreate()};
+  return reader.Parse(data, false);
+}
+
+ReplyData ParseWithBuilder(std::string_view data) {
+  Reader reader{redisReaderCreateWithFunctions(GetReplyDataBuilder())};
+  return reader.Parse(data, true);
+}
+
+}  // namespace
+
+TEST(ReplyBuilder, Scalars) {
+  EXPECT_EQ(ParseWithBuilder("$5\r\nhello\r\n").GetString(), "hello");
+  EXPECT_EQ(ParseWithBuilder("+OK\r\n").GetStatus(), "OK");
+  EXPECT_EQ(ParseWithBuilder("-ERR oops\r\n").GetError(), "ERR oops");
+  EXPECT_EQ(ParseWithBuilder(":-42\r\n").GetInt(), -42);
+  EXPECT_TRUE(ParseWithBuilder("$-1\r\n").IsNil());
+}
+
+TEST(ReplyBuilder, NestedArrays) {
+  constexpr std::string_view kReply =
+      "*4\r\n$1\r\na\r\n*2\r\n:1\r\n*1\r\n$-1\r\n*0\r\n+QUEUED\r\n";
+
+  const auto built = ParseWithBuilder(kReply);
+  EXPECT_EQ(built.ToDebugString(), ParseWithHiredis(kReply).ToDebugString());
+
+  ASSERT_TRUE(built.IsArray());
+  const auto& array = built.GetArray();
+  ASSERT_EQ(array.size(), 4);
+  EXPECT_EQ(array[0].GetString(), "a");
+  EXPECT_EQ(array[1].GetArray()[0].GetInt(), 1);
+  EXPECT_TRUE(array[1].GetArray()[1].GetArray()[0].IsNil());
+  EXPECT_TRUE(array[2].GetArray().empty());
+  EXPECT_EQ(array[3].GetStatus(), "QUEUED");
+}
+
+#if HIREDIS_MAJOR >= 1
+TEST(ReplyBuilder, Resp3BooleansAsResp2) {
+  // Lua false is nil and true is 1 in RESP2
+  EXPECT_TRUE(ParseWithBuilder("#f\r\n").IsNil());
+  EXPECT_EQ(ParseWithBuilder("#t\r\n").GetInt(), 1);
+
+  const auto built = ParseWithBuilder("*2\r\n#t\r\n#f\r\n");
+  ASSERT_TRUE(built.IsArray());
+  const auto& array = built.GetArray();
+  ASSERT_EQ(array.size(), 2);
+  EXPECT_EQ(array[0].GetInt(), 1);
+  EXPECT_TRUE(array[1].IsNil());
+}
+#endif
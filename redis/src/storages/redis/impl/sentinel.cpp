@@ -12,6 +12,7 @@
 
 #include <userver/storages/redis/impl/exception.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
+#include "client_side_cache.hpp"
 #include "redis.hpp"
 #include "sentinel_impl.hpp"
 #include "subscribe_sentinel.hpp"
@@ -39,10 +40,12 @@ Sentinel::Sentinel(const std::shared_ptr<ThreadPools>& thread_pools,
                    std::unique_ptr<KeyShard>&& key_shard,
                    CommandControl command_control,
                    const testsuite::RedisControl& testsuite_redis_control,
-                   ConnectionMode mode)
+                   ConnectionMode mode,
+                   std::shared_ptr<ClientSideCache> client_side_cache)
     : thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
-      testsuite_redis_control_(testsuite_redis_control) {
+      testsuite_redis_control_(testsuite_redis_control),
+      client_side_cache_(std::move(client_side_cache)) {
   config_default_command_control_.Set(
       std::make_shared<CommandControl>(secdist_default_command_control_));
 
@@ -56,8 +59,15 @@ Sentinel::Sentinel(const std::shared_ptr<ThreadPools>& thread_pools,
     impl_ = std::make_unique<SentinelImpl>(
         *sentinel_thread_control_, thread_pools_->GetRedisThreadPool(), *this,
         shards, conns, std::move(shard_group_name), client_name, password,
-        std::move(ready_callback), std::move(key_shard), mode);
+        std::move(ready_callback), std::move(key_shard), mode,
+        client_side_cache_);
   });
+
+  if (client_side_cache_) {
+    // Replies cached before a failover may come from a former master
+    signal_instances_changed.connect(
+        [cache = client_side_cache_](size_t) { cache->Clear(); });
+  }
 }
 
 Sentinel::~Sentinel() {
@@ -84,7 +94,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const secdist::RedisSettings& settings, std::string shard_group_name,
     const std::string& client_name, KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<ClientSideCache> client_side_cache) {
   auto ready_callback = [](size_t shard, const std::string& shard_name,
                            bool ready) {
     LOG_INFO() << "redis: ready_callback:"
@@ -94,7 +105,7 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
   return CreateSentinel(thread_pools, settings, std::move(shard_group_name),
                         client_name, std::move(ready_callback),
                         std::move(key_shard_factory), command_control,
-                        testsuite_redis_control);
+                        testsuite_redis_control, std::move(client_side_cache));
 }
 
 std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
@@ -103,7 +114,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory, const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<ClientSideCache> client_side_cache) {
   const auto& password = settings.password;
 
   const std::vector<std::string>& shards = settings.shards;
@@ -136,7 +148,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     client = std::make_shared<redis::Sentinel>(
         thread_pools, shards, conns, std::move(shard_group_name), client_name,
         password, std::move(ready_callback), std::move(key_shard),
-        command_control, testsuite_redis_control);
+        command_control, testsuite_redis_control, ConnectionMode::kCommands,
+        std::move(client_side_cache));
     client->Start();
   }
 
@@ -262,6 +275,10 @@ void Sentinel::SetCommandsBufferingSettings(
   return impl_->SetCommandsBufferingSettings(commands_buffering_settings);
 }
 
+const std::shared_ptr<ClientSideCache>& Sentinel::GetClientSideCache() const {
+  return client_side_cache_;
+}
+
 std::vector<Request> Sentinel::MakeRequests(
     CmdArgs&& args, bool master, const CommandControl& command_control,
     size_t replies_to_skip) {
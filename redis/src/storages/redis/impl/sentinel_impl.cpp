@@ -56,7 +56,7 @@ SentinelImpl::SentinelImpl(
     const std::vector<ConnectionInfo>& conns, std::string shard_group_name,
     const std::string& client_name, const Password& password,
     ReadyChangeCallback ready_callback, std::unique_ptr<KeyShard>&& key_shard,
-    ConnectionMode mode)
+    ConnectionMode mode, std::shared_ptr<ClientSideCache> client_side_cache)
     : sentinel_obj_(sentinel),
       ev_thread_(sentinel_thread_control),
       shard_group_name_(std::move(shard_group_name)),
@@ -69,6 +69,7 @@ SentinelImpl::SentinelImpl(
       cluster_mode_failed_(false),
       key_shard_(std::move(key_shard)),
       connection_mode_(mode),
+      client_side_cache_(std::move(client_side_cache)),
       slot_info_(IsInClusterMode() ? std::make_unique<SlotInfo>() : nullptr) {
   for (size_t i = 0; i < init_shards_->size(); ++i) {
     shards_[(*init_shards_)[i]] = i;
@@ -182,6 +183,7 @@ void SentinelImpl::InitShards(
                                            ready_callback](bool ready) {
       if (ready_callback) ready_callback(i, shard, ready);
     };
+    shard_options.client_side_cache = client_side_cache_;
     auto object = std::make_shared<Shard>(std::move(shard_options));
     object->SignalInstanceStateChange().connect(
         [this](ServerId, Redis::State state) {
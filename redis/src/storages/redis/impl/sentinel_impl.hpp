@@ -45,7 +45,8 @@ class SentinelImpl {
                std::string shard_group_name, const std::string& client_name,
                const Password& password, ReadyChangeCallback ready_callback,
                std::unique_ptr<KeyShard>&& key_shard,
-               ConnectionMode mode = ConnectionMode::kCommands);
+               ConnectionMode mode = ConnectionMode::kCommands,
+               std::shared_ptr<ClientSideCache> client_side_cache = nullptr);
   ~SentinelImpl();
 
   std::unordered_map<ServerId, size_t, ServerIdHasher>
@@ -219,6 +220,7 @@ class SentinelImpl {
   std::atomic<size_t> current_slots_shard_ = 0;
   utils::SwappingSmart<KeyShard> key_shard_;
   ConnectionMode connection_mode_;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
   std::unique_ptr<SlotInfo> slot_info_;
   SentinelStatisticsInternal statistics_internal_;
   utils::SwappingSmart<KeysForShards> keys_for_shards_;
@@ -56,7 +56,8 @@ Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
       ready_change_callback_(std::move(options.ready_change_callback)),
-      cluster_mode_(options.cluster_mode) {
+      cluster_mode_(options.cluster_mode),
+      client_side_cache_(std::move(options.client_side_cache)) {
   for (const auto& conn : options.connection_infos) {
     connection_infos_.emplace_back(conn);
   }
@@ -280,7 +281,7 @@ bool Shard::ProcessCreation(
                 redis_thread_pool,
                 // https://github.com/boostorg/signals2/issues/59
                 // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
-                cluster_mode_ && id.IsReadOnly())};
+                cluster_mode_ && id.IsReadOnly(), client_side_cache_)};
     if (auto commands_buffering_settings = commands_buffering_settings_.Get())
       entry.instance->SetCommandsBufferingSettings(
           *commands_buffering_settings);
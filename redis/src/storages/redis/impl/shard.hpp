@@ -16,6 +16,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
+
 class ConnectionInfoInt {
  public:
   ConnectionInfoInt() = default;
@@ -62,6 +64,7 @@ class Shard {
     bool cluster_mode{false};
     std::function<void(bool ready)> ready_change_callback;
     std::vector<ConnectionInfo> connection_infos;
+    std::shared_ptr<ClientSideCache> client_side_cache;
   };
 
   explicit Shard(Options options);
@@ -129,6 +132,7 @@ class Shard {
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace redis
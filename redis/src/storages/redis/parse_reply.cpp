@@ -1,5 +1,7 @@
 #include <userver/storages/redis/parse_reply.hpp>
 
+#include <algorithm>
+
 #include <userver/storages/redis/reply.hpp>
 #include <userver/utils/from_string.hpp>
 
@@ -37,6 +39,25 @@ ReplyData::MovableKeyValues GetKeyValues(
   }
 }
 
+// RESP3 replies of WITHSCORES commands are arrays of [member, score] pairs,
+// they are flattened into the RESP2 form
+void FlattenPairs(ReplyData& array_data) {
+  auto& array = array_data.GetArray();
+  const bool has_pairs =
+      !array.empty() &&
+      std::all_of(array.begin(), array.end(), [](const ReplyData& elem) {
+        return elem.IsArray() && elem.GetArray().size() == 2;
+      });
+  if (!has_pairs) return;
+
+  ReplyData::Array flat;
+  flat.reserve(array.size() * 2);
+  for (auto& pair : array) {
+    for (auto& elem : pair.GetArray()) flat.push_back(std::move(elem));
+  }
+  array_data = ReplyData(std::move(flat));
+}
+
 Point ParsePointArray(const redis::ReplyData& elem,
                       const std::string& request_description) {
   const auto& array = elem.GetArray();
@@ -125,6 +146,7 @@ std::vector<std::optional<std::string>> ParseReplyDataArray(
 std::vector<std::pair<std::string, std::string>> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<std::pair<std::string, std::string>>>) {
+  FlattenPairs(array_data);
   auto key_values = GetKeyValues(array_data, request_description);
 
   std::vector<std::pair<std::string, std::string>> result;
@@ -140,6 +162,7 @@ std::vector<std::pair<std::string, std::string>> ParseReplyDataArray(
 std::vector<MemberScore> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<MemberScore>>) {
+  FlattenPairs(array_data);
   auto key_values = GetKeyValues(array_data, request_description);
 
   std::vector<MemberScore> result;
@@ -11,6 +11,8 @@
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+
 #include "client_impl.hpp"
 #include "scan_reply.hpp"
 
@@ -124,6 +126,43 @@ class DummyRequestDataImpl final : public RequestDataBase<Result, ReplyType> {
   ReplyPtr reply_;
 };
 
+/// Stores the reply in the client side cache once it is received
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataImplBase,
+                                     public RequestDataBase<Result, ReplyType> {
+ public:
+  CachingRequestDataImpl(
+      USERVER_NAMESPACE::redis::Request&& request,
+      std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+      USERVER_NAMESPACE::redis::ClientSideCache::FillToken fill_token,
+      std::string key, std::string subkey)
+      : RequestDataImplBase(std::move(request)),
+        cache_(std::move(cache)),
+        fill_token_(fill_token),
+        key_(std::move(key)),
+        subkey_(std::move(subkey)) {}
+
+  void Wait() override { impl::Wait(GetRequest()); }
+
+  ReplyType Get(const std::string& request_description) override {
+    return ParseReply<Result, ReplyType>(GetRaw(), request_description);
+  }
+
+  ReplyPtr GetRaw() override {
+    auto reply = GetReply();
+    if (*reply && (reply->data.IsString() || reply->data.IsNil())) {
+      cache_->Put(key_, subkey_, reply->data, reply->server_id, fill_token_);
+    }
+    return reply;
+  }
+
+ private:
+  const std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache_;
+  const USERVER_NAMESPACE::redis::ClientSideCache::FillToken fill_token_;
+  const std::string key_;
+  const std::string subkey_;
+};
+
 template <ScanTag scan_tag>
 class RequestScanData final : public RequestScanDataBase<scan_tag> {
  public:
@@ -42,6 +42,19 @@ Request<Result, ReplyType> CreateDummyRequest(
           std::move(reply)));
 }
 
+template <typename Result, typename ReplyType = DefaultReplyType<Result>>
+Request<Result, ReplyType> CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+    USERVER_NAMESPACE::redis::ClientSideCache::FillToken fill_token,
+    std::string key, std::string subkey,
+    Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<CachingRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(cache), fill_token, std::move(key),
+          std::move(subkey)));
+}
+
 }  // namespace impl
 
 template <typename Request>
@@ -57,6 +70,18 @@ Request CreateAggregateRequest(
   return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+    USERVER_NAMESPACE::redis::ClientSideCache::FillToken fill_token,
+    std::string key, std::string subkey) {
+  Request* tmp = nullptr;
+  return impl::CreateCachingRequest(std::move(request), std::move(cache),
+                                    fill_token, std::move(key),
+                                    std::move(subkey), tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
   Request* tmp = nullptr;
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// CLOCK (second chance) cache. Unlike LruBase, lookups do not reorder the
+/// elements and only set an atomic access bit, so concurrent `Get` calls are
+/// safe. All other member functions require exclusive access.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class ClockBase final {
+ public:
+  explicit ClockBase(size_t max_size, const Hash& hash = Hash(),
+                     const Equal& equal = Equal());
+
+  ClockBase(ClockBase&& other) noexcept = default;
+  ClockBase& operator=(ClockBase&& other) noexcept = default;
+
+  ClockBase(const ClockBase&) = delete;
+  ClockBase& operator=(const ClockBase&) = delete;
+
+  /// @returns true if key is a new one
+  bool Put(const T& key, U value);
+
+  void Erase(const T& key);
+
+  /// Marks the element as recently used. May be called concurrently with
+  /// other `Get` calls.
+  const U* Get(const T& key) const;
+
+  U GetOr(const T& key, const U& default_value) const {
+    const auto* ptr = Get(key);
+    if (ptr) return *ptr;
+    return default_value;
+  }
+
+  void SetMaxSize(size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  size_t GetSize() const { return map_.size(); }
+
+ private:
+  struct Entry final {
+    explicit Entry(U&& value) : value(std::move(value)) {}
+
+    U value;
+    std::size_t slot{0};
+    mutable std::atomic<bool> referenced{false};
+  };
+
+  using Map = std::unordered_map<T, Entry, Hash, Equal>;
+  using Item = typename Map::value_type;
+
+  Item& Evict() noexcept;
+  void Insert(const T& key, U&& value);
+
+  Map map_;
+  // Element pointers are stable across map rehashes
+  std::vector<Item*> slots_;
+  std::vector<std::size_t> free_slots_;
+  std::size_t hand_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+ClockBase<T, U, Hash, Equal>::ClockBase(size_t max_size, const Hash& hash,
+                                        const Equal& equal)
+    : map_(max_size ? max_size : 1, hash, equal) {
+  UASSERT(max_size > 0);
+  SetMaxSize(max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool ClockBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  auto it = map_.find(key);
+  if (it != map_.end()) {
+    it->second.value = std::move(value);
+    it->second.referenced.store(true, std::memory_order_relaxed);
+    return false;
+  }
+
+  Insert(key, std::move(value));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Erase(const T& key) {
+  auto it = map_.find(key);
+  if (it == map_.end()) return;
+
+  const auto slot = it->second.slot;
+  slots_[slot] = nullptr;
+  free_slots_.push_back(slot);
+  map_.erase(it);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const U* ClockBase<T, U, Hash, Equal>::Get(const T& key) const {
+  const auto it = map_.find(key);
+  if (it == map_.end()) return nullptr;
+
+  auto& referenced = it->second.referenced;
+  // Avoid dirtying the cache line if the bit is already set
+  if (!referenced.load(std::memory_order_relaxed)) {
+    referenced.store(true, std::memory_order_relaxed);
+  }
+  return &it->second.value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::SetMaxSize(size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  if (!new_max_size) ++new_max_size;
+  if (slots_.size() == new_max_size) return;
+
+  while (map_.size() > new_max_size) {
+    auto& victim = Evict();
+    slots_[victim.second.slot] = nullptr;
+    map_.erase(map_.find(victim.first));
+  }
+
+  std::vector<Item*> new_slots;
+  new_slots.reserve(new_max_size);
+  for (auto* item : slots_) {
+    if (!item) continue;
+    item->second.slot = new_slots.size();
+    new_slots.push_back(item);
+  }
+
+  free_slots_.clear();
+  for (auto slot = new_max_size; slot > new_slots.size(); --slot) {
+    free_slots_.push_back(slot - 1);
+  }
+  new_slots.resize(new_max_size, nullptr);
+
+  slots_ = std::move(new_slots);
+  hand_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Clear() noexcept {
+  map_.clear();
+  free_slots_.clear();
+  for (auto slot = slots_.size(); slot > 0; --slot) {
+    slots_[slot - 1] = nullptr;
+    free_slots_.push_back(slot - 1);
+  }
+  hand_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void ClockBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  for (const auto& [key, entry] : map_) {
+    func(key, entry.value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename ClockBase<T, U, Hash, Equal>::Item&
+ClockBase<T, U, Hash, Equal>::Evict() noexcept {
+  UASSERT(!map_.empty());
+
+  // Terminates in at most two passes, because the first pass clears all the
+  // access bits
+  while (true) {
+    auto* item = slots_[hand_];
+    hand_ = (hand_ + 1 == slots_.size()) ? 0 : hand_ + 1;
+    if (!item) continue;
+    if (item->second.referenced.exchange(false, std::memory_order_relaxed)) {
+      continue;
+    }
+    return *item;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Insert(const T& key, U&& value) {
+  if (free_slots_.empty()) {
+    auto& victim = Evict();
+    free_slots_.push_back(victim.second.slot);
+    slots_[victim.second.slot] = nullptr;
+    map_.erase(map_.find(victim.first));
+  }
+
+  const auto slot = free_slots_.back();
+  auto [it, ok] = map_.emplace(std::piecewise_construct,
+                               std::forward_as_tuple(key),
+                               std::forward_as_tuple(std::move(value)));
+  UASSERT(ok);
+  free_slots_.pop_back();
+
+  it->second.slot = slot;
+  slots_[slot] = &*it;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Count-Min sketch of 4-bit counters with periodic aging, used by TinyLFU to
+/// estimate how often the keys were accessed recently.
+///
+/// All the counters are halved after `10 * capacity` increments, so that the
+/// keys that were popular long ago do not stay in the cache forever.
+template <typename T, typename Hash = std::hash<T>>
+class FrequencySketch final {
+ public:
+  static constexpr unsigned kMaxFrequency = 15;
+
+  explicit FrequencySketch(std::size_t capacity, const Hash& hash = Hash())
+      : hash_(hash) {
+    Resize(capacity);
+  }
+
+  /// Drops all the counters and adjusts the sketch to the new cache capacity
+  void Resize(std::size_t capacity) {
+    std::size_t words = 1;
+    while (words < capacity) words <<= 1;
+
+    table_.assign(words, 0);
+    sample_size_ = 10 * (capacity ? capacity : 1);
+    additions_ = 0;
+  }
+
+  /// Records an access to the key
+  void Increment(const T& key) {
+    const auto hash = Spread(hash_(key));
+
+    bool added = false;
+    for (unsigned i = 0; i < kDepth; ++i) {
+      added |= IncrementAt(CounterIndex(hash, i));
+    }
+
+    if (added && ++additions_ >= sample_size_) Age();
+  }
+
+  /// Returns the estimated number of recent accesses to the key, at most
+  /// kMaxFrequency
+  unsigned Estimate(const T& key) const {
+    const auto hash = Spread(hash_(key));
+
+    unsigned frequency = kMaxFrequency;
+    for (unsigned i = 0; i < kDepth; ++i) {
+      const auto counter = CounterAt(CounterIndex(hash, i));
+      if (counter < frequency) frequency = counter;
+    }
+    return frequency;
+  }
+
+  void Clear() noexcept {
+    for (auto& word : table_) word = 0;
+    additions_ = 0;
+  }
+
+ private:
+  static constexpr unsigned kDepth = 4;
+  static constexpr unsigned kCountersPerWord = 16;
+  static constexpr std::uint64_t kSeeds[kDepth] = {
+      0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+      0xcbf29ce484222325ULL};
+
+  static std::uint64_t Spread(std::uint64_t hash) noexcept {
+    // murmur3 finalizer, std::hash for integers is an identity
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  std::size_t CounterIndex(std::uint64_t hash, unsigned i) const noexcept {
+    auto h = (hash + kSeeds[i]) * kSeeds[i];
+    h += h >> 32;
+    return h & (table_.size() * kCountersPerWord - 1);
+  }
+
+  unsigned CounterAt(std::size_t index) const noexcept {
+    const auto shift = (index % kCountersPerWord) * 4;
+    return (table_[index / kCountersPerWord] >> shift) & 0xf;
+  }
+
+  bool IncrementAt(std::size_t index) noexcept {
+    const auto shift = (index % kCountersPerWord) * 4;
+    auto& word = table_[index / kCountersPerWord];
+    if (((word >> shift) & 0xf) == kMaxFrequency) return false;
+
+    word += std::uint64_t{1} << shift;
+    return true;
+  }
+
+  void Age() noexcept {
+    for (auto& word : table_) {
+      word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    additions_ /= 2;
+  }
+
+  Hash hash_;
+  std::vector<std::uint64_t> table_;
+  std::size_t sample_size_{0};
+  std::size_t additions_{0};
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include <userver/cache/impl/frequency_sketch.hpp>
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// W-TinyLFU cache. New elements enter a small LRU window. Elements evicted
+/// from the window are admitted into the main segmented LRU only if they were
+/// accessed more often than the main segment victim, according to the
+/// FrequencySketch. That keeps the hot working set when cold keys are
+/// scanned through the cache.
+///
+/// The main segment is split into `probation` for the admitted elements and
+/// `protected` for the elements that were accessed again after admission.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class TinyLfuBase final {
+ public:
+  explicit TinyLfuBase(size_t max_size, const Hash& hash, const Equal& equal);
+
+  TinyLfuBase(TinyLfuBase&& other) noexcept = default;
+  TinyLfuBase& operator=(TinyLfuBase&& other) noexcept = default;
+
+  TinyLfuBase(const TinyLfuBase&) = delete;
+  TinyLfuBase& operator=(const TinyLfuBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  const T* GetLeastUsedKey();
+
+  U* GetLeastUsedValue();
+
+  void SetMaxSize(size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  size_t GetSize() const;
+
+ private:
+  using Segment = LruBase<T, U, Hash, Equal>;
+
+  static constexpr std::size_t kWindowPercent = 1;
+  static constexpr std::size_t kProtectedPercent = 80;
+
+  LruBase<T, U, Hash, Equal>& MainVictimSegment();
+  size_t GetMainSize() const;
+
+  // Looks up the element without recording the access
+  U* Find(const T& key);
+
+  // Puts a new element into the window
+  void Insert(const T& key, U value);
+
+  // Moves the element from probation to protected
+  U* Promote(const T& key, U& value);
+
+  // Decides whether the candidate evicted from the window enters the main
+  // segment
+  void Admit(std::pair<T, U>&& candidate);
+
+  // Evicts elements until the segments fit into their capacities
+  void Shrink();
+
+  static std::optional<std::pair<T, U>> ExtractLeastUsed(Segment& segment);
+
+  size_t max_size_{0};
+  size_t window_capacity_{0};
+  size_t main_capacity_{0};
+  size_t protected_capacity_{0};
+
+  FrequencySketch<T, Hash> sketch_;
+  Segment window_;
+  Segment probation_;
+  Segment protected_;
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+TinyLfuBase<T, U, Hash, Equal>::TinyLfuBase(size_t max_size, const Hash& hash,
+                                            const Equal& equal)
+    : sketch_(max_size, hash),
+      window_(1, hash, equal),
+      probation_(1, hash, equal),
+      protected_(1, hash, equal) {
+  SetMaxSize(max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool TinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  sketch_.Increment(key);
+
+  if (auto* existing = Find(key)) {
+    *existing = std::move(value);
+    return false;
+  }
+
+  Insert(key, std::move(value));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* TinyLfuBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  sketch_.Increment(key);
+
+  if (auto* existing = Find(key)) return existing;
+
+  Insert(key, U{std::forward<Args>(args)...});
+  return window_.Get(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+  window_.Erase(key);
+  probation_.Erase(key);
+  protected_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+  sketch_.Increment(key);
+  return Find(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const T* TinyLfuBase<T, U, Hash, Equal>::GetLeastUsedKey() {
+  if (GetMainSize() == 0) return window_.GetLeastUsedKey();
+  return MainVictimSegment().GetLeastUsedKey();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::GetLeastUsedValue() {
+  if (GetMainSize() == 0) return window_.GetLeastUsedValue();
+  return MainVictimSegment().GetLeastUsedValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::SetMaxSize(size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  if (!new_max_size) ++new_max_size;
+
+  // keeps the frequencies that drive the admission
+  if (max_size_ == new_max_size) return;
+  max_size_ = new_max_size;
+
+  window_capacity_ = new_max_size * kWindowPercent / 100;
+  if (window_capacity_ == 0) window_capacity_ = 1;
+  main_capacity_ = new_max_size - window_capacity_;
+  protected_capacity_ = main_capacity_ * kProtectedPercent / 100;
+
+  Shrink();
+  sketch_.Resize(new_max_size);
+
+  // Segments never exceed the capacities tracked above, their own limits only
+  // size the hash tables
+  window_.SetMaxSize(window_capacity_);
+  probation_.SetMaxSize(main_capacity_ ? main_capacity_ : 1);
+  protected_.SetMaxSize(protected_capacity_ ? protected_capacity_ : 1);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+  window_.Clear();
+  probation_.Clear();
+  protected_.Clear();
+  sketch_.Clear();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void TinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+size_t TinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+  return window_.GetSize() + GetMainSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+LruBase<T, U, Hash, Equal>&
+TinyLfuBase<T, U, Hash, Equal>::MainVictimSegment() {
+  return probation_.GetSize() ? probation_ : protected_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+size_t TinyLfuBase<T, U, Hash, Equal>::GetMainSize() const {
+  return probation_.GetSize() + protected_.GetSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Find(const T& key) {
+  if (auto* value = window_.Get(key)) return value;
+  if (auto* value = protected_.Get(key)) return value;
+  if (auto* value = probation_.Get(key)) return Promote(key, *value);
+  return nullptr;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Insert(const T& key, U value) {
+  std::optional<std::pair<T, U>> candidate;
+  if (window_.GetSize() >= window_capacity_) {
+    candidate = ExtractLeastUsed(window_);
+  }
+  window_.Put(key, std::move(value));
+  if (candidate) Admit(std::move(*candidate));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* TinyLfuBase<T, U, Hash, Equal>::Promote(const T& key, U& value) {
+  if (protected_capacity_ == 0) return &value;
+
+  auto promoted = std::pair<T, U>{key, std::move(value)};
+  probation_.Erase(key);
+
+  if (protected_.GetSize() >= protected_capacity_) {
+    auto demoted = ExtractLeastUsed(protected_);
+    UASSERT(demoted);
+    probation_.Put(demoted->first, std::move(demoted->second));
+  }
+
+  protected_.Put(promoted.first, std::move(promoted.second));
+  return protected_.Get(promoted.first);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Admit(std::pair<T, U>&& candidate) {
+  if (main_capacity_ == 0) return;
+
+  if (GetMainSize() >= main_capacity_) {
+    auto& victim_segment = MainVictimSegment();
+    const auto* victim = victim_segment.GetLeastUsedKey();
+    UASSERT(victim);
+    if (sketch_.Estimate(candidate.first) <= sketch_.Estimate(*victim)) {
+      return;
+    }
+    victim_segment.Erase(*victim);
+  }
+
+  probation_.Put(candidate.first, std::move(candidate.second));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void TinyLfuBase<T, U, Hash, Equal>::Shrink() {
+  while (window_.GetSize() > window_capacity_) {
+    auto candidate = ExtractLeastUsed(window_);
+    UASSERT(candidate);
+    Admit(std::move(*candidate));
+  }
+
+  while (protected_.GetSize() > protected_capacity_) {
+    auto demoted = ExtractLeastUsed(protected_);
+    UASSERT(demoted);
+    probation_.Put(demoted->first, std::move(demoted->second));
+  }
+
+  while (GetMainSize() > main_capacity_) {
+    auto& victim_segment = MainVictimSegment();
+    victim_segment.Erase(*victim_segment.GetLeastUsedKey());
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::optional<std::pair<T, U>>
+TinyLfuBase<T, U, Hash, Equal>::ExtractLeastUsed(Segment& segment) {
+  const auto* key = segment.GetLeastUsedKey();
+  if (!key) return std::nullopt;
+
+  std::pair<T, U> result{*key, std::move(*segment.GetLeastUsedValue())};
+  segment.Erase(result.first);
+  return result;
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,11 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
+#include <type_traits>
+
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/policy.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,10 +17,16 @@ namespace cache {
 /// @ingroup userver_containers
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
-/// thread safety
+/// thread safety. With CachePolicy::kTinyLFU new keys are admitted only if
+/// they are used more often than the ones they would evict.
 template <typename T, typename U, typename Hash = std::hash<T>,
-          typename Equal = std::equal_to<T>>
+          typename Equal = std::equal_to<T>,
+          CachePolicy Policy = CachePolicy::kLRU>
 class LruMap final {
+  static_assert(Policy != CachePolicy::kClock,
+                "CLOCK policy only pays off for concurrent lookups, use "
+                "cache::NWayLRU");
+
  public:
   explicit LruMap(size_t max_size, const Hash& hash = Hash(),
                   const Equal& equal = Equal())
@@ -83,7 +93,10 @@ class LruMap final {
   size_t GetSize() const { return impl_.GetSize(); }
 
  private:
-  impl::LruBase<T, U, Hash, Equal> impl_;
+  std::conditional_t<Policy == CachePolicy::kTinyLFU,
+                     impl::TinyLfuBase<T, U, Hash, Equal>,
+                     impl::LruBase<T, U, Hash, Equal>>
+      impl_;
 };
 
 }  // namespace cache
@@ -0,0 +1,29 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Eviction policy of the cache::LruMap and cache::NWayLRU ways
+enum class CachePolicy {
+  /// Exact LRU. Each lookup moves the element to the front of the usage list,
+  /// so lookups are serialized by the way lock.
+  kLRU,
+
+  /// CLOCK (second chance) approximation of LRU. Lookups only set an access
+  /// bit and run concurrently with each other, modifications are serialized.
+  /// Only supported by cache::NWayLRU.
+  kClock,
+
+  /// W-TinyLFU. New elements are admitted into the main LRU segment only if
+  /// they are accessed more frequently than the element they would evict, so
+  /// scans of cold keys do not wash out the hot working set.
+  kTinyLFU,
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -32,6 +32,10 @@ enum class OpenFlag {
   /// Used together with `kWrite` to clear the contents of the file in case it
   /// already exists.
   kTruncate = 1 << 4,
+
+  /// Used together with `kWrite` to write at the end of the file, even if it
+  /// is written to by other processes.
+  kAppend = 1 << 5,
 };
 
 /// A set of OpenFlags
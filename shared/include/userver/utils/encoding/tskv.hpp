@@ -3,8 +3,13 @@
 /// @file userver/utils/encoding/tskv.hpp
 /// @brief Encoders, decoders and helpers for TSKV representations
 
+#include <cstring>
 #include <ostream>
 #include <string>
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,6 +29,9 @@ struct TypeNeedsEncodeTskv
     : std::integral_constant<bool, std::is_same<T, char>::value ||
                                        !std::is_arithmetic<T>::value> {};
 
+/// Puts a single character into `T`. Specializations may also provide
+/// `Append(T& to, const char* first, const char* last)` for bulk writes of
+/// the runs that need no escaping.
 template <typename T>
 class EncodeTskvPutCharDefault final {
  public:
@@ -34,14 +42,36 @@ template <>
 class EncodeTskvPutCharDefault<std::ostream> final {
  public:
   void operator()(std::ostream& to, char ch) const { to.put(ch); }
+
+  void Append(std::ostream& to, const char* first, const char* last) const {
+    to.write(first, last - first);
+  }
 };
 
 template <>
 class EncodeTskvPutCharDefault<std::string> final {
  public:
   void operator()(std::string& to, char ch) const { to.push_back(ch); }
+
+  void Append(std::string& to, const char* first, const char* last) const {
+    to.append(first, last);
+  }
 };
 
+namespace impl {
+
+/// Returns the first character in [first, last) that has to be escaped in
+/// EncodeTskvMode::kValue, or `last`. Uses SSE2 or AVX2 if the CPU supports
+/// them.
+const char* FindTskvValueEscape(const char* first, const char* last) noexcept;
+
+template <typename T, typename PutChar>
+using TskvBulkAppend = decltype(std::declval<const PutChar&>().Append(
+    std::declval<T&>(), std::declval<const char*>(),
+    std::declval<const char*>()));
+
+}  // namespace impl
+
 /// @brief Encode according to the TSKV rules, but without escaping the
 /// quotation mark (").
 /// @{
@@ -122,23 +152,43 @@ typename std::enable_if<std::is_same<Char, char>::value, void>::type EncodeTskv(
   }
 }
 
-template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>>
-void EncodeTskv(T& to, const std::string& str, EncodeTskvMode mode,
+template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>,
+          typename It>
+void EncodeTskv(T& to, It first, It last, EncodeTskvMode mode,
                 const EncodeTskvPutChar& put_char = EncodeTskvPutChar()) {
-  EncodeTskv(to, str.cbegin(), str.cend(), mode, put_char);
+  if constexpr (std::is_same_v<It, const char*>) {
+    if (mode == EncodeTskvMode::kValue) {
+      // Most of the values need no escaping, copy the clean runs in bulk
+      while (first != last) {
+        const auto* const special = impl::FindTskvValueEscape(first, last);
+        if constexpr (meta::kIsDetected<impl::TskvBulkAppend, T,
+                                        EncodeTskvPutChar>) {
+          put_char.Append(to, first, special);
+        } else {
+          for (const auto* it = first; it != special; ++it) put_char(to, *it);
+        }
+        if (special == last) return;
+        EncodeTskv(to, *special, mode, put_char);
+        first = special + 1;
+      }
+      return;
+    }
+  }
+
+  for (auto it = first; it != last; ++it) EncodeTskv(to, *it, mode, put_char);
 }
 
 template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>>
-void EncodeTskv(T& to, const char* str, EncodeTskvMode mode,
+void EncodeTskv(T& to, const std::string& str, EncodeTskvMode mode,
                 const EncodeTskvPutChar& put_char = EncodeTskvPutChar()) {
-  for (const auto* ptr = str; *ptr; ++ptr) EncodeTskv(to, *ptr, mode, put_char);
+  const char* data = str.data();
+  EncodeTskv(to, data, data + str.size(), mode, put_char);
 }
 
-template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>,
-          typename It>
-void EncodeTskv(T& to, It first, It last, EncodeTskvMode mode,
+template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>>
+void EncodeTskv(T& to, const char* str, EncodeTskvMode mode,
                 const EncodeTskvPutChar& put_char = EncodeTskvPutChar()) {
-  for (auto it = first; it != last; ++it) EncodeTskv(to, *it, mode, put_char);
+  EncodeTskv(to, str, str + std::strlen(str), mode, put_char);
 }
 
 template <typename T, typename EncodeTskvPutChar = EncodeTskvPutCharDefault<T>>
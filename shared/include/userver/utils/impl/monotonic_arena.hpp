@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+/// Bump pointer allocator for objects with a common lifetime. Memory is
+/// released only when the arena is destroyed. Not thread safe.
+class MonotonicArena final {
+ public:
+  /// Uses no initial buffer, the first allocation goes to the heap
+  MonotonicArena() noexcept;
+
+  /// Serves the allocations from `initial_buffer` first, then from the heap
+  /// blocks, each next one twice as large as the previous one. The buffer
+  /// must outlive the arena.
+  MonotonicArena(void* initial_buffer, std::size_t initial_size) noexcept;
+
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  ~MonotonicArena();
+
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /// Copies the characters into the arena
+  std::string_view CopyString(std::string_view str);
+
+  /// @returns the number of heap blocks allocated by the arena so far
+  std::size_t GetHeapBlocksCount() const noexcept { return heap_blocks_count_; }
+
+ private:
+  struct BlockHeader;
+
+  void* AllocateFromNewBlock(std::size_t size, std::size_t alignment);
+
+  char* current_{nullptr};
+  char* end_{nullptr};
+  BlockHeader* blocks_{nullptr};
+  std::size_t next_block_size_;
+  std::size_t heap_blocks_count_{0};
+};
+
+/// Standard Library compatible allocator that takes memory from
+/// MonotonicArena. A default constructed allocator uses the heap, which keeps
+/// the containers that use it default constructible.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  ArenaAllocator() noexcept = default;
+
+  explicit ArenaAllocator(MonotonicArena& arena) noexcept : arena_(&arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : arena_(other.GetArena()) {}
+
+  T* allocate(std::size_t n) {
+    if (!arena_) return std::allocator<T>{}.allocate(n);
+
+    if (n > static_cast<std::size_t>(-1) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    if (!arena_) std::allocator<T>{}.deallocate(ptr, n);
+  }
+
+  MonotonicArena* GetArena() const noexcept { return arena_; }
+
+ private:
+  MonotonicArena* arena_{nullptr};
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs,
+                const ArenaAllocator<U>& rhs) noexcept {
+  return lhs.GetArena() == rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs,
+                const ArenaAllocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
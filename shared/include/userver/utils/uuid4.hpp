@@ -3,6 +3,8 @@
 /// @file utils/uuid4.hpp
 /// @brief @copybrief utils::generators::GenerateUuid
 
+#include <array>
+#include <cstdint>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +14,13 @@ namespace utils::generators {
 /// @brief Generate a UUID string
 std::string GenerateUuid();
 
+namespace impl {
+
+/// Bytes of a random UUID, the ones formatted by GenerateUuid()
+std::array<std::uint8_t, 16> GenerateUuidBytes();
+
+}  // namespace impl
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
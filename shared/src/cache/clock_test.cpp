@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <userver/cache/impl/clock.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Clock = cache::impl::ClockBase<int, int>;
+
+TEST(Clock, SetGet) {
+  Clock cache(10);
+  EXPECT_EQ(nullptr, cache.Get(1));
+  cache.Put(1, 2);
+  EXPECT_EQ(2, cache.GetOr(1, -1));
+  cache.Put(1, 3);
+  EXPECT_EQ(3, cache.GetOr(1, -1));
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(Clock, Erase) {
+  Clock cache(2);
+  cache.Put(1, 10);
+  cache.Erase(1);
+  EXPECT_EQ(nullptr, cache.Get(1));
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(2, 20);
+  cache.Put(3, 30);
+  EXPECT_EQ(20, cache.GetOr(2, -1));
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+}
+
+TEST(Clock, Overflow) {
+  Clock cache(2);
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  cache.Put(3, 30);
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(-1, cache.GetOr(1, -1));
+  EXPECT_EQ(20, cache.GetOr(2, -1));
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+}
+
+TEST(Clock, SecondChance) {
+  Clock cache(2);
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  EXPECT_EQ(10, cache.GetOr(1, -1));
+
+  cache.Put(3, 30);
+  EXPECT_EQ(10, cache.GetOr(1, -1));
+  EXPECT_EQ(-1, cache.GetOr(2, -1));
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+}
+
+TEST(Clock, SetMaxSize) {
+  Clock cache(3);
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  cache.Put(3, 30);
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+
+  cache.SetMaxSize(1);
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+
+  cache.SetMaxSize(2);
+  cache.Put(4, 40);
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(30, cache.GetOr(3, -1));
+  EXPECT_EQ(40, cache.GetOr(4, -1));
+}
+
+TEST(Clock, Clear) {
+  Clock cache(2);
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  cache.Clear();
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(3, 30);
+  cache.Put(4, 40);
+  EXPECT_EQ(2, cache.GetSize());
+
+  int sum = 0;
+  cache.VisitAll([&sum](int key, int value) { sum += key + value; });
+  EXPECT_EQ(77, sum);
+}
+
+USERVER_NAMESPACE_END
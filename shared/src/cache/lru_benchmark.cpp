@@ -1,5 +1,17 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <userver/cache/impl/clock.hpp>
+#include <userver/cache/lru_map.hpp>
 #include <userver/cache/lru_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -51,4 +63,145 @@ void LruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(LruPutOverflow);
 
+namespace {
+
+// Read-only lookups from state.range(0) threads into a single way, the way
+// lock is taken the same way cache::NWayLRU takes it for the policy
+template <typename Map, typename Mutex, typename Lock>
+void LookupContention(benchmark::State& state) {
+  Map map(kElementsCount);
+  for (unsigned i = 0; i < kElementsCount; ++i) map.Put(i, i);
+  Mutex mutex;
+
+  std::atomic<bool> run{true};
+  std::atomic<std::uint64_t> lookups{0};
+  const auto lookup = [&](unsigned key) {
+    Lock lock(mutex);
+    benchmark::DoNotOptimize(map.Get(key % kElementsCount));
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < state.range(0); ++i) {
+    threads.emplace_back([&, i] {
+      std::uint64_t local_lookups = 0;
+      for (unsigned key = i; run; ++key) {
+        lookup(key);
+        ++local_lookups;
+      }
+      lookups += local_lookups;
+    });
+  }
+
+  std::uint64_t local_lookups = 0;
+  unsigned key = 0;
+  for (auto _ : state) {
+    lookup(++key);
+    ++local_lookups;
+  }
+  lookups += local_lookups;
+
+  run = false;
+  for (auto& thread : threads) thread.join();
+
+  state.counters["lookups"] = benchmark::Counter(
+      static_cast<double>(lookups.load()), benchmark::Counter::kIsRate);
+}
+
+using LruMap = cache::LruMap<unsigned, unsigned>;
+using ClockMap = cache::impl::ClockBase<unsigned, unsigned>;
+using TinyLfuMap = cache::LruMap<unsigned, unsigned, std::hash<unsigned>,
+                                 std::equal_to<unsigned>,
+                                 cache::CachePolicy::kTinyLFU>;
+
+constexpr unsigned kTraceKeys = 100'000;
+constexpr std::size_t kTraceLength = 1'000'000;
+
+// Zipf-distributed lookups of kTraceKeys keys interleaved with scans of keys
+// that are requested only once, which is what a typical key stream of a
+// handler cache looks like
+const std::vector<unsigned>& GetTrace() {
+  static const auto trace = [] {
+    std::vector<double> cdf(kTraceKeys);
+    double sum = 0;
+    for (unsigned i = 0; i < kTraceKeys; ++i) {
+      sum += 1.0 / std::pow(i + 1, 0.9);
+      cdf[i] = sum;
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> distribution(0, sum);
+    unsigned scan_key = kTraceKeys;
+
+    std::vector<unsigned> result;
+    result.reserve(kTraceLength);
+    while (result.size() < kTraceLength) {
+      if (result.size() % 100'000 == 50'000) {
+        for (unsigned i = 0; i < 20'000; ++i) result.push_back(scan_key++);
+      }
+
+      const auto it =
+          std::lower_bound(cdf.begin(), cdf.end(), distribution(gen));
+      result.push_back(it - cdf.begin());
+    }
+    return result;
+  }();
+  return trace;
+}
+
+// Replays the trace through a cache of state.range(0) elements, filling it on
+// misses
+template <typename Map>
+void TraceReplay(benchmark::State& state) {
+  const auto& trace = GetTrace();
+  std::size_t hits = 0;
+  std::size_t lookups = 0;
+
+  for (auto _ : state) {
+    Map map(state.range(0));
+    for (const auto key : trace) {
+      if (map.Get(key)) {
+        ++hits;
+      } else {
+        map.Put(key, key);
+      }
+    }
+    lookups += trace.size();
+  }
+
+  state.counters["hit_ratio"] =
+      static_cast<double>(hits) / static_cast<double>(lookups ? lookups : 1);
+  state.SetItemsProcessed(lookups);
+}
+
+}  // namespace
+
+void LruLookupContention(benchmark::State& state) {
+  LookupContention<LruMap, std::mutex, std::unique_lock<std::mutex>>(state);
+}
+BENCHMARK(LruLookupContention)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+void ClockLookupContention(benchmark::State& state) {
+  LookupContention<ClockMap, std::shared_mutex,
+                   std::shared_lock<std::shared_mutex>>(state);
+}
+BENCHMARK(ClockLookupContention)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+void LruTraceReplay(benchmark::State& state) {
+  TraceReplay<LruMap>(state);
+}
+BENCHMARK(LruTraceReplay)->RangeMultiplier(10)->Range(100, 10'000);
+
+void ClockTraceReplay(benchmark::State& state) {
+  TraceReplay<ClockMap>(state);
+}
+BENCHMARK(ClockTraceReplay)->RangeMultiplier(10)->Range(100, 10'000);
+
+void TinyLfuTraceReplay(benchmark::State& state) {
+  TraceReplay<TinyLfuMap>(state);
+}
+BENCHMARK(TinyLfuTraceReplay)->RangeMultiplier(10)->Range(100, 10'000);
+
 USERVER_NAMESPACE_END
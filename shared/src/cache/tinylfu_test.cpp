@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using TinyLfu = cache::LruMap<int, int, std::hash<int>, std::equal_to<int>,
+                              cache::CachePolicy::kTinyLFU>;
+
+TEST(TinyLfu, SetGet) {
+  TinyLfu cache(10);
+  EXPECT_EQ(nullptr, cache.Get(1));
+  EXPECT_TRUE(cache.Put(1, 2));
+  EXPECT_EQ(2, cache.GetOr(1, -1));
+  EXPECT_FALSE(cache.Put(1, 3));
+  EXPECT_EQ(3, cache.GetOr(1, -1));
+}
+
+TEST(TinyLfu, Erase) {
+  TinyLfu cache(10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i);
+  for (int i = 0; i < 10; ++i) cache.Erase(i);
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfu, NeverExceedsMaxSize) {
+  TinyLfu cache(100);
+  for (int i = 0; i < 1000; ++i) {
+    cache.Put(i, i);
+    cache.Get(i / 2);
+    ASSERT_LE(cache.GetSize(), 100);
+  }
+  EXPECT_EQ(100, cache.GetSize());
+}
+
+TEST(TinyLfu, ScanResistance) {
+  constexpr int kSize = 100;
+  constexpr int kHot = 50;
+
+  TinyLfu cache(kSize);
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < kHot; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // A scan of cold keys that are never requested again
+  for (int i = kHot; i < kHot + 10 * kSize; ++i) cache.Put(i, i);
+
+  int hot_hits = 0;
+  for (int i = 0; i < kHot; ++i) {
+    if (cache.Get(i)) ++hot_hits;
+  }
+  EXPECT_EQ(kHot, hot_hits);
+}
+
+TEST(TinyLfu, PlainLruIsWashedOutByScan) {
+  cache::LruMap<int, int> cache(100);
+  for (int i = 0; i < 50; ++i) cache.Put(i, i);
+  for (int i = 50; i < 1050; ++i) cache.Put(i, i);
+
+  for (int i = 0; i < 50; ++i) EXPECT_EQ(nullptr, cache.Get(i));
+}
+
+TEST(TinyLfu, SetMaxSize) {
+  TinyLfu cache(100);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+
+  cache.SetMaxSize(10);
+  EXPECT_LE(cache.GetSize(), 10);
+
+  cache.SetMaxSize(1);
+  EXPECT_LE(cache.GetSize(), 1);
+  cache.Put(1000, 1000);
+  EXPECT_EQ(1000, cache.GetOr(1000, -1));
+
+  cache.SetMaxSize(200);
+  for (int i = 0; i < 300; ++i) cache.Put(i, i);
+  EXPECT_EQ(200, cache.GetSize());
+}
+
+TEST(TinyLfu, SameMaxSizeKeepsFrequencies) {
+  constexpr int kSize = 100;
+  constexpr int kHot = 50;
+
+  TinyLfu cache(kSize);
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < kHot; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // e.g. a config update that does not change the cache size
+  cache.SetMaxSize(kSize);
+
+  for (int i = kHot; i < kHot + 10 * kSize; ++i) cache.Put(i, i);
+
+  int hot_hits = 0;
+  for (int i = 0; i < kHot; ++i) {
+    if (cache.Get(i)) ++hot_hits;
+  }
+  EXPECT_EQ(kHot, hot_hits);
+}
+
+TEST(TinyLfu, EmplaceCountsSingleAccess) {
+  constexpr int kSize = 100;
+
+  TinyLfu cache(kSize);
+  for (int i = 0; i < kSize; ++i) cache.Put(i, i);
+
+  // accessed once, it is no more frequent than the main segment victim
+  cache.Emplace(1000, 1000);
+  cache.Put(1001, 1001);
+  EXPECT_EQ(nullptr, cache.Get(1000));
+}
+
+TEST(TinyLfu, VisitAllAndClear) {
+  TinyLfu cache(10);
+  for (int i = 0; i < 10; ++i) {
+    cache.Put(i, i);
+    cache.Get(i);
+  }
+
+  int sum = 0;
+  cache.VisitAll([&sum](int key, int value) {
+    EXPECT_EQ(key, value);
+    sum += value;
+  });
+  int expected_sum = 0;
+  cache.VisitAll([&expected_sum](int key, const int&) { expected_sum += key; });
+  EXPECT_EQ(expected_sum, sum);
+
+  cache.Clear();
+  EXPECT_EQ(0, cache.GetSize());
+  EXPECT_EQ(nullptr, cache.GetLeastUsed());
+}
+
+USERVER_NAMESPACE_END
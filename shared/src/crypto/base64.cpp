@@ -1,11 +1,12 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
-#include <userver/crypto/exception.hpp>
-
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_BASE64_X86_SIMD
+#include <immintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,55 +15,410 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
+// Encodes the longest prefix of whole blocks, returns the size of the prefix
+using EncodeFunction = std::size_t (*)(const char* first, std::size_t size,
+                                       char* out) noexcept;
+
+// Decodes the longest prefix of blocks without padding and invalid characters,
+// returns the size of the prefix
+using DecodeFunction = std::size_t (*)(const char* first, std::size_t size,
+                                       char* out) noexcept;
+
+// Kernels may store up to this many bytes past the end of their output
+constexpr std::size_t kOutputSlack = 32;
+
+constexpr std::string_view kStandardChars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::string_view kUrlChars =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+constexpr std::array<std::int8_t, 256> MakeValues(std::string_view chars) {
+  std::array<std::int8_t, 256> result{};
+  for (auto& value : result) value = -1;
+  for (std::size_t i = 0; i < chars.size(); ++i) {
+    result[static_cast<unsigned char>(chars[i])] = static_cast<std::int8_t>(i);
+  }
+  return result;
+}
+
+template <bool Url>
+struct Alphabet {
+  static constexpr std::string_view kChars = Url ? kUrlChars : kStandardChars;
+  static constexpr std::array<std::int8_t, 256> kValues = MakeValues(kChars);
+};
+
+// No vectorized kernel, all of the data is left to the scalar loop
+template <bool Url>
+std::size_t EncodeNone(const char*, std::size_t, char*) noexcept {
+  return 0;
+}
+
+template <bool Url>
+std::size_t DecodeNone(const char*, std::size_t, char*) noexcept {
+  return 0;
+}
+
+#ifdef USERVER_BASE64_X86_SIMD
+
+// Algorithms are from "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions" by W. Mula and D. Lemire
+
+// Spreads 12 bytes into 16 six-bit indices
+__attribute__((target("ssse3"))) inline __m128i EncodeIndicesSsse3(
+    __m128i input) noexcept {
+  input = _mm_shuffle_epi8(
+      input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const auto high = _mm_mulhi_epu16(
+      _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)),
+      _mm_set1_epi32(0x04000040));
+  const auto low = _mm_mullo_epi16(
+      _mm_and_si128(input, _mm_set1_epi32(0x003f03f0)),
+      _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(high, low);
+}
+
+template <bool Url>
+__attribute__((target("ssse3"))) inline __m128i IndicesToCharsSsse3(
+    __m128i indices) noexcept {
+  constexpr char k62 = Alphabet<Url>::kChars[62];
+  constexpr char k63 = Alphabet<Url>::kChars[63];
+  const auto offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, k62 - 62, k63 - 63, 'A', 0, 0);
+
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+  auto offset_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  offset_index =
+      _mm_or_si128(offset_index, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+  return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, offset_index));
+}
+
+template <bool Url>
+__attribute__((target("ssse3"))) std::size_t EncodeSsse3(
+    const char* first, std::size_t size, char* out) noexcept {
+  std::size_t processed = 0;
+  // 16 bytes are loaded to encode 12
+  for (; size - processed >= 16; processed += 12, out += 16) {
+    const auto input =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + processed));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     IndicesToCharsSsse3<Url>(EncodeIndicesSsse3(input)));
+  }
+  return processed;
+}
+
+template <bool Url>
+__attribute__((target("avx2"))) std::size_t EncodeAvx2(const char* first,
+                                                       std::size_t size,
+                                                       char* out) noexcept {
+  const auto shuffle =
+      _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10,
+                      11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  constexpr char k62 = Alphabet<Url>::kChars[62];
+  constexpr char k63 = Alphabet<Url>::kChars[63];
+  const auto offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, k62 - 62, k63 - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, k62 - 62, k63 - 63, 'A', 0, 0);
+
+  std::size_t processed = 0;
+  // each 128-bit lane gets its own 12 bytes, 28 bytes are loaded to encode 24
+  for (; size - processed >= 28; processed += 24, out += 32) {
+    const auto* input_ptr =
+        reinterpret_cast<const __m128i*>(first + processed);
+    auto input = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(input_ptr)),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + processed +
+                                                         12)),
+        1);
+    input = _mm256_shuffle_epi8(input, shuffle);
+    const auto high = _mm256_mulhi_epu16(
+        _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00)),
+        _mm256_set1_epi32(0x04000040));
+    const auto low = _mm256_mullo_epi16(
+        _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0)),
+        _mm256_set1_epi32(0x01000010));
+    const auto indices = _mm256_or_si256(high, low);
+
+    auto offset_index = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const auto is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    offset_index = _mm256_or_si256(
+        offset_index, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(out),
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, offset_index)));
+  }
+  return processed + EncodeSsse3<Url>(first + processed, size - processed, out);
+}
+
+// URL characters are mapped to the standard ones, the standard '+' and '/'
+// are made invalid
+template <bool Url>
+__attribute__((target("ssse3"))) inline __m128i ToStandardSsse3(
+    __m128i input) noexcept {
+  if constexpr (!Url) {
+    return input;
+  } else {
+    const auto is_minus = _mm_cmpeq_epi8(input, _mm_set1_epi8('-'));
+    const auto is_underscore = _mm_cmpeq_epi8(input, _mm_set1_epi8('_'));
+    const auto is_standard =
+        _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8('+')),
+                     _mm_cmpeq_epi8(input, _mm_set1_epi8('/')));
+    input = _mm_or_si128(
+        _mm_andnot_si128(_mm_or_si128(is_minus, is_underscore), input),
+        _mm_or_si128(_mm_and_si128(is_minus, _mm_set1_epi8('+')),
+                     _mm_and_si128(is_underscore, _mm_set1_epi8('/'))));
+    // any invalid character works
+    return _mm_or_si128(input, _mm_and_si128(is_standard, _mm_set1_epi8('=')));
+  }
+}
+
+// Converts 16 characters to 12 bytes, returns false on an invalid character
+__attribute__((target("ssse3"))) inline bool DecodeBlockSsse3(
+    __m128i input, char* out) noexcept {
+  const auto valid_low = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                       0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+                                       0x1b, 0x1b, 0x1b, 0x1a);
+  const auto valid_high = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+                                        0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x10, 0x10);
+  const auto offsets =
+      _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const auto nibble = _mm_set1_epi8(0xf);
+
+  const auto high_nibbles = _mm_and_si128(_mm_srli_epi32(input, 4), nibble);
+  const auto low_nibbles = _mm_and_si128(input, nibble);
+  const auto invalid =
+      _mm_and_si128(_mm_shuffle_epi8(valid_low, low_nibbles),
+                    _mm_shuffle_epi8(valid_high, high_nibbles));
+  if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128()))) {
+    return false;
+  }
+
+  const auto is_slash = _mm_cmpeq_epi8(input, _mm_set1_epi8('/'));
+  const auto values = _mm_add_epi8(
+      input,
+      _mm_shuffle_epi8(offsets, _mm_add_epi8(is_slash, high_nibbles)));
+
+  const auto merged_pairs =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const auto merged = _mm_madd_epi16(merged_pairs, _mm_set1_epi32(0x00011000));
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(out),
+      _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14,
+                                             13, 12, -1, -1, -1, -1)));
+  return true;
+}
+
+template <bool Url>
+__attribute__((target("ssse3"))) std::size_t DecodeSsse3(
+    const char* first, std::size_t size, char* out) noexcept {
+  std::size_t processed = 0;
+  for (; size - processed >= 16; processed += 16, out += 12) {
+    const auto input = ToStandardSsse3<Url>(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + processed)));
+    if (!DecodeBlockSsse3(input, out)) break;
+  }
+  return processed;
+}
+
+template <bool Url>
+__attribute__((target("avx2"))) std::size_t DecodeAvx2(const char* first,
+                                                       std::size_t size,
+                                                       char* out) noexcept {
+  const auto valid_low = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+      0x1b, 0x1b, 0x1b, 0x1a, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+  const auto valid_high = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const auto offsets = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
+      -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const auto nibble = _mm256_set1_epi8(0xf);
+  const auto pack = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4,
+      10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  std::size_t processed = 0;
+  for (; size - processed >= 32; processed += 32, out += 24) {
+    auto input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + processed));
+    if constexpr (Url) {
+      input = _mm256_inserti128_si256(
+          _mm256_castsi128_si256(
+              ToStandardSsse3<Url>(_mm256_castsi256_si128(input))),
+          ToStandardSsse3<Url>(_mm256_extracti128_si256(input, 1)), 1);
+    }
+
+    const auto high_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(input, 4), nibble);
+    const auto low_nibbles = _mm256_and_si256(input, nibble);
+    const auto invalid =
+        _mm256_and_si256(_mm256_shuffle_epi8(valid_low, low_nibbles),
+                         _mm256_shuffle_epi8(valid_high, high_nibbles));
+    if (_mm256_movemask_epi8(
+            _mm256_cmpgt_epi8(invalid, _mm256_setzero_si256()))) {
+      break;
+    }
+
+    const auto is_slash = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('/'));
+    const auto values = _mm256_add_epi8(
+        input, _mm256_shuffle_epi8(offsets,
+                                   _mm256_add_epi8(is_slash, high_nibbles)));
+    const auto merged_pairs =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    const auto merged =
+        _mm256_madd_epi16(merged_pairs, _mm256_set1_epi32(0x00011000));
+    // 12 bytes in each lane are moved together
+    const auto packed = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(merged, pack),
+        _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), packed);
+  }
+  return processed + DecodeSsse3<Url>(first + processed, size - processed, out);
+}
+
+template <bool Url>
+EncodeFunction SelectEncode() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return &EncodeAvx2<Url>;
+  if (__builtin_cpu_supports("ssse3")) return &EncodeSsse3<Url>;
+  return &EncodeNone<Url>;
+}
+
+template <bool Url>
+DecodeFunction SelectDecode() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return &DecodeAvx2<Url>;
+  if (__builtin_cpu_supports("ssse3")) return &DecodeSsse3<Url>;
+  return &DecodeNone<Url>;
+}
+
+#else
+
+template <bool Url>
+EncodeFunction SelectEncode() noexcept {
+  return &EncodeNone<Url>;
+}
+
+template <bool Url>
+DecodeFunction SelectDecode() noexcept {
+  return &DecodeNone<Url>;
+}
+
+#endif
+
+template <bool Url>
 std::string Base64Encode(std::string_view data, Pad pad) {
+  // Function-local to be usable from static initializers of other TUs
+  static const EncodeFunction encode = SelectEncode<Url>();
+  constexpr auto kChars = Alphabet<Url>::kChars;
+
   std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+  response.resize((data.size() + 2) / 3 * 4 + kOutputSlack);
+  char* out = response.data();
+
+  const auto processed = encode(data.data(), data.size(), out);
+  out += processed / 3 * 4;
+
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  std::size_t i = processed;
+  for (; data.size() - i >= 3; i += 3) {
+    const std::uint32_t value = (first[i] << 16) | (first[i + 1] << 8) |
+                                first[i + 2];
+    *out++ = kChars[value >> 18];
+    *out++ = kChars[(value >> 12) & 0x3f];
+    *out++ = kChars[(value >> 6) & 0x3f];
+    *out++ = kChars[value & 0x3f];
   }
+
+  const auto tail = data.size() - i;
+  if (tail != 0) {
+    const std::uint32_t value =
+        (first[i] << 16) | (tail == 2 ? first[i + 1] << 8 : 0);
+    *out++ = kChars[value >> 18];
+    *out++ = kChars[(value >> 12) & 0x3f];
+    if (tail == 2) *out++ = kChars[(value >> 6) & 0x3f];
+    if (pad == Pad::kWith) {
+      *out++ = '=';
+      if (tail == 1) *out++ = '=';
+    }
+  }
+
+  response.resize(out - response.data());
   return response;
 }
 
-template <typename Base64Decoder>
+// Characters out of the alphabet, including the padding, are skipped
+template <bool Url>
 std::string Base64Decode(std::string_view data) {
+  static const DecodeFunction decode = SelectDecode<Url>();
+  constexpr const auto& kValues = Alphabet<Url>::kValues;
+
   std::string response;
-  try {
-    Base64Decoder decoder(new CryptoPP::StringSink(response));
-    decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+  response.resize(data.size() / 4 * 3 + 3 + kOutputSlack);
+  char* out = response.data();
+
+  const auto processed = decode(data.data(), data.size(), out);
+  out += processed / 4 * 3;
+
+  const char* first = data.data() + processed;
+  const char* last = data.data() + data.size();
+  std::uint32_t bits = 0;
+  int bits_count = 0;
+  while (first != last) {
+    if (bits_count == 0 && last - first >= 4) {
+      const auto a = kValues[static_cast<unsigned char>(first[0])];
+      const auto b = kValues[static_cast<unsigned char>(first[1])];
+      const auto c = kValues[static_cast<unsigned char>(first[2])];
+      const auto d = kValues[static_cast<unsigned char>(first[3])];
+      if ((a | b | c | d) >= 0) {
+        const std::uint32_t value = (a << 18) | (b << 12) | (c << 6) | d;
+        *out++ = static_cast<char>(value >> 16);
+        *out++ = static_cast<char>(value >> 8);
+        *out++ = static_cast<char>(value);
+        first += 4;
+        continue;
+      }
+    }
+
+    const auto value = kValues[static_cast<unsigned char>(*first++)];
+    if (value < 0) continue;
+    bits = (bits << 6) | value;
+    bits_count += 6;
+    if (bits_count >= 8) {
+      bits_count -= 8;
+      *out++ = static_cast<char>(bits >> bits_count);
+      bits &= (1u << bits_count) - 1;
+    }
   }
+
+  response.resize(out - response.data());
   return response;
 }
 
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return Base64Encode</*Url=*/false>(data, pad);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  return Base64Decode</*Url=*/false>(data);
 }
 
-#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return Base64Encode</*Url=*/true>(data, pad);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  return Base64Decode</*Url=*/true>(data);
 }
-#endif
 
 }  // namespace crypto::base64
 
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <cryptopp/base64.h>
+
+#include <userver/crypto/base64.hpp>
+
+#ifdef CRYPTOPP_NO_GLOBAL_BYTE
+using CryptoPP::byte;
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The CryptoPP filters that were used before the vectorized implementation
+std::string EncodeReference(std::string_view data) {
+  std::string response;
+  CryptoPP::Base64Encoder encoder(new CryptoPP::StringSink(response));
+  CryptoPP::AlgorithmParameters params = CryptoPP::MakeParameters(
+      CryptoPP::Name::Pad(), true)(CryptoPP::Name::InsertLineBreaks(), false);
+  encoder.IsolatedInitialize(params);
+  encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
+                        data.size());
+  return response;
+}
+
+std::string DecodeReference(std::string_view data) {
+  std::string response;
+  CryptoPP::Base64Decoder decoder(new CryptoPP::StringSink(response));
+  decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
+                        data.size());
+  return response;
+}
+
+std::string MakeData(std::size_t size) {
+  std::string result(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = static_cast<char>(i * 131 + 7);
+  }
+  return result;
+}
+
+}  // namespace
+
+void base64_encode_reference(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(EncodeReference(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(base64_encode_reference)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+void base64_encode(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Encode(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(base64_encode)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+void base64_decode_reference(benchmark::State& state) {
+  const auto encoded = crypto::base64::Base64Encode(MakeData(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(DecodeReference(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(base64_decode_reference)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+void base64_decode(benchmark::State& state) {
+  const auto encoded = crypto::base64::Base64Encode(MakeData(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(base64_decode)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+USERVER_NAMESPACE_END
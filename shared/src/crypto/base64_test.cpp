@@ -1,3 +1,5 @@
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include <userver/crypto/base64.hpp>
@@ -17,14 +19,38 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
-#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+TEST(Crypto, Base64LongData) {
+  // Long enough for all of the vectorized block sizes
+  std::string data;
+  for (int i = 0; i < 200; ++i) {
+    data.push_back(static_cast<char>(i * 37));
+    const auto encoded = crypto::base64::Base64Encode(data);
+    EXPECT_EQ(encoded.size(), (data.size() + 2) / 3 * 4);
+    EXPECT_EQ(data, crypto::base64::Base64Decode(encoded));
+  }
+
+  // Characters out of the alphabet are skipped in any position
+  const auto encoded = crypto::base64::Base64Encode(data);
+  for (std::size_t pos = 0; pos < encoded.size(); pos += 11) {
+    auto wrong = encoded;
+    wrong.insert(pos, "\n-_=");
+    EXPECT_EQ(data, crypto::base64::Base64Decode(wrong));
+  }
+}
+
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
   EXPECT_EQ("U_8", crypto::base64::Base64UrlEncode(
                        "S\xff", crypto::base64::Pad::kWithout));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+  std::string data;
+  for (int i = 0; i < 200; ++i) data.push_back(static_cast<char>(i * 37));
+  auto encoded = crypto::base64::Base64UrlEncode(data);
+  EXPECT_EQ(data, crypto::base64::Base64UrlDecode(encoded));
+  encoded.insert(encoded.size() / 2, "+/");
+  EXPECT_EQ(data, crypto::base64::Base64UrlDecode(encoded));
 }
-#endif
 
 USERVER_NAMESPACE_END
@@ -53,6 +53,12 @@ int ToNative(OpenMode flags) {
     result |= O_TRUNC;
   }
 
+  if (flags & OpenFlag::kAppend) {
+    UINVARIANT(flags & OpenFlag::kWrite,
+               "Cannot use kAppend without kWrite in OpenFlags");
+    result |= O_APPEND;
+  }
+
   return result;
 }
 
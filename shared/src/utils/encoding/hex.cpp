@@ -1,8 +1,14 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <array>
 #include <stdexcept>
 #include <string_view>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_HEX_X86_SIMD
+#include <immintrin.h>
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::encoding {
@@ -22,7 +28,7 @@ char ToHexChar(int num) {
 
 /// Converts xDigit to its value. Undefined behaviour if
 /// xDigit is not one of "0123456789abcdef"
-unsigned char GetXDigitValue(unsigned char x_digit) noexcept {
+constexpr unsigned char GetXDigitValue(unsigned char x_digit) noexcept {
   switch (x_digit) {
     case '0':
       return 0;
@@ -102,6 +108,167 @@ bool IsXDigit(unsigned char x_digit) noexcept {
 }
 }  // namespace detail
 
+namespace {
+
+using EncodeFunction = void (*)(const char* first, std::size_t size,
+                                char* out) noexcept;
+
+// Decodes the longest prefix of valid blocks, returns the end of the prefix
+using DecodeFunction = const char* (*)(const char* first, const char* last,
+                                       char* out) noexcept;
+
+constexpr std::array<unsigned char, 256> MakeXDigitValues() noexcept {
+  std::array<unsigned char, 256> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = detail::GetXDigitValue(static_cast<unsigned char>(i));
+  }
+  return result;
+}
+
+constexpr auto kXDigitValues = MakeXDigitValues();
+
+void EncodeScalar(const char* first, std::size_t size, char* out) noexcept {
+  for (const char* last = first + size; first != last; ++first) {
+    const auto value = static_cast<unsigned char>(*first);
+    // We don't use ToHexChar because it does range checking
+    *out++ = detail::kXdigits[value >> 4];
+    *out++ = detail::kXdigits[value & 0xf];
+  }
+}
+
+const char* DecodeScalar(const char* first, const char*, char*) noexcept {
+  return first;
+}
+
+#ifdef USERVER_HEX_X86_SIMD
+
+// Maps 16 bytes to 32 hex digits
+__attribute__((target("ssse3"))) inline void EncodeBlockSsse3(
+    __m128i input, char* out) noexcept {
+  const auto digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+  const auto nibble = _mm_set1_epi8(0xf);
+  const auto high = _mm_shuffle_epi8(
+      digits, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+  const auto low = _mm_shuffle_epi8(digits, _mm_and_si128(input, nibble));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                   _mm_unpacklo_epi8(high, low));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+                   _mm_unpackhi_epi8(high, low));
+}
+
+__attribute__((target("ssse3"))) void EncodeSsse3(const char* first,
+                                                  std::size_t size,
+                                                  char* out) noexcept {
+  for (; size >= 16; size -= 16, first += 16, out += 32) {
+    EncodeBlockSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                     out);
+  }
+  EncodeScalar(first, size, out);
+}
+
+__attribute__((target("avx2"))) void EncodeAvx2(const char* first,
+                                                std::size_t size,
+                                                char* out) noexcept {
+  const auto digits = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+      'e', 'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b',
+      'c', 'd', 'e', 'f');
+  const auto nibble = _mm256_set1_epi8(0xf);
+
+  for (; size >= 32; size -= 32, first += 32, out += 64) {
+    const auto input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    const auto high = _mm256_shuffle_epi8(
+        digits, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+    const auto low =
+        _mm256_shuffle_epi8(digits, _mm256_and_si256(input, nibble));
+    // unpacking works within 128-bit lanes, the lanes are put back in order
+    const auto lanes_low = _mm256_unpacklo_epi8(high, low);
+    const auto lanes_high = _mm256_unpackhi_epi8(high, low);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                        _mm256_permute2x128_si256(lanes_low, lanes_high, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32),
+                        _mm256_permute2x128_si256(lanes_low, lanes_high, 0x31));
+  }
+  EncodeSsse3(first, size, out);
+}
+
+// Converts 16 hex digits of any case to their values, sets `valid` to 0 if
+// there is a non-digit
+__attribute__((target("ssse3"))) inline __m128i DigitValuesSsse3(
+    __m128i input, bool& valid) noexcept {
+  const auto decimal = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+  const auto is_decimal =
+      _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal);
+  const auto letter = _mm_sub_epi8(_mm_or_si128(input, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+  const auto is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+  valid = _mm_movemask_epi8(_mm_or_si128(is_decimal, is_letter)) == 0xffff;
+  return _mm_or_si128(
+      _mm_and_si128(is_decimal, decimal),
+      _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+__attribute__((target("ssse3"))) const char* DecodeSsse3(const char* first,
+                                                          const char* last,
+                                                          char* out) noexcept {
+  // multiplies the high digit of each pair by 16 and adds the low one
+  const auto merge = _mm_set1_epi16(0x0110);
+
+  for (; last - first >= 32; first += 32, out += 16) {
+    bool valid_low = false;
+    bool valid_high = false;
+    const auto low = DigitValuesSsse3(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), valid_low);
+    const auto high = DigitValuesSsse3(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + 16)),
+        valid_high);
+    if (!valid_low || !valid_high) break;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_packus_epi16(_mm_maddubs_epi16(low, merge),
+                                      _mm_maddubs_epi16(high, merge)));
+  }
+  return first;
+}
+
+EncodeFunction SelectEncode() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return &EncodeAvx2;
+  if (__builtin_cpu_supports("ssse3")) return &EncodeSsse3;
+  return &EncodeScalar;
+}
+
+DecodeFunction SelectDecode() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("ssse3")) return &DecodeSsse3;
+  return &DecodeScalar;
+}
+
+#else
+
+EncodeFunction SelectEncode() noexcept { return &EncodeScalar; }
+
+DecodeFunction SelectDecode() noexcept { return &DecodeScalar; }
+
+#endif
+
+void Encode(const char* first, std::size_t size, char* out) noexcept {
+  // Function-local to be usable from static initializers of other TUs
+  static const EncodeFunction encode = SelectEncode();
+  encode(first, size, out);
+}
+
+const char* Decode(const char* first, const char* last, char* out) noexcept {
+  static const DecodeFunction decode = SelectDecode();
+  return decode(first, last, out);
+}
+
+}  // namespace
+
 std::string_view GetHexPart(std::string_view encoded) noexcept {
   const char* ptr = encoded.data();
   const char* last = ptr + encoded.size();
@@ -122,16 +289,8 @@ std::string_view GetHexPart(std::string_view encoded) noexcept {
 
 void ToHex(std::string_view input, std::string& out) noexcept {
   out.clear();
-  out.reserve(input.size() * 2);
-  const auto* first = input.data();
-  const auto* last = input.data() + input.size();
-  while (first != last) {
-    const auto value = *first;
-    // We don't use ToHexChar because it does range checking
-    out.push_back(detail::kXdigits[(value >> 4) & 0xf]);
-    out.push_back(detail::kXdigits[value & 0xf]);
-    ++first;
-  }
+  out.resize(LengthInHexForm(input));
+  Encode(input.data(), input.size(), out.data());
 }
 
 bool IsHexData(std::string_view encoded) noexcept {
@@ -147,8 +306,14 @@ bool IsHexData(std::string_view encoded) noexcept {
 size_t FromHex(std::string_view encoded, std::string& out) noexcept {
   // we need to read in pairs
   const char* first = encoded.data();
-  const char* pair_ptr = first;
   const char* last = first + encoded.size();
+
+  // the valid prefix is decoded in blocks, the rest is checked pair by pair
+  const auto old_size = out.size();
+  out.resize(old_size + FromHexUpperBound(encoded.size()));
+  const char* pair_ptr = Decode(first, last, out.data() + old_size);
+  out.resize(old_size + (pair_ptr - first) / 2);
+
   for (; pair_ptr != last; pair_ptr += 2) {
     if (!detail::IsXDigit(pair_ptr[0])) {
       break;
@@ -162,8 +327,9 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
       break;
     }
 
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+    out.push_back(
+        (kXDigitValues[static_cast<unsigned char>(pair_ptr[0])] << 4) |
+        kXDigitValues[static_cast<unsigned char>(pair_ptr[1])]);
   }
 
   return static_cast<size_t>(std::distance(first, pair_ptr));
@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// The per-character implementation that was used before the vectorized one
+std::string ToHexReference(std::string_view input) {
+  constexpr std::string_view kXdigits = "0123456789abcdef";
+  std::string out;
+  out.reserve(input.size() * 2);
+  for (const char value : input) {
+    out.push_back(kXdigits[(value >> 4) & 0xf]);
+    out.push_back(kXdigits[value & 0xf]);
+  }
+  return out;
+}
+
+std::string MakeData(std::size_t size) {
+  std::string result(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = static_cast<char>(i * 131 + 7);
+  }
+  return result;
+}
+
+}  // namespace
+
+void hex_encode_reference(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ToHexReference(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(hex_encode_reference)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+void hex_encode(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::encoding::ToHex(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(hex_encode)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+void hex_decode(benchmark::State& state) {
+  const auto encoded = utils::encoding::ToHex(MakeData(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::encoding::FromHex(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(hex_decode)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+USERVER_NAMESPACE_END
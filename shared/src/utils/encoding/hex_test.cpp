@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cctype>
 #include <forward_list>
 #include <string>
 
@@ -131,6 +132,32 @@ TEST(Hex, GetHexPart) {
   }
 }
 
+TEST(Hex, LongData) {
+  std::string data;
+  std::string reference;
+  for (int i = 0; i < 300; ++i) {
+    data.push_back(static_cast<char>(i * 7));
+    reference += ToHex(std::string_view{&data.back(), 1});
+
+    EXPECT_EQ(reference, ToHex(data));
+
+    std::string result;
+    EXPECT_EQ(reference.size(), FromHex(reference, result));
+    EXPECT_EQ(data, result);
+  }
+
+  // Upper case digits are decoded, wrong symbols stop decoding in any block
+  std::string upper = reference;
+  for (auto& c : upper) c = std::toupper(c);
+  for (std::size_t pos = 0; pos < upper.size(); pos += 13) {
+    std::string wrong = upper;
+    wrong[pos] = 'g';
+    std::string result;
+    EXPECT_EQ(pos / 2 * 2, FromHex(wrong, result));
+    EXPECT_EQ(data.substr(0, pos / 2), result);
+  }
+}
+
 }  // namespace utils::encoding
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <userver/utils/encoding/tskv.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_TSKV_X86_SIMD
+#include <immintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::encoding::impl {
+
+namespace {
+
+using FindFunction = const char* (*)(const char*, const char*) noexcept;
+
+constexpr bool IsValueEscape(char ch) noexcept {
+  return ch == '\t' || ch == '\r' || ch == '\n' || ch == '\0' || ch == '\\';
+}
+
+const char* FindScalar(const char* first, const char* last) noexcept {
+  for (; first != last; ++first) {
+    if (IsValueEscape(*first)) return first;
+  }
+  return last;
+}
+
+#ifdef USERVER_TSKV_X86_SIMD
+
+// SSE2 is a part of the x86_64 baseline and needs no checks
+const char* FindSse2(const char* first, const char* last) noexcept {
+  const auto tab = _mm_set1_epi8('\t');
+  const auto cr = _mm_set1_epi8('\r');
+  const auto lf = _mm_set1_epi8('\n');
+  const auto backslash = _mm_set1_epi8('\\');
+  const auto zero = _mm_setzero_si128();
+
+  for (; last - first >= 16; first += 16) {
+    const auto chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    const auto matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, cr)),
+        _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, lf),
+                         _mm_cmpeq_epi8(chunk, backslash)),
+            _mm_cmpeq_epi8(chunk, zero)));
+    const auto mask = _mm_movemask_epi8(matches);
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindScalar(first, last);
+}
+
+__attribute__((target("avx2"))) const char* FindAvx2(const char* first,
+                                                     const char* last) noexcept {
+  const auto tab = _mm256_set1_epi8('\t');
+  const auto cr = _mm256_set1_epi8('\r');
+  const auto lf = _mm256_set1_epi8('\n');
+  const auto backslash = _mm256_set1_epi8('\\');
+  const auto zero = _mm256_setzero_si256();
+
+  for (; last - first >= 32; first += 32) {
+    const auto chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    const auto matches = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, tab),
+                        _mm256_cmpeq_epi8(chunk, cr)),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, lf),
+                            _mm256_cmpeq_epi8(chunk, backslash)),
+            _mm256_cmpeq_epi8(chunk, zero)));
+    const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(matches));
+    if (mask) return first + __builtin_ctz(mask);
+  }
+  return FindSse2(first, last);
+}
+
+FindFunction SelectFind() noexcept {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return &FindAvx2;
+  return &FindSse2;
+}
+
+#else
+
+FindFunction SelectFind() noexcept { return &FindScalar; }
+
+#endif
+
+}  // namespace
+
+const char* FindTskvValueEscape(const char* first, const char* last) noexcept {
+  // Function-local to be usable from static initializers of other TUs
+  static const FindFunction find = SelectFind();
+  return find(first, last);
+}
+
+}  // namespace utils::encoding::impl
+
+USERVER_NAMESPACE_END
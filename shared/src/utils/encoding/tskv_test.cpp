@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -35,4 +36,62 @@ TEST(tskv, TAXICOMMON1362) {
       << "Result: " << result;
 }
 
+namespace {
+
+std::string EncodeTskvByChar(const std::string& str,
+                             utils::encoding::EncodeTskvMode mode) {
+  std::string result;
+  for (char ch : str) utils::encoding::EncodeTskv(result, ch, mode);
+  return result;
+}
+
+struct PutCharOnly {
+  void operator()(std::string& to, char ch) const { to.push_back(ch); }
+};
+
+}  // namespace
+
+TEST(tskv, SameAsScalar) {
+  const std::string specials = "\t\r\n\\=.Aa";
+  for (std::size_t size = 0; size < 200; ++size) {
+    for (std::size_t special_pos = 0; special_pos <= size; special_pos += 7) {
+      for (char special : {'\t', '\r', '\n', '\0', '\\', '=', '.', 'Q'}) {
+        std::string str(size, 'x');
+        if (special_pos < size) str[special_pos] = special;
+        if (size > 40) str[size - 1] = specials[size % specials.size()];
+
+        for (auto mode : {utils::encoding::EncodeTskvMode::kValue,
+                          utils::encoding::EncodeTskvMode::kKey,
+                          utils::encoding::EncodeTskvMode::kKeyReplacePeriod}) {
+          const auto expected = EncodeTskvByChar(str, mode);
+
+          std::string result;
+          utils::encoding::EncodeTskv(result, str, mode);
+          ASSERT_EQ(expected, result) << "size=" << size;
+
+          std::ostringstream stream;
+          utils::encoding::EncodeTskv(stream, str.data(), str.size(), mode);
+          ASSERT_EQ(expected, stream.str()) << "size=" << size;
+
+          result.clear();
+          utils::encoding::EncodeTskv(result, str.data(),
+                                      str.data() + str.size(), mode,
+                                      PutCharOnly{});
+          ASSERT_EQ(expected, result) << "size=" << size;
+        }
+      }
+    }
+  }
+}
+
+TEST(tskv, BinarySameAsScalar) {
+  const std::string str(reinterpret_cast<const char*>(tskv_test::data_bin),
+                        sizeof(tskv_test::data_bin));
+  std::string result;
+  utils::encoding::EncodeTskv(result, str,
+                              utils::encoding::EncodeTskvMode::kValue);
+  EXPECT_EQ(EncodeTskvByChar(str, utils::encoding::EncodeTskvMode::kValue),
+            result);
+}
+
 USERVER_NAMESPACE_END
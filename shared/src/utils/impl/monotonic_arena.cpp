@@ -0,0 +1,91 @@
+#include <userver/utils/impl/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+constexpr std::size_t kMinHeapBlockSize = 1024;
+
+char* AlignUp(char* ptr, std::size_t alignment) noexcept {
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+  return ptr + (aligned - address);
+}
+
+}  // namespace
+
+struct alignas(std::max_align_t) MonotonicArena::BlockHeader final {
+  BlockHeader* next;
+};
+
+MonotonicArena::MonotonicArena() noexcept
+    : next_block_size_(kMinHeapBlockSize) {}
+
+MonotonicArena::MonotonicArena(void* initial_buffer,
+                               std::size_t initial_size) noexcept
+    : current_(static_cast<char*>(initial_buffer)),
+      end_(current_ + initial_size),
+      next_block_size_(initial_size * 2 > kMinHeapBlockSize ? initial_size * 2
+                                                            : kMinHeapBlockSize) {
+}
+
+MonotonicArena::~MonotonicArena() {
+  while (blocks_) {
+    auto* next = blocks_->next;
+    ::operator delete(blocks_);
+    blocks_ = next;
+  }
+}
+
+void* MonotonicArena::Allocate(std::size_t size, std::size_t alignment) {
+  UASSERT(alignment && (alignment & (alignment - 1)) == 0);
+
+  if (current_) {
+    auto* result = AlignUp(current_, alignment);
+    if (result <= end_ && size <= static_cast<std::size_t>(end_ - result)) {
+      current_ = result + size;
+      return result;
+    }
+  }
+
+  return AllocateFromNewBlock(size, alignment);
+}
+
+std::string_view MonotonicArena::CopyString(std::string_view str) {
+  if (str.empty()) return {};
+
+  auto* data = static_cast<char*>(Allocate(str.size(), 1));
+  std::memcpy(data, str.data(), str.size());
+  return {data, str.size()};
+}
+
+void* MonotonicArena::AllocateFromNewBlock(std::size_t size,
+                                           std::size_t alignment) {
+  auto block_size = next_block_size_;
+  while (block_size < size + alignment) block_size *= 2;
+
+  auto* block = static_cast<BlockHeader*>(
+      ::operator new(sizeof(BlockHeader) + block_size));
+  block->next = blocks_;
+  blocks_ = block;
+  ++heap_blocks_count_;
+  next_block_size_ = block_size * 2;
+
+  current_ = reinterpret_cast<char*>(block + 1);
+  end_ = current_ + block_size;
+
+  auto* result = AlignUp(current_, alignment);
+  current_ = result + size;
+  return result;
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
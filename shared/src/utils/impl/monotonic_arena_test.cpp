@@ -0,0 +1,83 @@
+#include <userver/utils/impl/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(MonotonicArena, InitialBuffer) {
+  alignas(std::max_align_t) char buffer[256];
+  utils::impl::MonotonicArena arena(buffer, sizeof(buffer));
+
+  auto* first = static_cast<char*>(arena.Allocate(10, 1));
+  auto* second = static_cast<char*>(arena.Allocate(8, 8));
+  EXPECT_GE(first, buffer);
+  EXPECT_LT(second, buffer + sizeof(buffer));
+  EXPECT_GE(second, first + 10);
+  EXPECT_TRUE(IsAligned(second, 8));
+  EXPECT_EQ(arena.GetHeapBlocksCount(), 0);
+
+  arena.Allocate(sizeof(buffer), 1);
+  EXPECT_EQ(arena.GetHeapBlocksCount(), 1);
+}
+
+TEST(MonotonicArena, HeapBlocks) {
+  utils::impl::MonotonicArena arena;
+  for (int i = 0; i < 1000; ++i) {
+    auto* ptr = arena.Allocate(24, alignof(std::max_align_t));
+    EXPECT_TRUE(IsAligned(ptr, alignof(std::max_align_t)));
+  }
+  // blocks grow geometrically
+  EXPECT_LE(arena.GetHeapBlocksCount(), 8);
+
+  auto* big = arena.Allocate(1 << 20, 64);
+  EXPECT_TRUE(IsAligned(big, 64));
+}
+
+TEST(MonotonicArena, CopyString) {
+  utils::impl::MonotonicArena arena;
+  std::string str = "some long string that does not fit into SSO";
+  const auto copy = arena.CopyString(str);
+  str.assign(str.size(), 'x');
+  EXPECT_EQ(copy, "some long string that does not fit into SSO");
+  EXPECT_TRUE(arena.CopyString({}).empty());
+}
+
+TEST(MonotonicArena, Containers) {
+  alignas(std::max_align_t) char buffer[4096];
+  utils::impl::MonotonicArena arena(buffer, sizeof(buffer));
+
+  using Allocator = utils::impl::ArenaAllocator<std::pair<const int, int>>;
+  std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Allocator>
+      map(16, std::hash<int>{}, std::equal_to<int>{}, Allocator{arena});
+  for (int i = 0; i < 50; ++i) map.emplace(i, i);
+
+  std::vector<int, utils::impl::ArenaAllocator<int>> vector(
+      utils::impl::ArenaAllocator<int>{arena});
+  for (int i = 0; i < 100; ++i) vector.push_back(i);
+
+  EXPECT_EQ(map.size(), 50);
+  EXPECT_EQ(vector.size(), 100);
+  EXPECT_EQ(arena.GetHeapBlocksCount(), 0);
+}
+
+TEST(MonotonicArena, DefaultAllocatorUsesHeap) {
+  std::vector<std::string, utils::impl::ArenaAllocator<std::string>> vector;
+  vector.assign(100, "value");
+  EXPECT_EQ(vector.size(), 100);
+  EXPECT_EQ(vector.get_allocator().GetArena(), nullptr);
+}
+
+USERVER_NAMESPACE_END
@@ -1,17 +1,40 @@
 #include <userver/utils/uuid4.hpp>
 
-#include <userver/utils/boost_uuid4.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
 #include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::generators {
 
 std::string GenerateUuid() {
-  const auto val = GenerateBoostUuid();
-  return encoding::ToHex(val.begin(), val.size());
+  const auto bytes = impl::GenerateUuidBytes();
+  return encoding::ToHex(bytes.data(), bytes.size());
+}
+
+namespace impl {
+
+std::array<std::uint8_t, 16> GenerateUuidBytes() {
+  // Same bits as GenerateBoostUuid() produces, without building a boost uuid
+  auto& random = DefaultRandom();
+  std::array<std::uint8_t, 16> bytes{};
+  for (std::size_t i = 0; i < bytes.size(); i += sizeof(std::uint32_t)) {
+    const std::uint32_t value = random();
+    std::memcpy(bytes.data() + i, &value, sizeof(value));
+  }
+
+  // variant is RFC 4122, version is 4 (random)
+  bytes[8] = (bytes[8] & 0x3f) | 0x80;
+  bytes[6] = (bytes[6] & 0x0f) | 0x40;
+  return bytes;
 }
 
+}  // namespace impl
+
 }  // namespace utils::generators
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+
+#include <boost/uuid/uuid.hpp>
+
+#include <userver/utils/boost_uuid4.hpp>
+#include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/uuid4.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+void uuid_generate_via_boost(benchmark::State& state) {
+  for (auto _ : state) {
+    // The way GenerateUuid() used to work
+    const auto uuid = utils::generators::GenerateBoostUuid();
+    benchmark::DoNotOptimize(utils::encoding::ToHex(uuid.begin(), uuid.size()));
+  }
+}
+BENCHMARK(uuid_generate_via_boost);
+
+void uuid_generate(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(utils::generators::GenerateUuid());
+  }
+}
+BENCHMARK(uuid_generate);
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,11 @@
 #include <userver/utils/uuid4.hpp>
 
+#include <string_view>
+
 #include <gtest/gtest.h>
 
+#include <userver/utils/encoding/hex.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(UUID, String) {
@@ -14,4 +18,12 @@ TEST(UUID, String) {
             utils::generators::GenerateUuid());
 }
 
+TEST(UUID, Version4) {
+  const auto uuid = utils::generators::GenerateUuid();
+  ASSERT_EQ(uuid.size(), 32u);
+  EXPECT_TRUE(utils::encoding::IsHexData(uuid));
+  EXPECT_EQ(uuid[12], '4');
+  EXPECT_NE(std::string_view{"89ab"}.find(uuid[16]), std::string_view::npos);
+}
+
 USERVER_NAMESPACE_END